@@ -23,10 +23,129 @@
 #ifndef MICROLIBRARY_ALGORITHM_H
 #define MICROLIBRARY_ALGORITHM_H
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 #include "microlibrary/result.h"
 
+namespace microlibrary::Implementation {
+
+#if defined( __GNUC__ )
+/**
+ * \brief Word-at-a-time range processing is supported.
+ *
+ * Ranges are only processed a word at a time on targets where words have stricter
+ * alignment requirements than bytes (e.g. 32-bit ARM and the development environment).
+ * On targets with single byte aligned words (e.g. AVR), processing a range a word at a
+ * time has no throughput benefit.
+ */
+inline constexpr auto WORD_AT_A_TIME_IS_SUPPORTED = alignof( std::uintptr_t ) > 1;
+#else  // defined( __GNUC__ )
+/**
+ * \brief Word-at-a-time range processing is supported.
+ */
+inline constexpr auto WORD_AT_A_TIME_IS_SUPPORTED = false;
+#endif // defined( __GNUC__ )
+
+/**
+ * \brief Check if an iterator is a pointer to a byte that can be processed a word at a
+ *        time.
+ *
+ * Pointers to volatile bytes are excluded since each volatile access must be performed
+ * as written.
+ *
+ * \tparam Iterator The iterator to check.
+ */
+template<typename Iterator, typename Value = std::remove_cv_t<std::remove_pointer_t<Iterator>>>
+inline constexpr auto IS_BYTE_POINTER = std::is_pointer_v<Iterator>
+                                        and not std::is_volatile_v<std::remove_pointer_t<Iterator>>
+                                        and sizeof( Value ) == 1
+                                        and ( ( std::is_integral_v<Value> and not std::is_same_v<Value, bool> )
+                                              or std::is_same_v<Value, std::byte> );
+
+/**
+ * \brief Check if a pair of iterators are pointers to the same trivially copyable type
+ *        that can be copied a word at a time.
+ *
+ * Pointers to volatile values are excluded since each volatile access must be performed
+ * as written.
+ *
+ * \tparam Iterator The source iterator to check.
+ * \tparam Output_Iterator The destination iterator to check.
+ */
+template<typename Iterator, typename Output_Iterator, typename Value = std::remove_cv_t<std::remove_pointer_t<Iterator>>>
+inline constexpr auto IS_TRIVIALLY_COPYABLE_POINTER_PAIR = std::is_pointer_v<Iterator> and std::is_pointer_v<Output_Iterator>
+                                                           and not std::is_volatile_v<std::remove_pointer_t<Iterator>>
+                                                           and not std::is_volatile_v<std::remove_pointer_t<Output_Iterator>>
+                                                           and std::is_same_v<Value *, Output_Iterator>
+                                                           and std::is_trivially_copyable_v<Value>;
+
+/**
+ * \brief Check if a function call is being constant evaluated.
+ *
+ * \return true if the function call is being constant evaluated, or if constant
+ *         evaluation cannot be detected.
+ * \return false if the function call is not being constant evaluated.
+ */
+constexpr auto is_constant_evaluated() noexcept -> bool
+{
+#if defined( __GNUC__ )
+    return __builtin_is_constant_evaluated();
+#else  // defined( __GNUC__ )
+    return true;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Fill a range of bytes with a value a word at a time.
+ *
+ * \param[in] begin The beginning of the range to fill.
+ * \param[in] end The end of the range to fill.
+ * \param[in] value The value to fill the range with.
+ */
+void fill_words( unsigned char * begin, unsigned char * end, unsigned char value ) noexcept;
+
+/**
+ * \brief Check if two ranges of bytes are equal a word at a time.
+ *
+ * \param[in] begin_1 The beginning of the first of the two ranges to be compared.
+ * \param[in] end_1 The end of the first of the two ranges to be compared.
+ * \param[in] begin_2 The beginning of the second of the two ranges to be compared.
+ *
+ * \return true if the two ranges are equal.
+ * \return false if the two ranges are not equal.
+ */
+auto equal_words( unsigned char const * begin_1, unsigned char const * end_1, unsigned char const * begin_2 ) noexcept
+    -> bool;
+
+/**
+ * \brief Copy a range of bytes a word at a time.
+ *
+ * \param[in] begin The beginning of the range to copy.
+ * \param[in] end The end of the range to copy.
+ * \param[in] destination The beginning of the range to copy to (must not be in [begin,
+ *            end)).
+ */
+void copy_words( unsigned char const * begin, unsigned char const * end, unsigned char * destination ) noexcept;
+
+/**
+ * \brief Find the first occurrence of a value in a range of bytes a word at a time.
+ *
+ * \param[in] begin The beginning of the range to search.
+ * \param[in] end The end of the range to search.
+ * \param[in] value The value to search for.
+ *
+ * \return The first occurrence of the value in the range if the range contains the
+ *         value.
+ * \return end if the range does not contain the value.
+ */
+auto find_words( unsigned char const * begin, unsigned char const * end, unsigned char value ) noexcept
+    -> unsigned char const *;
+
+} // namespace microlibrary::Implementation
+
 namespace microlibrary {
 
 /**
@@ -158,6 +277,9 @@ constexpr auto for_each( Iterator begin, Iterator end, Functor functor ) noexcep
 /**
  * \brief Fill a range with a value.
  *
+ * If the range is a contiguous range of bytes, it is filled a word at a time when
+ * supported by the target.
+ *
  * \tparam Iterator Range iterator.
  * \tparam T Value type.
  *
@@ -168,6 +290,17 @@ constexpr auto for_each( Iterator begin, Iterator end, Functor functor ) noexcep
 template<typename Iterator, typename T>
 constexpr void fill( Iterator begin, Iterator end, T const & value ) noexcept
 {
+    if constexpr ( Implementation::WORD_AT_A_TIME_IS_SUPPORTED and Implementation::IS_BYTE_POINTER<Iterator> ) {
+        if ( not Implementation::is_constant_evaluated() ) {
+            Implementation::fill_words(
+                reinterpret_cast<unsigned char *>( begin ),
+                reinterpret_cast<unsigned char *>( end ),
+                static_cast<unsigned char>( static_cast<std::remove_pointer_t<Iterator>>( value ) ) );
+
+            return;
+        } // if
+    }     // if
+
     for ( ; begin != end; ++begin ) { *begin = value; } // for
 }
 
@@ -290,6 +423,18 @@ constexpr auto max( T const & a, T const & b ) noexcept -> T const &
 template<typename Iterator_1, typename Iterator_2>
 constexpr auto equal( Iterator_1 begin_1, Iterator_1 end_1, Iterator_2 begin_2 ) noexcept -> bool
 {
+    if constexpr (
+        Implementation::WORD_AT_A_TIME_IS_SUPPORTED and Implementation::IS_BYTE_POINTER<Iterator_1>
+        and Implementation::IS_BYTE_POINTER<Iterator_2>
+        and std::is_same_v<std::remove_cv_t<std::remove_pointer_t<Iterator_1>>, std::remove_cv_t<std::remove_pointer_t<Iterator_2>>> ) {
+        if ( not Implementation::is_constant_evaluated() ) {
+            return Implementation::equal_words(
+                reinterpret_cast<unsigned char const *>( begin_1 ),
+                reinterpret_cast<unsigned char const *>( end_1 ),
+                reinterpret_cast<unsigned char const *>( begin_2 ) );
+        } // if
+    }     // if
+
     for ( ; begin_1 != end_1; ++begin_1, ++begin_2 ) {
         if ( *begin_1 != *begin_2 ) {
             return false;
@@ -383,6 +528,138 @@ constexpr auto equal( Iterator_1 begin_1, Iterator_1 end_1, Iterator_2 begin_2,
     return ::microlibrary::equal( begin_1, end_1, begin_2, std::move( predicate ) );
 }
 
+/**
+ * \brief Copy a range.
+ *
+ * If the range is a contiguous range of trivially copyable values, it is copied a word at
+ * a time when supported by the target.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam Output_Iterator Destination range iterator.
+ *
+ * \param[in] begin The beginning of the range to copy.
+ * \param[in] end The end of the range to copy.
+ * \param[in] destination The beginning of the range to copy to (must not be in [begin,
+ *            end)).
+ *
+ * \return The end of the range that was copied to.
+ */
+template<typename Iterator, typename Output_Iterator>
+constexpr auto copy( Iterator begin, Iterator end, Output_Iterator destination ) noexcept -> Output_Iterator
+{
+    if constexpr ( Implementation::WORD_AT_A_TIME_IS_SUPPORTED and Implementation::IS_TRIVIALLY_COPYABLE_POINTER_PAIR<Iterator, Output_Iterator> ) {
+        if ( not Implementation::is_constant_evaluated() ) {
+            Implementation::copy_words(
+                reinterpret_cast<unsigned char const *>( begin ),
+                reinterpret_cast<unsigned char const *>( end ),
+                reinterpret_cast<unsigned char *>( destination ) );
+
+            return destination + ( end - begin );
+        } // if
+    }     // if
+
+    for ( ; begin != end; ++begin, ++destination ) { *destination = *begin; } // for
+
+    return destination;
+}
+
+/**
+ * \brief Copy a number of values from a range.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam Size Value count type.
+ * \tparam Output_Iterator Destination range iterator.
+ *
+ * \param[in] begin The beginning of the range to copy.
+ * \param[in] n The number of values to copy.
+ * \param[in] destination The beginning of the range to copy to (must not be in [begin,
+ *            begin + n)).
+ *
+ * \return The end of the range that was copied to.
+ */
+template<typename Iterator, typename Size, typename Output_Iterator>
+constexpr auto copy_n( Iterator begin, Size n, Output_Iterator destination ) noexcept -> Output_Iterator
+{
+    if constexpr ( std::is_pointer_v<Iterator> ) {
+        return ::microlibrary::copy( begin, begin + n, destination );
+    } else {
+        for ( ; n > 0; --n, ++begin, ++destination ) { *destination = *begin; } // for
+
+        return destination;
+    } // else
+}
+
+/**
+ * \brief Move a range.
+ *
+ * If the range is a contiguous range of trivially copyable values, it is copied a word at
+ * a time when supported by the target.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam Output_Iterator Destination range iterator.
+ *
+ * \param[in] begin The beginning of the range to move.
+ * \param[in] end The end of the range to move.
+ * \param[in] destination The beginning of the range to move to (must not be in [begin,
+ *            end)).
+ *
+ * \return The end of the range that was moved to.
+ */
+template<typename Iterator, typename Output_Iterator>
+constexpr auto move( Iterator begin, Iterator end, Output_Iterator destination ) noexcept -> Output_Iterator
+{
+    if constexpr ( Implementation::IS_TRIVIALLY_COPYABLE_POINTER_PAIR<Iterator, Output_Iterator> ) {
+        return ::microlibrary::copy( begin, end, destination );
+    } else {
+        for ( ; begin != end; ++begin, ++destination ) {
+            *destination = std::move( *begin );
+        } // for
+
+        return destination;
+    } // else
+}
+
+/**
+ * \brief Find the first occurrence of a value in a range.
+ *
+ * If the range is a contiguous range of bytes, it is searched a word at a time when
+ * supported by the target.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam T Value type.
+ *
+ * \param[in] begin The beginning of the range to search.
+ * \param[in] end The end of the range to search.
+ * \param[in] value The value to search for.
+ *
+ * \return The first occurrence of the value in the range if the range contains the
+ *         value.
+ * \return end if the range does not contain the value.
+ */
+template<typename Iterator, typename T>
+constexpr auto find( Iterator begin, Iterator end, T const & value ) noexcept -> Iterator
+{
+    if constexpr ( Implementation::WORD_AT_A_TIME_IS_SUPPORTED and Implementation::IS_BYTE_POINTER<Iterator> ) {
+        if ( not Implementation::is_constant_evaluated() ) {
+            auto const byte = static_cast<std::remove_cv_t<std::remove_pointer_t<Iterator>>>( value );
+            if ( byte != value ) {
+                return end;
+            } // if
+
+            return begin
+                   + ( Implementation::find_words(
+                           reinterpret_cast<unsigned char const *>( begin ),
+                           reinterpret_cast<unsigned char const *>( end ),
+                           static_cast<unsigned char>( byte ) )
+                       - reinterpret_cast<unsigned char const *>( begin ) );
+        } // if
+    }     // if
+
+    for ( ; begin != end and not( *begin == value ); ++begin ) {} // for
+
+    return begin;
+}
+
 } // namespace microlibrary
 
 #endif // MICROLIBRARY_ALGORITHM_H
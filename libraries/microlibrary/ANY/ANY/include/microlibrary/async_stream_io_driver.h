@@ -0,0 +1,548 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Async_Stream_IO_Driver and
+ *        microlibrary::Fault_Reporting_Async_Stream_IO_Driver interface.
+ */
+
+#ifndef MICROLIBRARY_ASYNC_STREAM_IO_DRIVER_H
+#define MICROLIBRARY_ASYNC_STREAM_IO_DRIVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/ring_buffer.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief Block until space is available back-pressure policy.
+ */
+struct Block_On_Back_Pressure {
+};
+
+/**
+ * \brief Drop the data that does not fit back-pressure policy.
+ */
+struct Drop_Newest_On_Back_Pressure {
+};
+
+/**
+ * \brief Drop the oldest queued data to make room back-pressure policy.
+ */
+struct Drop_Oldest_On_Back_Pressure {
+};
+
+/**
+ * \brief Asynchronous (interrupt driven) transmit stream I/O driver.
+ *
+ * Writes are queued in a transmit queue, and the transmit queue is drained from the
+ * device's transmit ready interrupt. A HIL specific derived class must implement
+ * microlibrary::Async_Stream_IO_Driver::enable_transmit_ready_interrupt() and
+ * microlibrary::Async_Stream_IO_Driver::disable_transmit_ready_interrupt(), and call
+ * microlibrary::Async_Stream_IO_Driver::handle_transmit_ready() from the device's
+ * transmit ready interrupt service routine.
+ *
+ * \tparam N The capacity of the transmit queue (must be a power of two).
+ * \tparam Back_Pressure_Policy The policy used when a write does not fit in the transmit
+ *         queue (microlibrary::Block_On_Back_Pressure,
+ *         microlibrary::Drop_Newest_On_Back_Pressure, or
+ *         microlibrary::Drop_Oldest_On_Back_Pressure).
+ */
+template<std::size_t N, typename Back_Pressure_Policy = Block_On_Back_Pressure>
+class Async_Stream_IO_Driver : public Stream_IO_Driver {
+  public:
+    static_assert(
+        std::is_same_v<Back_Pressure_Policy, Block_On_Back_Pressure>
+        or std::is_same_v<Back_Pressure_Policy, Drop_Newest_On_Back_Pressure>
+        or std::is_same_v<Back_Pressure_Policy, Drop_Oldest_On_Back_Pressure> );
+
+    /**
+     * \brief The transmit queue size type.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Get the capacity of the transmit queue.
+     *
+     * \return The capacity of the transmit queue.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of characters/data that are currently queued.
+     *
+     * \return The number of characters/data that are currently queued.
+     */
+    auto size() const noexcept -> Size
+    {
+        return m_queue.size();
+    }
+
+    /**
+     * \brief Queue a character for transmission.
+     *
+     * \param[in] character The character to queue for transmission.
+     */
+    void put( char character ) noexcept override
+    {
+        auto const data = static_cast<std::uint8_t>( character );
+
+        enqueue( &data, &data + 1 );
+    }
+
+    /**
+     * \brief Queue a block of characters for transmission.
+     *
+     * \param[in] begin The beginning of the block of characters to queue for
+     *            transmission.
+     * \param[in] end The end of the block of characters to queue for transmission.
+     */
+    void put( char const * begin, char const * end ) noexcept override
+    {
+        enqueue(
+            reinterpret_cast<std::uint8_t const *>( begin ),
+            reinterpret_cast<std::uint8_t const *>( end ) );
+    }
+
+    /**
+     * \brief Queue a null-terminated string for transmission.
+     *
+     * \param[in] string The null-terminated string to queue for transmission.
+     */
+    void put( char const * string ) noexcept override
+    {
+        put( string, string + std::strlen( string ) );
+    }
+
+    /**
+     * \brief Queue data for transmission.
+     *
+     * \param[in] data The data to queue for transmission.
+     */
+    void put( std::uint8_t data ) noexcept override
+    {
+        enqueue( &data, &data + 1 );
+    }
+
+    /**
+     * \brief Queue a block of data for transmission.
+     *
+     * \param[in] begin The beginning of the block of data to queue for transmission.
+     * \param[in] end The end of the block of data to queue for transmission.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override
+    {
+        enqueue( begin, end );
+    }
+
+    /**
+     * \brief Queue a list of blocks of characters for transmission.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to queue for
+     *            transmission.
+     * \param[in] end The end of the list of blocks of characters to queue for
+     *            transmission.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override
+    {
+        for ( ; begin != end; ++begin ) {
+            enqueue(
+                reinterpret_cast<std::uint8_t const *>( begin->begin ),
+                reinterpret_cast<std::uint8_t const *>( begin->end ) );
+        } // for
+    }
+
+    /**
+     * \brief Block until the transmit queue has been drained.
+     */
+    void flush() noexcept override
+    {
+        while ( not m_queue.empty() ) {} // while
+    }
+
+    /**
+     * \brief Transmit ready interrupt handler.
+     *
+     * \attention This function must only be called from the device's transmit ready
+     *            interrupt service routine.
+     *
+     * \return The data to transmit if the transmit queue is not empty.
+     * \return microlibrary::Generic_Error::WOULD_UNDERFLOW if the transmit queue is empty
+     *         (the transmit ready interrupt is disabled before the error is returned).
+     */
+    auto handle_transmit_ready() noexcept -> Result<std::uint8_t>
+    {
+        auto result = m_queue.pop();
+        if ( result.is_error() ) {
+            disable_transmit_ready_interrupt();
+        } // if
+
+        return result;
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Async_Stream_IO_Driver() noexcept = default;
+
+    Async_Stream_IO_Driver( Async_Stream_IO_Driver && ) = delete;
+
+    Async_Stream_IO_Driver( Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Async_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Async_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Enable the device's transmit ready interrupt.
+     *
+     * \attention Enabling the transmit ready interrupt when it is already enabled must
+     *            have no effect.
+     */
+    virtual void enable_transmit_ready_interrupt() noexcept = 0;
+
+    /**
+     * \brief Disable the device's transmit ready interrupt.
+     */
+    virtual void disable_transmit_ready_interrupt() noexcept = 0;
+
+  private:
+    /**
+     * \brief The transmit queue.
+     */
+    Ring_Buffer<std::uint8_t, N> m_queue{};
+
+    /**
+     * \brief Queue a block of data for transmission.
+     *
+     * \param[in] begin The beginning of the block of data to queue for transmission.
+     * \param[in] end The end of the block of data to queue for transmission.
+     */
+    void enqueue( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    {
+        if constexpr ( std::is_same_v<Back_Pressure_Policy, Block_On_Back_Pressure> ) {
+            while ( begin != end ) {
+                auto const progress = m_queue.push( begin, end );
+                if ( progress != begin ) {
+                    enable_transmit_ready_interrupt();
+
+                    begin = progress;
+                } // if
+            }     // while
+        } else if constexpr ( std::is_same_v<Back_Pressure_Policy, Drop_Newest_On_Back_Pressure> ) {
+            if ( m_queue.push( begin, end ) != begin ) {
+                enable_transmit_ready_interrupt();
+            } // if
+        } else {
+            if ( static_cast<Size>( end - begin ) > N ) {
+                begin = end - N;
+            } // if
+
+            // the transmit ready interrupt service routine (the transmit queue's
+            // consumer) is masked while the oldest data is discarded
+            disable_transmit_ready_interrupt();
+
+            auto const available = N - m_queue.size();
+            for ( auto n = static_cast<Size>( end - begin ); n > available; --n ) {
+                static_cast<void>( m_queue.pop() );
+            } // for
+
+            static_cast<void>( m_queue.push( begin, end ) );
+
+            if ( not m_queue.empty() ) {
+                enable_transmit_ready_interrupt();
+            } // if
+        } // else
+    }
+};
+
+/**
+ * \brief Fault reporting asynchronous (interrupt driven) transmit stream I/O driver.
+ *
+ * Writes are queued in a transmit queue, and the transmit queue is drained from the
+ * device's transmit ready interrupt. A HIL specific derived class must implement
+ * microlibrary::Fault_Reporting_Async_Stream_IO_Driver::enable_transmit_ready_interrupt()
+ * and
+ * microlibrary::Fault_Reporting_Async_Stream_IO_Driver::disable_transmit_ready_interrupt(),
+ * and call microlibrary::Fault_Reporting_Async_Stream_IO_Driver::handle_transmit_ready()
+ * from the device's transmit ready interrupt service routine.
+ *
+ * If a write does not fit in the transmit queue, nothing is queued and
+ * microlibrary::Generic_Error::WOULD_OVERFLOW is reported.
+ *
+ * \tparam N The capacity of the transmit queue (must be a power of two).
+ */
+template<std::size_t N>
+class Fault_Reporting_Async_Stream_IO_Driver : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    /**
+     * \brief The transmit queue size type.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Get the capacity of the transmit queue.
+     *
+     * \return The capacity of the transmit queue.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of characters/data that are currently queued.
+     *
+     * \return The number of characters/data that are currently queued.
+     */
+    auto size() const noexcept -> Size
+    {
+        return m_queue.size();
+    }
+
+    /**
+     * \brief Queue a character for transmission.
+     *
+     * \param[in] character The character to queue for transmission.
+     *
+     * \return Nothing if queuing the character succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the transmit queue is full.
+     */
+    auto put( char character ) noexcept -> Result<void> override
+    {
+        auto const data = static_cast<std::uint8_t>( character );
+
+        return enqueue( &data, &data + 1 );
+    }
+
+    /**
+     * \brief Queue a block of characters for transmission.
+     *
+     * \param[in] begin The beginning of the block of characters to queue for
+     *            transmission.
+     * \param[in] end The end of the block of characters to queue for transmission.
+     *
+     * \return Nothing if queuing the block of characters succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the block of characters does
+     *         not fit in the transmit queue.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override
+    {
+        return enqueue(
+            reinterpret_cast<std::uint8_t const *>( begin ),
+            reinterpret_cast<std::uint8_t const *>( end ) );
+    }
+
+    /**
+     * \brief Queue a null-terminated string for transmission.
+     *
+     * \param[in] string The null-terminated string to queue for transmission.
+     *
+     * \return Nothing if queuing the null-terminated string succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the null-terminated string
+     *         does not fit in the transmit queue.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override
+    {
+        return put( string, string + std::strlen( string ) );
+    }
+
+    /**
+     * \brief Queue data for transmission.
+     *
+     * \param[in] data The data to queue for transmission.
+     *
+     * \return Nothing if queuing the data succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the transmit queue is full.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override
+    {
+        return enqueue( &data, &data + 1 );
+    }
+
+    /**
+     * \brief Queue a block of data for transmission.
+     *
+     * \param[in] begin The beginning of the block of data to queue for transmission.
+     * \param[in] end The end of the block of data to queue for transmission.
+     *
+     * \return Nothing if queuing the block of data succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the block of data does not
+     *         fit in the transmit queue.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override
+    {
+        return enqueue( begin, end );
+    }
+
+    /**
+     * \brief Queue a list of blocks of characters for transmission.
+     *
+     * Either all of the blocks are queued, or none of them are.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to queue for
+     *            transmission.
+     * \param[in] end The end of the list of blocks of characters to queue for
+     *            transmission.
+     *
+     * \return Nothing if queuing the list of blocks of characters succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the list of blocks of
+     *         characters does not fit in the transmit queue.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override
+    {
+        auto n = Size{ 0 };
+        for ( auto block = begin; block != end; ++block ) {
+            n += static_cast<Size>( block->end - block->begin );
+        } // for
+
+        // the consumer only ever increases the available space, so the check cannot be
+        // invalidated before the pushes
+        if ( n > N - m_queue.size() ) {
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        for ( ; begin != end; ++begin ) {
+            static_cast<void>( m_queue.push(
+                reinterpret_cast<std::uint8_t const *>( begin->begin ),
+                reinterpret_cast<std::uint8_t const *>( begin->end ) ) );
+        } // for
+
+        if ( n ) {
+            enable_transmit_ready_interrupt();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Block until the transmit queue has been drained.
+     *
+     * \return Nothing.
+     */
+    auto flush() noexcept -> Result<void> override
+    {
+        while ( not m_queue.empty() ) {} // while
+
+        return {};
+    }
+
+    /**
+     * \brief Transmit ready interrupt handler.
+     *
+     * \attention This function must only be called from the device's transmit ready
+     *            interrupt service routine.
+     *
+     * \return The data to transmit if the transmit queue is not empty.
+     * \return microlibrary::Generic_Error::WOULD_UNDERFLOW if the transmit queue is empty
+     *         (the transmit ready interrupt is disabled before the error is returned).
+     */
+    auto handle_transmit_ready() noexcept -> Result<std::uint8_t>
+    {
+        auto result = m_queue.pop();
+        if ( result.is_error() ) {
+            disable_transmit_ready_interrupt();
+        } // if
+
+        return result;
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fault_Reporting_Async_Stream_IO_Driver() noexcept = default;
+
+    Fault_Reporting_Async_Stream_IO_Driver( Fault_Reporting_Async_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_Async_Stream_IO_Driver( Fault_Reporting_Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_Async_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_Async_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Enable the device's transmit ready interrupt.
+     *
+     * \attention Enabling the transmit ready interrupt when it is already enabled must
+     *            have no effect.
+     */
+    virtual void enable_transmit_ready_interrupt() noexcept = 0;
+
+    /**
+     * \brief Disable the device's transmit ready interrupt.
+     */
+    virtual void disable_transmit_ready_interrupt() noexcept = 0;
+
+  private:
+    /**
+     * \brief The transmit queue.
+     */
+    Ring_Buffer<std::uint8_t, N> m_queue{};
+
+    /**
+     * \brief Queue a block of data for transmission.
+     *
+     * \param[in] begin The beginning of the block of data to queue for transmission.
+     * \param[in] end The end of the block of data to queue for transmission.
+     *
+     * \return Nothing if queuing the block of data succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the block of data does not
+     *         fit in the transmit queue.
+     */
+    auto enqueue( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void>
+    {
+        // the consumer only ever increases the available space, so the check cannot be
+        // invalidated before the push
+        if ( static_cast<Size>( end - begin ) > N - m_queue.size() ) {
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        if ( m_queue.push( begin, end ) != begin ) {
+            enable_transmit_ready_interrupt();
+        } // if
+
+        return {};
+    }
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_ASYNC_STREAM_IO_DRIVER_H
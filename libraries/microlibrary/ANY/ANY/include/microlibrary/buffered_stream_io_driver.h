@@ -0,0 +1,736 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Buffered_Stream_IO_Driver and
+ *        microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver interface.
+ */
+
+#ifndef MICROLIBRARY_BUFFERED_STREAM_IO_DRIVER_H
+#define MICROLIBRARY_BUFFERED_STREAM_IO_DRIVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "microlibrary/array.h"
+#include "microlibrary/result.h"
+#include "microlibrary/rom.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief Buffered stream I/O driver.
+ *
+ * Writes are coalesced into a fixed capacity write buffer. The contents of the write
+ * buffer are written to the wrapped stream I/O driver as a single block when a write does
+ * not fit in the remaining buffer space, when a write switches between characters and
+ * data, or when the driver is flushed. Blocks that are at least as large as the write
+ * buffer bypass the write buffer.
+ *
+ * \tparam N The capacity of the write buffer.
+ */
+template<std::size_t N>
+class Buffered_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The write buffer size type.
+     */
+    using Size = std::size_t;
+
+    Buffered_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write buffered data to.
+     */
+    constexpr Buffered_Stream_IO_Driver( Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    Buffered_Stream_IO_Driver( Buffered_Stream_IO_Driver && ) = delete;
+
+    Buffered_Stream_IO_Driver( Buffered_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Data that has been buffered but not flushed is discarded.
+     */
+    ~Buffered_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Buffered_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Buffered_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the capacity of the write buffer.
+     *
+     * \return The capacity of the write buffer.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of characters/data that are currently buffered.
+     *
+     * \return The number of characters/data that are currently buffered.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Write a character to the write buffer.
+     *
+     * \param[in] character The character to write to the write buffer.
+     */
+    void put( char character ) noexcept override final
+    {
+        prepare( Content::CHARACTERS, 1 );
+
+        m_buffer[ m_size ] = character;
+        ++m_size;
+    }
+
+    /**
+     * \brief Write a block of characters to the write buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the write
+     *            buffer.
+     * \param[in] end The end of the block of characters to write to the write buffer.
+     */
+    void put( char const * begin, char const * end ) noexcept override final
+    {
+        put_block( Content::CHARACTERS, begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the write buffer.
+     *
+     * \param[in] string The null-terminated string to write to the write buffer.
+     */
+    void put( char const * string ) noexcept override final
+    {
+        put_block( Content::CHARACTERS, string, string + std::strlen( string ) );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the write buffer.
+     *
+     * \param[in] string The null-terminated ROM string to write to the write buffer.
+     */
+    void put( ROM::String string ) noexcept override final
+    {
+        while ( auto const character = *string++ ) {
+            prepare( Content::CHARACTERS, 1 );
+
+            m_buffer[ m_size ] = character;
+            ++m_size;
+        } // while
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the write buffer.
+     *
+     * \param[in] data The data to write to the write buffer.
+     */
+    void put( std::uint8_t data ) noexcept override final
+    {
+        prepare( Content::DATA, 1 );
+
+        m_buffer[ m_size ] = static_cast<char>( data );
+        ++m_size;
+    }
+
+    /**
+     * \brief Write a block of data to the write buffer.
+     *
+     * \param[in] begin The beginning of the block of data to write to the write buffer.
+     * \param[in] end The end of the block of data to write to the write buffer.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final
+    {
+        put_block(
+            Content::DATA,
+            reinterpret_cast<char const *>( begin ),
+            reinterpret_cast<char const *>( end ) );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the write buffer.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            write buffer.
+     * \param[in] end The end of the list of blocks of characters to write to the write
+     *            buffer.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final
+    {
+        for ( ; begin != end; ++begin ) {
+            put_block( Content::CHARACTERS, begin->begin, begin->end );
+        } // for
+    }
+
+    /**
+     * \brief Write any data that has been buffered to the wrapped stream I/O driver, and
+     *        flush the wrapped stream I/O driver.
+     */
+    void flush() noexcept override final
+    {
+        drain();
+
+        m_driver->flush();
+    }
+
+    /**
+     * \brief Reserve space for a block of characters in the write buffer.
+     *
+     * If the write buffer does not have space for n characters, or contains data, the
+     * contents of the write buffer are written to the wrapped stream I/O driver first.
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if n does not exceed the capacity of
+     *         the write buffer.
+     * \return nullptr if n exceeds the capacity of the write buffer.
+     */
+    auto reserve( Size n ) noexcept -> char * override final
+    {
+        if ( n > N ) {
+            return nullptr;
+        } // if
+
+        prepare( Content::CHARACTERS, n );
+
+        return m_buffer.begin() + m_size;
+    }
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Buffered_Stream_IO_Driver::reserve().
+     *
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     */
+    void commit( Size n ) noexcept override final
+    {
+        m_size += n;
+    }
+
+  private:
+    /**
+     * \brief Write buffer content type.
+     */
+    enum class Content : std::uint_fast8_t {
+        CHARACTERS, ///< Characters.
+        DATA,       ///< Data.
+    };
+
+    /**
+     * \brief The stream I/O driver to write buffered data to.
+     */
+    Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The write buffer.
+     */
+    Array<char, N> m_buffer{};
+
+    /**
+     * \brief The number of characters/data that are currently buffered.
+     */
+    Size m_size{ 0 };
+
+    /**
+     * \brief The type of the buffered content.
+     */
+    Content m_content{ Content::CHARACTERS };
+
+    /**
+     * \brief Write the contents of the write buffer to the wrapped stream I/O driver.
+     */
+    void drain() noexcept
+    {
+        if ( m_size ) {
+            forward( m_content, m_buffer.begin(), m_buffer.begin() + m_size );
+
+            m_size = 0;
+        } // if
+    }
+
+    /**
+     * \brief Write a block directly to the wrapped stream I/O driver.
+     *
+     * \param[in] content The type of the block's content.
+     * \param[in] begin The beginning of the block to write.
+     * \param[in] end The end of the block to write.
+     */
+    void forward( Content content, char const * begin, char const * end ) noexcept
+    {
+        if ( content == Content::CHARACTERS ) {
+            m_driver->put( begin, end );
+        } else {
+            m_driver->put(
+                reinterpret_cast<std::uint8_t const *>( begin ),
+                reinterpret_cast<std::uint8_t const *>( end ) );
+        } // else
+    }
+
+    /**
+     * \brief Prepare the write buffer for a write.
+     *
+     * \param[in] content The type of the content to be written.
+     * \param[in] n The number of characters/data to be written.
+     */
+    void prepare( Content content, Size n ) noexcept
+    {
+        if ( content != m_content or n > N - m_size ) {
+            drain();
+
+            m_content = content;
+        } // if
+    }
+
+    /**
+     * \brief Write a block to the write buffer.
+     *
+     * \param[in] content The type of the block's content.
+     * \param[in] begin The beginning of the block to write.
+     * \param[in] end The end of the block to write.
+     */
+    void put_block( Content content, char const * begin, char const * end ) noexcept
+    {
+        auto const n = static_cast<Size>( end - begin );
+
+        prepare( content, n );
+
+        if ( n >= N ) {
+            forward( content, begin, end );
+
+            return;
+        } // if
+
+        std::memcpy( m_buffer.begin() + m_size, begin, n );
+        m_size += n;
+    }
+};
+
+/**
+ * \brief Fault reporting buffered stream I/O driver.
+ *
+ * Writes are coalesced into a fixed capacity write buffer. The contents of the write
+ * buffer are written to the wrapped stream I/O driver as a single block when a write does
+ * not fit in the remaining buffer space, when a write switches between characters and
+ * data, or when the driver is flushed. Blocks that are at least as large as the write
+ * buffer bypass the write buffer.
+ *
+ * \attention If writing the contents of the write buffer to the wrapped stream I/O driver
+ *            fails, the contents of the write buffer are discarded.
+ *
+ * \tparam N The capacity of the write buffer.
+ */
+template<std::size_t N>
+class Fault_Reporting_Buffered_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The write buffer size type.
+     */
+    using Size = std::size_t;
+
+    Fault_Reporting_Buffered_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write buffered data to.
+     */
+    constexpr Fault_Reporting_Buffered_Stream_IO_Driver( Fault_Reporting_Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    Fault_Reporting_Buffered_Stream_IO_Driver( Fault_Reporting_Buffered_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_Buffered_Stream_IO_Driver( Fault_Reporting_Buffered_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Data that has been buffered but not flushed is discarded.
+     */
+    ~Fault_Reporting_Buffered_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_Buffered_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_Buffered_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the capacity of the write buffer.
+     *
+     * \return The capacity of the write buffer.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of characters/data that are currently buffered.
+     *
+     * \return The number of characters/data that are currently buffered.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Write a character to the write buffer.
+     *
+     * \param[in] character The character to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        auto result = prepare( Content::CHARACTERS, 1 );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        m_buffer[ m_size ] = character;
+        ++m_size;
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of characters to the write buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the write
+     *            buffer.
+     * \param[in] end The end of the block of characters to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return put_block( Content::CHARACTERS, begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the write buffer.
+     *
+     * \param[in] string The null-terminated string to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        return put_block( Content::CHARACTERS, string, string + std::strlen( string ) );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the write buffer.
+     *
+     * \param[in] string The null-terminated ROM string to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final
+    {
+        while ( auto const character = *string++ ) {
+            auto result = put( character );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // while
+
+        return {};
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the write buffer.
+     *
+     * \param[in] data The data to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final
+    {
+        auto result = prepare( Content::DATA, 1 );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        m_buffer[ m_size ] = static_cast<char>( data );
+        ++m_size;
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of data to the write buffer.
+     *
+     * \param[in] begin The beginning of the block of data to write to the write buffer.
+     * \param[in] end The end of the block of data to write to the write buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final
+    {
+        return put_block(
+            Content::DATA,
+            reinterpret_cast<char const *>( begin ),
+            reinterpret_cast<char const *>( end ) );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the write buffer.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            write buffer.
+     * \param[in] end The end of the list of blocks of characters to write to the write
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final
+    {
+        for ( ; begin != end; ++begin ) {
+            auto result = put_block( Content::CHARACTERS, begin->begin, begin->end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return {};
+    }
+
+    /**
+     * \brief Write any data that has been buffered to the wrapped stream I/O driver, and
+     *        flush the wrapped stream I/O driver.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        auto result = drain();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return m_driver->flush();
+    }
+
+    /**
+     * \brief Reserve space for a block of characters in the write buffer.
+     *
+     * If the write buffer does not have space for n characters, or contains data, the
+     * contents of the write buffer are written to the wrapped stream I/O driver first.
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if n does not exceed the capacity of
+     *         the write buffer.
+     * \return nullptr if n exceeds the capacity of the write buffer.
+     * \return An error code if writing the contents of the write buffer to the wrapped
+     *         stream I/O driver failed.
+     */
+    auto reserve( Size n ) noexcept -> Result<char *> override final
+    {
+        if ( n > N ) {
+            return static_cast<char *>( nullptr );
+        } // if
+
+        auto result = prepare( Content::CHARACTERS, n );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return m_buffer.begin() + m_size;
+    }
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::reserve().
+     *
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     *
+     * \return Nothing.
+     */
+    auto commit( Size n ) noexcept -> Result<void> override final
+    {
+        m_size += n;
+
+        return {};
+    }
+
+  private:
+    /**
+     * \brief Write buffer content type.
+     */
+    enum class Content : std::uint_fast8_t {
+        CHARACTERS, ///< Characters.
+        DATA,       ///< Data.
+    };
+
+    /**
+     * \brief The stream I/O driver to write buffered data to.
+     */
+    Fault_Reporting_Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The write buffer.
+     */
+    Array<char, N> m_buffer{};
+
+    /**
+     * \brief The number of characters/data that are currently buffered.
+     */
+    Size m_size{ 0 };
+
+    /**
+     * \brief The type of the buffered content.
+     */
+    Content m_content{ Content::CHARACTERS };
+
+    /**
+     * \brief Write the contents of the write buffer to the wrapped stream I/O driver.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto drain() noexcept -> Result<void>
+    {
+        if ( not m_size ) {
+            return {};
+        } // if
+
+        auto const size = m_size;
+
+        m_size = 0;
+
+        return forward( m_content, m_buffer.begin(), m_buffer.begin() + size );
+    }
+
+    /**
+     * \brief Write a block directly to the wrapped stream I/O driver.
+     *
+     * \param[in] content The type of the block's content.
+     * \param[in] begin The beginning of the block to write.
+     * \param[in] end The end of the block to write.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto forward( Content content, char const * begin, char const * end ) noexcept -> Result<void>
+    {
+        if ( content == Content::CHARACTERS ) {
+            return m_driver->put( begin, end );
+        } // if
+
+        return m_driver->put(
+            reinterpret_cast<std::uint8_t const *>( begin ),
+            reinterpret_cast<std::uint8_t const *>( end ) );
+    }
+
+    /**
+     * \brief Prepare the write buffer for a write.
+     *
+     * \param[in] content The type of the content to be written.
+     * \param[in] n The number of characters/data to be written.
+     *
+     * \return Nothing if preparing the write buffer succeeded.
+     * \return An error code if preparing the write buffer failed.
+     */
+    auto prepare( Content content, Size n ) noexcept -> Result<void>
+    {
+        if ( content != m_content or n > N - m_size ) {
+            auto result = drain();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            m_content = content;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block to the write buffer.
+     *
+     * \param[in] content The type of the block's content.
+     * \param[in] begin The beginning of the block to write.
+     * \param[in] end The end of the block to write.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put_block( Content content, char const * begin, char const * end ) noexcept -> Result<void>
+    {
+        auto const n = static_cast<Size>( end - begin );
+
+        auto result = prepare( content, n );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        if ( n >= N ) {
+            return forward( content, begin, end );
+        } // if
+
+        std::memcpy( m_buffer.begin() + m_size, begin, n );
+        m_size += n;
+
+        return {};
+    }
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_BUFFERED_STREAM_IO_DRIVER_H
@@ -0,0 +1,361 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Channel_Stream_IO_Driver and
+ *        microlibrary::Fault_Reporting_Channel_Stream_IO_Driver interface.
+ */
+
+#ifndef MICROLIBRARY_CHANNEL_STREAM_IO_DRIVER_H
+#define MICROLIBRARY_CHANNEL_STREAM_IO_DRIVER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "microlibrary/result.h"
+#include "microlibrary/rom.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief Channel stream I/O driver.
+ *
+ * Allows multiple logical streams to share a single physical link. Each write is written
+ * to the wrapped stream I/O driver as one or more frames. A frame consists of a header
+ * (the channel ID followed by the payload size) followed by the payload. Payloads are
+ * between 1 and microlibrary::Channel_Stream_IO_Driver::MAX_PAYLOAD_SIZE characters/data
+ * long. Larger writes are split across multiple frames, and empty writes are discarded.
+ *
+ * \attention Frame headers are written as data, and payloads are written as characters or
+ *            data depending on the type of the write.
+ * \attention Writing a single character or datum produces a frame. Wrapping a channel
+ *            stream I/O driver in a microlibrary::Buffered_Stream_IO_Driver amortizes the
+ *            frame header overhead.
+ */
+class Channel_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    /**
+     * \brief Channel ID.
+     */
+    using Channel = std::uint8_t;
+
+    /**
+     * \brief The maximum frame payload size.
+     */
+    static constexpr auto MAX_PAYLOAD_SIZE = std::size_t{ 255 };
+
+    Channel_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver for the shared physical link.
+     * \param[in] channel The channel ID to tag frames with.
+     */
+    constexpr Channel_Stream_IO_Driver( Stream_IO_Driver & driver, Channel channel ) noexcept :
+        m_driver{ &driver },
+        m_channel{ channel }
+    {
+    }
+
+    Channel_Stream_IO_Driver( Channel_Stream_IO_Driver && ) = delete;
+
+    Channel_Stream_IO_Driver( Channel_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Channel_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Channel_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Channel_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the channel ID frames are tagged with.
+     *
+     * \return The channel ID frames are tagged with.
+     */
+    constexpr auto channel() const noexcept -> Channel
+    {
+        return m_channel;
+    }
+
+    /**
+     * \brief Write a character to the link.
+     *
+     * \param[in] character The character to write to the link.
+     */
+    void put( char character ) noexcept override final;
+
+    /**
+     * \brief Write a block of characters to the link.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the link.
+     * \param[in] end The end of the block of characters to write to the link.
+     */
+    void put( char const * begin, char const * end ) noexcept override final;
+
+    /**
+     * \brief Write a null-terminated string to the link.
+     *
+     * \param[in] string The null-terminated string to write to the link.
+     */
+    void put( char const * string ) noexcept override final;
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the link.
+     *
+     * \param[in] string The null-terminated ROM string to write to the link.
+     */
+    void put( ROM::String string ) noexcept override final;
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the link.
+     *
+     * \param[in] data The data to write to the link.
+     */
+    void put( std::uint8_t data ) noexcept override final;
+
+    /**
+     * \brief Write a block of data to the link.
+     *
+     * \param[in] begin The beginning of the block of data to write to the link.
+     * \param[in] end The end of the block of data to write to the link.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final;
+
+    /**
+     * \brief Write a list of blocks of characters to the link.
+     *
+     * Each block of characters is written as one or more frames.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            link.
+     * \param[in] end The end of the list of blocks of characters to write to the link.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final;
+
+    /**
+     * \brief Flush the link.
+     */
+    void flush() noexcept override final;
+
+  private:
+    /**
+     * \brief The stream I/O driver for the shared physical link.
+     */
+    Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The channel ID to tag frames with.
+     */
+    Channel m_channel;
+
+    /**
+     * \brief Write a frame header to the link.
+     *
+     * \param[in] size The frame's payload size.
+     */
+    void put_header( std::size_t size ) noexcept;
+};
+
+/**
+ * \brief Fault reporting channel stream I/O driver.
+ *
+ * Allows multiple logical streams to share a single physical link. Each write is written
+ * to the wrapped stream I/O driver as one or more frames. A frame consists of a header
+ * (the channel ID followed by the payload size) followed by the payload. Payloads are
+ * between 1 and
+ * microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::MAX_PAYLOAD_SIZE
+ * characters/data long. Larger writes are split across multiple frames, and empty writes
+ * are discarded.
+ *
+ * \attention Frame headers are written as data, and payloads are written as characters or
+ *            data depending on the type of the write.
+ * \attention Writing a single character or datum produces a frame. Wrapping a channel
+ *            stream I/O driver in a microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver
+ *            amortizes the frame header overhead.
+ * \attention If writing a frame fails, the link may be left with a partial frame.
+ */
+class Fault_Reporting_Channel_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    /**
+     * \brief Channel ID.
+     */
+    using Channel = std::uint8_t;
+
+    /**
+     * \brief The maximum frame payload size.
+     */
+    static constexpr auto MAX_PAYLOAD_SIZE = std::size_t{ 255 };
+
+    Fault_Reporting_Channel_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver for the shared physical link.
+     * \param[in] channel The channel ID to tag frames with.
+     */
+    constexpr Fault_Reporting_Channel_Stream_IO_Driver( Fault_Reporting_Stream_IO_Driver & driver, Channel channel ) noexcept :
+        m_driver{ &driver },
+        m_channel{ channel }
+    {
+    }
+
+    Fault_Reporting_Channel_Stream_IO_Driver( Fault_Reporting_Channel_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_Channel_Stream_IO_Driver( Fault_Reporting_Channel_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_Channel_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_Channel_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_Channel_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the channel ID frames are tagged with.
+     *
+     * \return The channel ID frames are tagged with.
+     */
+    constexpr auto channel() const noexcept -> Channel
+    {
+        return m_channel;
+    }
+
+    /**
+     * \brief Write a character to the link.
+     *
+     * \param[in] character The character to write to the link.
+     *
+     * \return Nothing if writing the character to the link succeeded.
+     * \return An error code if writing the character to the link failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Write a block of characters to the link.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the link.
+     * \param[in] end The end of the block of characters to write to the link.
+     *
+     * \return Nothing if writing the block of characters to the link succeeded.
+     * \return An error code if writing the block of characters to the link failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Write a null-terminated string to the link.
+     *
+     * \param[in] string The null-terminated string to write to the link.
+     *
+     * \return Nothing if writing the null-terminated string to the link succeeded.
+     * \return An error code if writing the null-terminated string to the link failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final;
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the link.
+     *
+     * \param[in] string The null-terminated ROM string to write to the link.
+     *
+     * \return Nothing if writing the null-terminated ROM string to the link succeeded.
+     * \return An error code if writing the null-terminated ROM string to the link failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final;
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the link.
+     *
+     * \param[in] data The data to write to the link.
+     *
+     * \return Nothing if writing the data to the link succeeded.
+     * \return An error code if writing the data to the link failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Write a block of data to the link.
+     *
+     * \param[in] begin The beginning of the block of data to write to the link.
+     * \param[in] end The end of the block of data to write to the link.
+     *
+     * \return Nothing if writing the block of data to the link succeeded.
+     * \return An error code if writing the block of data to the link failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief Write a list of blocks of characters to the link.
+     *
+     * Each block of characters is written as one or more frames.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            link.
+     * \param[in] end The end of the list of blocks of characters to write to the link.
+     *
+     * \return Nothing if writing the list of blocks of characters to the link succeeded.
+     * \return An error code if writing the list of blocks of characters to the link
+     *         failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief Flush the link.
+     *
+     * \return Nothing if flushing the link succeeded.
+     * \return An error code if flushing the link failed.
+     */
+    auto flush() noexcept -> Result<void> override final;
+
+  private:
+    /**
+     * \brief The stream I/O driver for the shared physical link.
+     */
+    Fault_Reporting_Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The channel ID to tag frames with.
+     */
+    Channel m_channel;
+
+    /**
+     * \brief Write a frame header to the link.
+     *
+     * \param[in] size The frame's payload size.
+     *
+     * \return Nothing if writing the frame header to the link succeeded.
+     * \return An error code if writing the frame header to the link failed.
+     */
+    auto put_header( std::size_t size ) noexcept -> Result<void>;
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_CHANNEL_STREAM_IO_DRIVER_H
@@ -0,0 +1,609 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Consistent Overhead Byte Stuffing (COBS) framing interface.
+ */
+
+#ifndef MICROLIBRARY_COBS_H
+#define MICROLIBRARY_COBS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "microlibrary/array.h"
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief COBS frame delimiter.
+ */
+constexpr auto COBS_FRAME_DELIMITER = std::uint8_t{ 0x00 };
+
+/**
+ * \brief The maximum number of non-delimiter bytes in a COBS block.
+ */
+constexpr auto COBS_MAX_BLOCK_SIZE = std::size_t{ 254 };
+
+/**
+ * \brief Consistent Overhead Byte Stuffing (COBS) framing stream I/O driver.
+ *
+ * Characters/data written to the driver are COBS encoded and written to the wrapped
+ * stream I/O driver. The end of a frame is marked by calling
+ * microlibrary::COBS_Stream_IO_Driver::end_frame(), or by flushing the driver.
+ *
+ * Encoding is single-pass. Only the current COBS block (at most
+ * microlibrary::COBS_MAX_BLOCK_SIZE bytes) is buffered, and each COBS block is written to
+ * the wrapped stream I/O driver as a single block.
+ */
+class COBS_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    COBS_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write encoded frames to.
+     */
+    constexpr COBS_Stream_IO_Driver( Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    COBS_Stream_IO_Driver( COBS_Stream_IO_Driver && ) = delete;
+
+    COBS_Stream_IO_Driver( COBS_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention A frame that has not been ended is discarded.
+     */
+    ~COBS_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( COBS_Stream_IO_Driver && ) = delete;
+
+    auto operator=( COBS_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if a frame is in progress (characters/data have been written since
+     *        the end of the previous frame).
+     *
+     * \return true if a frame is in progress.
+     * \return false if a frame is not in progress.
+     */
+    constexpr auto frame_in_progress() const noexcept -> bool
+    {
+        return m_frame_in_progress;
+    }
+
+    /**
+     * \brief Encode a character.
+     *
+     * \param[in] character The character to encode.
+     */
+    void put( char character ) noexcept override final;
+
+    /**
+     * \brief Encode a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to encode.
+     * \param[in] end The end of the block of characters to encode.
+     */
+    void put( char const * begin, char const * end ) noexcept override final;
+
+    /**
+     * \brief Encode a null-terminated string.
+     *
+     * \param[in] string The null-terminated string to encode.
+     */
+    void put( char const * string ) noexcept override final;
+
+    /**
+     * \brief Encode data.
+     *
+     * \param[in] data The data to encode.
+     */
+    void put( std::uint8_t data ) noexcept override final;
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final;
+
+    /**
+     * \brief Encode a list of blocks of characters.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to encode.
+     * \param[in] end The end of the list of blocks of characters to encode.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final;
+
+    /**
+     * \brief End the frame that is in progress (if any), and flush the wrapped stream I/O
+     *        driver.
+     */
+    void flush() noexcept override final;
+
+    /**
+     * \brief End the current frame.
+     *
+     * If a frame is not in progress, an empty frame is written.
+     */
+    void end_frame() noexcept;
+
+  private:
+    /**
+     * \brief The stream I/O driver to write encoded frames to.
+     */
+    Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The current COBS block (code byte, up to microlibrary::COBS_MAX_BLOCK_SIZE
+     *        non-delimiter bytes, and space for a frame delimiter).
+     */
+    Array<std::uint8_t, 1 + COBS_MAX_BLOCK_SIZE + 1> m_block{};
+
+    /**
+     * \brief The number of non-delimiter bytes in the current COBS block.
+     */
+    std::uint_fast8_t m_size{ 0 };
+
+    /**
+     * \brief The frame in progress flag.
+     */
+    bool m_frame_in_progress{ false };
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     */
+    void encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept;
+
+    /**
+     * \brief Write the current COBS block to the wrapped stream I/O driver.
+     *
+     * \param[in] delimiter The number of frame delimiters (0 or 1) to write after the
+     *            block.
+     */
+    void write_block( std::uint_fast8_t delimiter = 0 ) noexcept;
+};
+
+/**
+ * \brief Fault reporting Consistent Overhead Byte Stuffing (COBS) framing stream I/O
+ *        driver.
+ *
+ * Characters/data written to the driver are COBS encoded and written to the wrapped
+ * stream I/O driver. The end of a frame is marked by calling
+ * microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::end_frame(), or by flushing the
+ * driver.
+ *
+ * Encoding is single-pass. Only the current COBS block (at most
+ * microlibrary::COBS_MAX_BLOCK_SIZE bytes) is buffered, and each COBS block is written to
+ * the wrapped stream I/O driver as a single block.
+ *
+ * \attention If writing a COBS block to the wrapped stream I/O driver fails, the COBS
+ *            block is discarded, and the frame that is in progress will be corrupt. The
+ *            frame should be ended so that the receiver can resynchronize.
+ */
+class Fault_Reporting_COBS_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    Fault_Reporting_COBS_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write encoded frames to.
+     */
+    constexpr Fault_Reporting_COBS_Stream_IO_Driver( Fault_Reporting_Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    Fault_Reporting_COBS_Stream_IO_Driver( Fault_Reporting_COBS_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_COBS_Stream_IO_Driver( Fault_Reporting_COBS_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention A frame that has not been ended is discarded.
+     */
+    ~Fault_Reporting_COBS_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_COBS_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_COBS_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if a frame is in progress (characters/data have been written since
+     *        the end of the previous frame).
+     *
+     * \return true if a frame is in progress.
+     * \return false if a frame is not in progress.
+     */
+    constexpr auto frame_in_progress() const noexcept -> bool
+    {
+        return m_frame_in_progress;
+    }
+
+    /**
+     * \brief Encode a character.
+     *
+     * \param[in] character The character to encode.
+     *
+     * \return Nothing if encoding the character succeeded.
+     * \return An error code if encoding the character failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to encode.
+     * \param[in] end The end of the block of characters to encode.
+     *
+     * \return Nothing if encoding the block of characters succeeded.
+     * \return An error code if encoding the block of characters failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a null-terminated string.
+     *
+     * \param[in] string The null-terminated string to encode.
+     *
+     * \return Nothing if encoding the null-terminated string succeeded.
+     * \return An error code if encoding the null-terminated string failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode data.
+     *
+     * \param[in] data The data to encode.
+     *
+     * \return Nothing if encoding the data succeeded.
+     * \return An error code if encoding the data failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     *
+     * \return Nothing if encoding the block of data succeeded.
+     * \return An error code if encoding the block of data failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief Encode a list of blocks of characters.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to encode.
+     * \param[in] end The end of the list of blocks of characters to encode.
+     *
+     * \return Nothing if encoding the list of blocks of characters succeeded.
+     * \return An error code if encoding the list of blocks of characters failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief End the frame that is in progress (if any), and flush the wrapped stream I/O
+     *        driver.
+     *
+     * \return Nothing if flushing the driver succeeded.
+     * \return An error code if flushing the driver failed.
+     */
+    auto flush() noexcept -> Result<void> override final;
+
+    /**
+     * \brief End the current frame.
+     *
+     * If a frame is not in progress, an empty frame is written.
+     *
+     * \return Nothing if ending the current frame succeeded.
+     * \return An error code if ending the current frame failed.
+     */
+    auto end_frame() noexcept -> Result<void>;
+
+  private:
+    /**
+     * \brief The stream I/O driver to write encoded frames to.
+     */
+    Fault_Reporting_Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The current COBS block (code byte, up to microlibrary::COBS_MAX_BLOCK_SIZE
+     *        non-delimiter bytes, and space for a frame delimiter).
+     */
+    Array<std::uint8_t, 1 + COBS_MAX_BLOCK_SIZE + 1> m_block{};
+
+    /**
+     * \brief The number of non-delimiter bytes in the current COBS block.
+     */
+    std::uint_fast8_t m_size{ 0 };
+
+    /**
+     * \brief The frame in progress flag.
+     */
+    bool m_frame_in_progress{ false };
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     *
+     * \return Nothing if encoding the block of data succeeded.
+     * \return An error code if encoding the block of data failed.
+     */
+    auto encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void>;
+
+    /**
+     * \brief Write the current COBS block to the wrapped stream I/O driver.
+     *
+     * \param[in] delimiter The number of frame delimiters (0 or 1) to write after the
+     *            block.
+     *
+     * \return Nothing if writing the COBS block succeeded.
+     * \return An error code if writing the COBS block failed.
+     */
+    auto write_block( std::uint_fast8_t delimiter = 0 ) noexcept -> Result<void>;
+};
+
+/**
+ * \brief Streaming Consistent Overhead Byte Stuffing (COBS) decoder.
+ *
+ * Encoded data is decoded one byte at a time as it is received (e.g. in chunks read using
+ * microlibrary::Stream_IO_Driver::get()), and the decoded frame is accumulated in a fixed
+ * capacity frame buffer.
+ *
+ * Frame delimiters that are not preceded by encoded data (e.g. delimiters used to
+ * resynchronize a link) are ignored. If an error is detected, the remainder of the frame
+ * is discarded and decoding resumes with the next frame.
+ *
+ * \tparam N The capacity of the frame buffer.
+ */
+template<std::size_t N>
+class COBS_Decoder {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The frame buffer size type.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr COBS_Decoder() noexcept = default;
+
+    COBS_Decoder( COBS_Decoder && ) = delete;
+
+    COBS_Decoder( COBS_Decoder const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~COBS_Decoder() noexcept = default;
+
+    auto operator=( COBS_Decoder && ) = delete;
+
+    auto operator=( COBS_Decoder const & ) = delete;
+
+    /**
+     * \brief Get the capacity of the frame buffer.
+     *
+     * \return The capacity of the frame buffer.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the beginning of the decoded frame.
+     *
+     * \return The beginning of the decoded frame.
+     */
+    constexpr auto begin() const noexcept -> std::uint8_t const *
+    {
+        return m_frame.begin();
+    }
+
+    /**
+     * \brief Get the end of the decoded frame.
+     *
+     * \return The end of the decoded frame.
+     */
+    constexpr auto end() const noexcept -> std::uint8_t const *
+    {
+        return m_frame.begin() + m_size;
+    }
+
+    /**
+     * \brief Get the size of the decoded frame.
+     *
+     * \return The size of the decoded frame.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Decode a byte.
+     *
+     * \attention The decoded frame is only complete after this function reports that a
+     *            frame has been decoded, and is only valid until this function is called
+     *            again.
+     *
+     * \param[in] byte The byte to decode.
+     *
+     * \return true if a frame has been decoded.
+     * \return false if a frame has not been decoded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the frame being decoded does
+     *         not fit in the frame buffer.
+     * \return microlibrary::Generic_Error::RUNTIME_ERROR if the frame being decoded is
+     *         malformed (truncated).
+     */
+    auto decode( std::uint8_t byte ) noexcept -> Result<bool>
+    {
+        if ( m_frame_complete ) {
+            m_frame_complete = false;
+            m_size           = 0;
+        } // if
+
+        if ( byte == COBS_FRAME_DELIMITER ) {
+            auto const state     = m_state;
+            auto const remaining = m_remaining;
+
+            m_state        = State::IDLE;
+            m_remaining    = 0;
+            m_zero_pending = false;
+
+            switch ( state ) {
+                case State::IDLE: return false;
+                case State::DISCARDING: m_size = 0; return false;
+                case State::DECODING: break;
+            } // switch
+
+            if ( remaining ) {
+                m_size = 0;
+
+                return Generic_Error::RUNTIME_ERROR;
+            } // if
+
+            m_frame_complete = true;
+
+            return true;
+        } // if
+
+        switch ( m_state ) {
+            case State::IDLE: m_state = State::DECODING; break;
+            case State::DISCARDING: return false;
+            case State::DECODING: break;
+        } // switch
+
+        if ( m_remaining ) {
+            --m_remaining;
+
+            auto result = append( byte );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return false;
+        } // if
+
+        if ( m_zero_pending ) {
+            auto result = append( 0 );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        } // if
+
+        m_remaining    = static_cast<std::uint8_t>( byte - 1 );
+        m_zero_pending = byte != COBS_MAX_BLOCK_SIZE + 1;
+
+        return false;
+    }
+
+  private:
+    /**
+     * \brief Decoder state.
+     */
+    enum class State : std::uint_fast8_t {
+        IDLE,       ///< Idle (waiting for the first byte of a frame).
+        DECODING,   ///< Decoding a frame.
+        DISCARDING, ///< Discarding the remainder of a frame after an error.
+    };
+
+    /**
+     * \brief The frame buffer.
+     */
+    Array<std::uint8_t, N> m_frame{};
+
+    /**
+     * \brief The size of the decoded frame.
+     */
+    Size m_size{ 0 };
+
+    /**
+     * \brief The decoder state.
+     */
+    State m_state{ State::IDLE };
+
+    /**
+     * \brief The number of bytes remaining in the current COBS block.
+     */
+    std::uint8_t m_remaining{ 0 };
+
+    /**
+     * \brief The zero pending flag (the current COBS block is followed by a zero unless
+     *        it is the last COBS block in the frame).
+     */
+    bool m_zero_pending{ false };
+
+    /**
+     * \brief The frame complete flag.
+     */
+    bool m_frame_complete{ false };
+
+    /**
+     * \brief Append a decoded byte to the frame buffer.
+     *
+     * \param[in] byte The decoded byte to append to the frame buffer.
+     *
+     * \return Nothing if the decoded byte was appended to the frame buffer.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the frame buffer is full.
+     */
+    auto append( std::uint8_t byte ) noexcept -> Result<void>
+    {
+        if ( m_size == N ) {
+            m_state        = State::DISCARDING;
+            m_remaining    = 0;
+            m_zero_pending = false;
+
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        m_frame[ m_size ] = byte;
+        ++m_size;
+
+        return {};
+    }
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_COBS_H
@@ -0,0 +1,971 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Cyclic Redundancy Check (CRC) interface.
+ */
+
+#ifndef MICROLIBRARY_CRC_H
+#define MICROLIBRARY_CRC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "microlibrary/algorithm.h"
+#include "microlibrary/array.h"
+#include "microlibrary/integer.h"
+#include "microlibrary/result.h"
+#include "microlibrary/rom.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief CRC calculation kernel.
+ */
+enum class CRC_Kernel : std::uint_fast8_t {
+    BITWISE,      ///< Bitwise (no lookup table, smallest and slowest).
+    NIBBLE_TABLE, ///< 16 entry lookup table (processes 4 bits per step).
+    BYTE_TABLE,   ///< 256 entry lookup table (processes 8 bits per step, largest and fastest).
+};
+
+/**
+ * \brief Cyclic Redundancy Check (CRC) engine.
+ *
+ * The engine is parameterized using the Rocksoft(TM) model CRC algorithm parameters
+ * (width, polynomial, initial value, input reflection, output reflection, and output XOR
+ * value). Lookup tables used by the table driven kernels are generated at compile time
+ * and stored in ROM if the HIL supports it.
+ *
+ * \tparam WIDTH The width of the CRC in bits (must be between 3 and 64 inclusive).
+ * \tparam POLYNOMIAL The CRC polynomial (unreflected, without the implicit high order
+ *         bit).
+ * \tparam INIT The initial value of the CRC register (unreflected).
+ * \tparam REFLECT_IN true if input bytes are processed least significant bit first.
+ * \tparam REFLECT_OUT true if the CRC register is reflected before the output XOR value is
+ *         applied.
+ * \tparam XOR_OUT The value that is XORed with the CRC register to produce the CRC.
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<std::uint_fast8_t WIDTH, std::uint64_t POLYNOMIAL, std::uint64_t INIT, bool REFLECT_IN, bool REFLECT_OUT, std::uint64_t XOR_OUT, CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+class CRC {
+  public:
+    static_assert( WIDTH >= 3 and WIDTH <= 64 );
+
+    /**
+     * \brief The CRC value type.
+     */
+    using Value = std::conditional_t<
+        WIDTH <= 8,
+        std::uint8_t,
+        std::conditional_t<WIDTH <= 16, std::uint16_t, std::conditional_t<WIDTH <= 32, std::uint32_t, std::uint64_t>>>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr CRC() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr CRC( CRC && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr CRC( CRC const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~CRC() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( CRC && expression ) noexcept -> CRC & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( CRC const & expression ) noexcept -> CRC & = default;
+
+    /**
+     * \brief Calculate the CRC of a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to calculate the CRC of.
+     * \param[in] end The end of the block of data to calculate the CRC of.
+     *
+     * \return The CRC of the block of data.
+     */
+    static constexpr auto calculate( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Value
+    {
+        auto crc = CRC{};
+
+        crc.update( begin, end );
+
+        return crc.value();
+    }
+
+    /**
+     * \brief Calculate the CRC of a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to calculate the CRC of.
+     * \param[in] end The end of the block of characters to calculate the CRC of.
+     *
+     * \return The CRC of the block of characters.
+     */
+    static constexpr auto calculate( char const * begin, char const * end ) noexcept -> Value
+    {
+        auto crc = CRC{};
+
+        crc.update( begin, end );
+
+        return crc.value();
+    }
+
+    /**
+     * \brief Reset the CRC register to its initial value.
+     */
+    constexpr void reset() noexcept
+    {
+        m_register = INITIAL_REGISTER;
+    }
+
+    /**
+     * \brief Update the CRC register with a byte.
+     *
+     * \param[in] byte The byte to update the CRC register with.
+     */
+    constexpr void update( std::uint8_t byte ) noexcept
+    {
+        if constexpr ( KERNEL == CRC_Kernel::BITWISE ) {
+            m_register = process<8>( REFLECT_IN ? m_register ^ byte : m_register ^ ( Register{ byte } << ( REGISTER_WIDTH - 8 ) ) );
+        } else if constexpr ( KERNEL == CRC_Kernel::NIBBLE_TABLE ) {
+            if constexpr ( REFLECT_IN ) {
+                m_register = static_cast<Register>(
+                    ( m_register >> 4 ) ^ lookup( NIBBLE_TABLE, ( m_register ^ byte ) & 0xF ) );
+                m_register = static_cast<Register>(
+                    ( m_register >> 4 ) ^ lookup( NIBBLE_TABLE, ( m_register ^ ( byte >> 4 ) ) & 0xF ) );
+            } else {
+                m_register = static_cast<Register>(
+                    ( m_register << 4 )
+                    ^ lookup( NIBBLE_TABLE, ( ( m_register >> ( REGISTER_WIDTH - 4 ) ) ^ ( byte >> 4 ) ) & 0xF ) );
+                m_register = static_cast<Register>(
+                    ( m_register << 4 )
+                    ^ lookup( NIBBLE_TABLE, ( ( m_register >> ( REGISTER_WIDTH - 4 ) ) ^ byte ) & 0xF ) );
+            } // else
+        } else {
+            if constexpr ( REFLECT_IN ) {
+                m_register = static_cast<Register>(
+                    shift_right_byte( m_register ) ^ lookup( BYTE_TABLE, ( m_register ^ byte ) & 0xFF ) );
+            } else {
+                m_register = static_cast<Register>(
+                    shift_left_byte( m_register )
+                    ^ lookup( BYTE_TABLE, ( ( m_register >> ( REGISTER_WIDTH - 8 ) ) ^ byte ) & 0xFF ) );
+            } // else
+        }     // else
+    }
+
+    /**
+     * \brief Update the CRC register with a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to update the CRC register
+     *            with.
+     * \param[in] end The end of the block of data to update the CRC register with.
+     */
+    constexpr void update( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    {
+        for ( ; begin != end; ++begin ) { update( *begin ); } // for
+    }
+
+    /**
+     * \brief Update the CRC register with a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to update the CRC
+     *            register with.
+     * \param[in] end The end of the block of characters to update the CRC register with.
+     */
+    constexpr void update( char const * begin, char const * end ) noexcept
+    {
+        for ( ; begin != end; ++begin ) { update( static_cast<std::uint8_t>( *begin ) ); } // for
+    }
+
+    /**
+     * \brief Get the CRC of the data the CRC register has been updated with since it was
+     *        last reset.
+     *
+     * \return The CRC of the data the CRC register has been updated with since it was
+     *         last reset.
+     */
+    constexpr auto value() const noexcept -> Value
+    {
+        auto crc = Value{};
+
+        if constexpr ( REFLECT_IN ) {
+            crc = REFLECT_OUT ? m_register : reflect_width( m_register );
+        } else {
+            crc = static_cast<Value>( m_register >> ( REGISTER_WIDTH - WIDTH ) );
+            crc = REFLECT_OUT ? reflect_width( crc ) : crc;
+        } // else
+
+        return static_cast<Value>( ( crc ^ XOR_OUT ) & MASK );
+    }
+
+  private:
+    /**
+     * \brief The CRC register type.
+     */
+    using Register = Value;
+
+    /**
+     * \brief The width of the CRC register in bits.
+     */
+    static constexpr auto REGISTER_WIDTH = std::uint_fast8_t{ std::numeric_limits<Register>::digits };
+
+    /**
+     * \brief The CRC mask.
+     */
+    static constexpr auto MASK = mask<Register>( WIDTH, 0 );
+
+    /**
+     * \brief Reflect the low order WIDTH bits of a value.
+     *
+     * \param[in] value The value to reflect.
+     *
+     * \return The reflected value.
+     */
+    static constexpr auto reflect_width( Register value ) noexcept -> Register
+    {
+        return static_cast<Register>( reflect( value ) >> ( REGISTER_WIDTH - WIDTH ) );
+    }
+
+    /**
+     * \brief The polynomial in the CRC register's representation (reflected and right
+     *        aligned if input bytes are processed least significant bit first, left
+     *        aligned otherwise).
+     */
+    static constexpr auto REGISTER_POLYNOMIAL = REFLECT_IN
+        ? reflect_width( static_cast<Register>( POLYNOMIAL & MASK ) )
+        : static_cast<Register>( static_cast<Register>( POLYNOMIAL & MASK ) << ( REGISTER_WIDTH - WIDTH ) );
+
+    /**
+     * \brief The initial value of the CRC register in the CRC register's representation.
+     */
+    static constexpr auto INITIAL_REGISTER = REFLECT_IN
+        ? reflect_width( static_cast<Register>( INIT & MASK ) )
+        : static_cast<Register>( static_cast<Register>( INIT & MASK ) << ( REGISTER_WIDTH - WIDTH ) );
+
+    /**
+     * \brief Shift the CRC register right by one byte.
+     *
+     * \param[in] value The CRC register value to shift.
+     *
+     * \return The shifted CRC register value.
+     */
+    static constexpr auto shift_right_byte( Register value ) noexcept -> Register
+    {
+        if constexpr ( REGISTER_WIDTH == 8 ) {
+            static_cast<void>( value );
+
+            return 0;
+        } else {
+            return static_cast<Register>( value >> 8 );
+        } // else
+    }
+
+    /**
+     * \brief Shift the CRC register left by one byte.
+     *
+     * \param[in] value The CRC register value to shift.
+     *
+     * \return The shifted CRC register value.
+     */
+    static constexpr auto shift_left_byte( Register value ) noexcept -> Register
+    {
+        if constexpr ( REGISTER_WIDTH == 8 ) {
+            static_cast<void>( value );
+
+            return 0;
+        } else {
+            return static_cast<Register>( value << 8 );
+        } // else
+    }
+
+    /**
+     * \brief Process bits that have been XORed into the CRC register one bit at a time.
+     *
+     * \tparam BITS The number of bits to process.
+     *
+     * \param[in] value The CRC register value to process.
+     *
+     * \return The processed CRC register value.
+     */
+    template<std::uint_fast8_t BITS>
+    static constexpr auto process( Register value ) noexcept -> Register
+    {
+        for ( auto bit = std::uint_fast8_t{ 0 }; bit < BITS; ++bit ) {
+            if constexpr ( REFLECT_IN ) {
+                value = static_cast<Register>(
+                    value & 0b1 ? ( value >> 1 ) ^ REGISTER_POLYNOMIAL : value >> 1 );
+            } else {
+                value = static_cast<Register>(
+                    value >> ( REGISTER_WIDTH - 1 ) ? ( value << 1 ) ^ REGISTER_POLYNOMIAL
+                                                    : value << 1 );
+            } // else
+        }     // for
+
+        return value;
+    }
+
+    /**
+     * \brief Generate a lookup table.
+     *
+     * \tparam BITS The number of bits processed per lookup table step.
+     *
+     * \return The generated lookup table.
+     */
+    template<std::uint_fast8_t BITS>
+    static constexpr auto generate_table() noexcept -> Array<Register, std::size_t{ 1 } << BITS>
+    {
+        auto table = Array<Register, std::size_t{ 1 } << BITS>{};
+
+        for ( auto i = std::size_t{ 0 }; i < table.size(); ++i ) {
+            table[ i ] = process<BITS>(
+                REFLECT_IN ? static_cast<Register>( i )
+                           : static_cast<Register>( Register( i ) << ( REGISTER_WIDTH - BITS ) ) );
+        } // for
+
+        return table;
+    }
+
+    /**
+     * \brief The 16 entry lookup table (stored in ROM if the HIL supports it).
+     */
+    static constexpr auto NIBBLE_TABLE MICROLIBRARY_ROM_STORAGE = generate_table<4>();
+
+    /**
+     * \brief The 256 entry lookup table (stored in ROM if the HIL supports it).
+     */
+    static constexpr auto BYTE_TABLE MICROLIBRARY_ROM_STORAGE = generate_table<8>();
+
+    /**
+     * \brief Look up a lookup table entry.
+     *
+     * If the lookup table is stored in ROM, the entry is read from ROM one byte at a
+     * time (unless constant evaluated).
+     *
+     * \tparam N The number of lookup table entries.
+     *
+     * \param[in] table The lookup table.
+     * \param[in] position The position of the entry to look up.
+     *
+     * \return The lookup table entry.
+     */
+    template<std::size_t N>
+    static constexpr auto lookup( Array<Register, N> const & table, std::size_t position ) noexcept
+        -> Register
+    {
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+        if ( not Implementation::is_constant_evaluated() ) {
+            auto const entry = ROM::String{ reinterpret_cast<char const *>( table.data() + position ) };
+
+            auto value = Register{};
+            auto bytes = reinterpret_cast<unsigned char *>( &value );
+            for ( auto byte = std::size_t{ 0 }; byte < sizeof( Register ); ++byte ) {
+                bytes[ byte ] = static_cast<unsigned char>( entry[ byte ] );
+            } // for
+
+            return value;
+        } // if
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+        return table[ position ];
+    }
+
+    /**
+     * \brief The CRC register.
+     */
+    Register m_register{ INITIAL_REGISTER };
+};
+
+/**
+ * \brief CRC-8/SMBUS engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_8_SMBUS = CRC<8, 0x07, 0x00, false, false, 0x00, KERNEL>;
+
+/**
+ * \brief CRC-16/IBM-3740 (CRC-16/CCITT-FALSE) engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_16_IBM_3740 = CRC<16, 0x1021, 0xFFFF, false, false, 0x0000, KERNEL>;
+
+/**
+ * \brief CRC-16/KERMIT engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_16_KERMIT = CRC<16, 0x1021, 0x0000, true, true, 0x0000, KERNEL>;
+
+/**
+ * \brief CRC-16/MODBUS engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_16_MODBUS = CRC<16, 0x8005, 0xFFFF, true, true, 0x0000, KERNEL>;
+
+/**
+ * \brief CRC-16/XMODEM engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_16_XMODEM = CRC<16, 0x1021, 0x0000, false, false, 0x0000, KERNEL>;
+
+/**
+ * \brief CRC-32/ISO-HDLC (Ethernet, zlib) engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_32_ISO_HDLC = CRC<32, 0x04C1'1DB7, 0xFFFF'FFFF, true, true, 0xFFFF'FFFF, KERNEL>;
+
+/**
+ * \brief CRC-32/ISCSI (CRC-32C) engine.
+ *
+ * \tparam KERNEL The CRC calculation kernel.
+ */
+template<CRC_Kernel KERNEL = CRC_Kernel::BITWISE>
+using CRC_32_ISCSI = CRC<32, 0x1EDC'6F41, 0xFFFF'FFFF, true, true, 0xFFFF'FFFF, KERNEL>;
+
+/**
+ * \brief CRC stream I/O driver.
+ *
+ * Writes are forwarded, unchanged, to the wrapped stream I/O driver, and reads are
+ * forwarded, unchanged, from the wrapped stream I/O driver. The CRC engine is updated
+ * with the characters/data that pass through the driver in both directions.
+ *
+ * \tparam CRC_Engine The CRC engine type (e.g. microlibrary::CRC_16_IBM_3740<>).
+ */
+template<typename CRC_Engine>
+class CRC_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    CRC_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to forward writes and reads to.
+     */
+    constexpr CRC_Stream_IO_Driver( Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    CRC_Stream_IO_Driver( CRC_Stream_IO_Driver && ) = delete;
+
+    CRC_Stream_IO_Driver( CRC_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~CRC_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( CRC_Stream_IO_Driver && ) = delete;
+
+    auto operator=( CRC_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the CRC engine.
+     *
+     * \return The CRC engine.
+     */
+    constexpr auto crc() noexcept -> CRC_Engine &
+    {
+        return m_crc;
+    }
+
+    /**
+     * \brief Get the CRC engine.
+     *
+     * \return The CRC engine.
+     */
+    constexpr auto crc() const noexcept -> CRC_Engine const &
+    {
+        return m_crc;
+    }
+
+    /**
+     * \brief Write a character to the wrapped stream I/O driver.
+     *
+     * \param[in] character The character to write to the wrapped stream I/O driver.
+     */
+    void put( char character ) noexcept override final
+    {
+        m_crc.update( static_cast<std::uint8_t>( character ) );
+
+        m_driver->put( character );
+    }
+
+    /**
+     * \brief Write a block of characters to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the wrapped
+     *            stream I/O driver.
+     * \param[in] end The end of the block of characters to write to the wrapped stream
+     *            I/O driver.
+     */
+    void put( char const * begin, char const * end ) noexcept override final
+    {
+        m_crc.update( begin, end );
+
+        m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the wrapped stream I/O driver.
+     *
+     * \param[in] string The null-terminated string to write to the wrapped stream I/O
+     *            driver.
+     */
+    void put( char const * string ) noexcept override final
+    {
+        for ( auto character = string; *character; ++character ) {
+            m_crc.update( static_cast<std::uint8_t>( *character ) );
+        } // for
+
+        m_driver->put( string );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the wrapped stream I/O driver.
+     *
+     * \param[in] string The null-terminated ROM string to write to the wrapped stream I/O
+     *            driver.
+     */
+    void put( ROM::String string ) noexcept override final
+    {
+        for ( auto character = string; auto const c = *character; ++character ) {
+            m_crc.update( static_cast<std::uint8_t>( c ) );
+        } // for
+
+        m_driver->put( string );
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the wrapped stream I/O driver.
+     *
+     * \param[in] data The data to write to the wrapped stream I/O driver.
+     */
+    void put( std::uint8_t data ) noexcept override final
+    {
+        m_crc.update( data );
+
+        m_driver->put( data );
+    }
+
+    /**
+     * \brief Write a block of data to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block of data to write to the wrapped stream
+     *            I/O driver.
+     * \param[in] end The end of the block of data to write to the wrapped stream I/O
+     *            driver.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final
+    {
+        m_crc.update( begin, end );
+
+        m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            wrapped stream I/O driver.
+     * \param[in] end The end of the list of blocks of characters to write to the wrapped
+     *            stream I/O driver.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final
+    {
+        for ( auto block = begin; block != end; ++block ) {
+            m_crc.update( block->begin, block->end );
+        } // for
+
+        m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Flush the wrapped stream I/O driver.
+     */
+    void flush() noexcept override final
+    {
+        m_driver->flush();
+    }
+
+    /**
+     * \brief Get the number of characters/data that can be read from the wrapped stream
+     *        I/O driver without blocking.
+     *
+     * \return The number of characters/data that can be read from the wrapped stream I/O
+     *         driver without blocking.
+     */
+    auto available() noexcept -> std::size_t override final
+    {
+        return m_driver->available();
+    }
+
+    /**
+     * \brief Read a block of characters from the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the block of characters that were read.
+     */
+    auto get( char * begin, char * end ) noexcept -> char * override final
+    {
+        auto const read_end = m_driver->get( begin, end );
+
+        m_crc.update( begin, read_end );
+
+        return read_end;
+    }
+
+    /**
+     * \brief Read a block of data from the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the block of data that was read.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t * override final
+    {
+        auto const read_end = m_driver->get( begin, end );
+
+        m_crc.update( begin, read_end );
+
+        return read_end;
+    }
+
+  private:
+    /**
+     * \brief The stream I/O driver to forward writes and reads to.
+     */
+    Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The CRC engine.
+     */
+    CRC_Engine m_crc{};
+};
+
+/**
+ * \brief Fault reporting CRC stream I/O driver.
+ *
+ * Writes are forwarded, unchanged, to the wrapped stream I/O driver, and reads are
+ * forwarded, unchanged, from the wrapped stream I/O driver. The CRC engine is updated
+ * with the characters/data that pass through the driver in both directions.
+ *
+ * \attention The CRC engine is updated before a write is forwarded, and is updated even
+ *            if the write fails. The CRC engine is not updated if a read fails.
+ *
+ * \tparam CRC_Engine The CRC engine type (e.g. microlibrary::CRC_16_IBM_3740<>).
+ */
+template<typename CRC_Engine>
+class Fault_Reporting_CRC_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    Fault_Reporting_CRC_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to forward writes and reads to.
+     */
+    constexpr Fault_Reporting_CRC_Stream_IO_Driver( Fault_Reporting_Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    Fault_Reporting_CRC_Stream_IO_Driver( Fault_Reporting_CRC_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_CRC_Stream_IO_Driver( Fault_Reporting_CRC_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_CRC_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_CRC_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_CRC_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the CRC engine.
+     *
+     * \return The CRC engine.
+     */
+    constexpr auto crc() noexcept -> CRC_Engine &
+    {
+        return m_crc;
+    }
+
+    /**
+     * \brief Get the CRC engine.
+     *
+     * \return The CRC engine.
+     */
+    constexpr auto crc() const noexcept -> CRC_Engine const &
+    {
+        return m_crc;
+    }
+
+    /**
+     * \brief Write a character to the wrapped stream I/O driver.
+     *
+     * \param[in] character The character to write to the wrapped stream I/O driver.
+     *
+     * \return Nothing if writing the character succeeded.
+     * \return An error code if writing the character failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        m_crc.update( static_cast<std::uint8_t>( character ) );
+
+        return m_driver->put( character );
+    }
+
+    /**
+     * \brief Write a block of characters to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the wrapped
+     *            stream I/O driver.
+     * \param[in] end The end of the block of characters to write to the wrapped stream
+     *            I/O driver.
+     *
+     * \return Nothing if writing the block of characters succeeded.
+     * \return An error code if writing the block of characters failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        m_crc.update( begin, end );
+
+        return m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the wrapped stream I/O driver.
+     *
+     * \param[in] string The null-terminated string to write to the wrapped stream I/O
+     *            driver.
+     *
+     * \return Nothing if writing the null-terminated string succeeded.
+     * \return An error code if writing the null-terminated string failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        for ( auto character = string; *character; ++character ) {
+            m_crc.update( static_cast<std::uint8_t>( *character ) );
+        } // for
+
+        return m_driver->put( string );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the wrapped stream I/O driver.
+     *
+     * \param[in] string The null-terminated ROM string to write to the wrapped stream I/O
+     *            driver.
+     *
+     * \return Nothing if writing the null-terminated ROM string succeeded.
+     * \return An error code if writing the null-terminated ROM string failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final
+    {
+        for ( auto character = string; auto const c = *character; ++character ) {
+            m_crc.update( static_cast<std::uint8_t>( c ) );
+        } // for
+
+        return m_driver->put( string );
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the wrapped stream I/O driver.
+     *
+     * \param[in] data The data to write to the wrapped stream I/O driver.
+     *
+     * \return Nothing if writing the data succeeded.
+     * \return An error code if writing the data failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final
+    {
+        m_crc.update( data );
+
+        return m_driver->put( data );
+    }
+
+    /**
+     * \brief Write a block of data to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block of data to write to the wrapped stream
+     *            I/O driver.
+     * \param[in] end The end of the block of data to write to the wrapped stream I/O
+     *            driver.
+     *
+     * \return Nothing if writing the block of data succeeded.
+     * \return An error code if writing the block of data failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final
+    {
+        m_crc.update( begin, end );
+
+        return m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            wrapped stream I/O driver.
+     * \param[in] end The end of the list of blocks of characters to write to the wrapped
+     *            stream I/O driver.
+     *
+     * \return Nothing if writing the list of blocks of characters succeeded.
+     * \return An error code if writing the list of blocks of characters failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final
+    {
+        for ( auto block = begin; block != end; ++block ) {
+            m_crc.update( block->begin, block->end );
+        } // for
+
+        return m_driver->put( begin, end );
+    }
+
+    /**
+     * \brief Flush the wrapped stream I/O driver.
+     *
+     * \return Nothing if flushing the wrapped stream I/O driver succeeded.
+     * \return An error code if flushing the wrapped stream I/O driver failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        return m_driver->flush();
+    }
+
+    /**
+     * \brief Get the number of characters/data that can be read from the wrapped stream
+     *        I/O driver without blocking.
+     *
+     * \return The number of characters/data that can be read from the wrapped stream I/O
+     *         driver without blocking if getting the number succeeded.
+     * \return An error code if getting the number failed.
+     */
+    auto available() noexcept -> Result<std::size_t> override final
+    {
+        return m_driver->available();
+    }
+
+    /**
+     * \brief Read a block of characters from the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the block of characters that were read if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto get( char * begin, char * end ) noexcept -> Result<char *> override final
+    {
+        auto result = m_driver->get( begin, end );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        m_crc.update( begin, result.value() );
+
+        return result;
+    }
+
+    /**
+     * \brief Read a block of data from the wrapped stream I/O driver.
+     *
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the block of data that was read if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+        -> Result<std::uint8_t *> override final
+    {
+        auto result = m_driver->get( begin, end );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        m_crc.update( begin, result.value() );
+
+        return result;
+    }
+
+  private:
+    /**
+     * \brief The stream I/O driver to forward writes and reads to.
+     */
+    Fault_Reporting_Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The CRC engine.
+     */
+    CRC_Engine m_crc{};
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_CRC_H
@@ -332,6 +332,8 @@ enum class Generic_Error : Error_ID {
     OUT_OF_RANGE,       ///< Out of range.
     RUNTIME_ERROR,      ///< Runtime error.
     IO_STREAM_DEGRADED, ///< I/O stream degraded.
+    WOULD_OVERFLOW,     ///< Would overflow.
+    WOULD_UNDERFLOW,    ///< Would underflow.
 };
 
 /**
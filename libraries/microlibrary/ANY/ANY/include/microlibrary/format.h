@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -34,6 +35,7 @@
 #include "microlibrary/array.h"
 #include "microlibrary/integer.h"
 #include "microlibrary/result.h"
+#include "microlibrary/rom.h"
 #include "microlibrary/stream.h"
 
 /**
@@ -41,12 +43,88 @@
  */
 namespace microlibrary::Format {
 
+/**
+ * \brief Get the decimal digit pair lookup table.
+ *
+ * The lookup table contains the two digit decimal representations of 0 through 99
+ * ("00", "01", ..., "99") concatenated together. The two digit decimal representation of
+ * n begins at offset 2 * n.
+ *
+ * \return The decimal digit pair lookup table.
+ */
+auto decimal_digit_pairs() noexcept -> ROM::String;
+
+/**
+ * \brief Get the hexadecimal digit pair lookup table.
+ *
+ * The lookup table contains the two digit hexadecimal representations of 0x00 through
+ * 0xFF ("00", "01", ..., "FF") concatenated together. The two digit hexadecimal
+ * representation of n begins at offset 2 * n.
+ *
+ * \return The hexadecimal digit pair lookup table.
+ */
+auto hexadecimal_digit_pairs() noexcept -> ROM::String;
+
+/**
+ * \brief Get the binary nibble lookup table.
+ *
+ * The lookup table contains the four digit binary representations of 0x0 through 0xF
+ * ("0000", "0001", ..., "1111") concatenated together. The four digit binary
+ * representation of n begins at offset 4 * n.
+ *
+ * \return The binary nibble lookup table.
+ */
+auto binary_nibbles() noexcept -> ROM::String;
+
+/**
+ * \brief Increment a string of decimal digits.
+ *
+ * \param[in] begin The beginning of the string of decimal digits.
+ * \param[in] end The end of the string of decimal digits.
+ *
+ * \return true if the increment carried out of the most significant digit (all digits
+ *         are '0').
+ * \return false if the increment did not carry out of the most significant digit.
+ */
+auto increment_decimal_digits( char * begin, char * end ) noexcept -> bool;
+
+/**
+ * \brief Integer output formatting kernel.
+ */
+enum class Kernel : std::uint_fast8_t {
+    COMPACT,      ///< Shift and mask loop, one digit per step (no lookup table).
+    LOOKUP_TABLE, ///< Lookup table, one byte per step (requires a ROM lookup table).
+};
+
+/**
+ * \brief Formatted value alignment within its field.
+ */
+enum class Alignment : std::uint_fast8_t {
+    LEFT,     ///< Fill characters follow the formatted value.
+    RIGHT,    ///< Fill characters precede the formatted value.
+    INTERNAL, ///< Fill characters are placed between the sign or prefix and the digits.
+};
+
+/**
+ * \brief Integer sign output policy.
+ */
+enum class Sign : std::uint_fast8_t {
+    NEGATIVE, ///< Only negative integers have a sign ('-').
+    ALWAYS,   ///< Negative integers have a '-' sign, other integers have a '+' sign.
+    SPACE,    ///< Negative integers have a '-' sign, other integers have a ' ' sign.
+};
+
 /**
  * \brief Integer binary output format specifier.
  *
  * \tparam Integer The type of integer to format.
+ * \tparam KERNEL The formatting kernel to use.
+ * \tparam WIDTH The minimum field width (0 if the formatted integer should not be padded).
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam PREFIX Include the "0b" prefix.
  */
-template<typename Integer>
+template<typename Integer, Kernel KERNEL = Kernel::COMPACT, std::uint_fast8_t WIDTH = 0, char FILL = ' ', Alignment ALIGNMENT = Alignment::RIGHT, bool PREFIX = true>
 class Bin {
   public:
     static_assert( std::is_integral_v<Integer> );
@@ -120,8 +198,12 @@ class Bin {
  * \brief Integer decimal output format specifier.
  *
  * \tparam Integer The type of integer to format.
+ * \tparam WIDTH The minimum field width (0 if the formatted integer should not be padded).
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam SIGN The sign output policy.
  */
-template<typename Integer>
+template<typename Integer, std::uint_fast8_t WIDTH = 0, char FILL = ' ', Alignment ALIGNMENT = Alignment::RIGHT, Sign SIGN = Sign::NEGATIVE>
 class Dec {
   public:
     static_assert( std::is_integral_v<Integer> );
@@ -191,12 +273,177 @@ class Dec {
     Integer m_integer;
 };
 
+/**
+ * \brief Fixed-point decimal output format specifier.
+ *
+ * The fixed-point value is represented by an integer that holds the value scaled by
+ * 2^FRACTION_BITS (e.g. Q8.8 values are represented by a std::int16_t with 8 fraction
+ * bits).
+ *
+ * \tparam Integer The fixed-point value's underlying integer type.
+ * \tparam FRACTION_BITS The number of fraction bits in the fixed-point value.
+ * \tparam PRECISION The number of fraction digits to format (defaults to the number of
+ *         digits required to distinguish adjacent fixed-point values).
+ */
+template<typename Integer, std::uint_fast8_t FRACTION_BITS, std::uint_fast8_t PRECISION = ( FRACTION_BITS * 3 + 9 ) / 10>
+class Fixed {
+  public:
+    static_assert( std::is_integral_v<Integer> );
+    static_assert( FRACTION_BITS <= std::numeric_limits<std::make_unsigned_t<Integer>>::digits );
+
+    Fixed() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] integer The fixed-point value to be formatted.
+     */
+    constexpr Fixed( Integer integer ) noexcept : m_integer{ integer }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fixed( Fixed && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fixed( Fixed const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed && expression ) noexcept -> Fixed & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed const & expression ) noexcept -> Fixed & = default;
+
+    /**
+     * \brief Get the fixed-point value to be formatted.
+     *
+     * \return The fixed-point value to be formatted.
+     */
+    constexpr operator Integer() const noexcept
+    {
+        return m_integer;
+    }
+
+  private:
+    /**
+     * \brief The fixed-point value to be formatted.
+     */
+    Integer m_integer;
+};
+
+/**
+ * \brief Floating-point fixed precision decimal output format specifier.
+ *
+ * \tparam Floating_Point The type of floating-point value to format (must be an IEC 559
+ *         single or double precision type).
+ * \tparam PRECISION The number of fraction digits to format.
+ */
+template<typename Floating_Point, std::uint_fast8_t PRECISION = 6>
+class Float {
+  public:
+    static_assert( std::is_floating_point_v<Floating_Point> );
+
+    Float() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] value The floating-point value to be formatted.
+     */
+    constexpr Float( Floating_Point value ) noexcept : m_value{ value }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Float( Float && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Float( Float const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Float() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Float && expression ) noexcept -> Float & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Float const & expression ) noexcept -> Float & = default;
+
+    /**
+     * \brief Get the floating-point value to be formatted.
+     *
+     * \return The floating-point value to be formatted.
+     */
+    constexpr operator Floating_Point() const noexcept
+    {
+        return m_value;
+    }
+
+  private:
+    /**
+     * \brief The floating-point value to be formatted.
+     */
+    Floating_Point m_value;
+};
+
 /**
  * \brief Integer hexadecimal output format specifier.
  *
  * \tparam Integer The type of integer to format.
+ * \tparam KERNEL The formatting kernel to use.
+ * \tparam WIDTH The minimum field width (0 if the formatted integer should not be padded).
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam PREFIX Include the "0x" prefix.
  */
-template<typename Integer>
+template<typename Integer, Kernel KERNEL = Kernel::COMPACT, std::uint_fast8_t WIDTH = 0, char FILL = ' ', Alignment ALIGNMENT = Alignment::RIGHT, bool PREFIX = true>
 class Hex {
   public:
     static_assert( std::is_integral_v<Integer> );
@@ -269,13 +516,32 @@ class Hex {
 /**
  * \brief Hex dump output format specifier.
  *
+ * Each row of a hex dump contains the row's address, the hex representation of the row's
+ * data, and (optionally) the ASCII representation of the row's data (non-printable
+ * characters are replaced with '.').
+ *
  * \tparam Address Data address. Must be an unsigned integer type.
  * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam ROW_BYTES The number of bytes in a row.
+ * \tparam GROUP_BYTES The number of bytes in a group (groups are separated by an
+ *         additional space).
+ * \tparam ASCII_COLUMN Include the ASCII representation of each row's data.
+ * \tparam ADDRESS_NIBBLES The number of (least significant) address nibbles to include in
+ *         each row (0 to omit the address).
  */
-template<typename Address, typename Iterator>
+template<
+    typename Address,
+    typename Iterator,
+    std::uint_fast8_t ROW_BYTES       = 16,
+    std::uint_fast8_t GROUP_BYTES     = ROW_BYTES,
+    bool              ASCII_COLUMN    = true,
+    std::uint_fast8_t ADDRESS_NIBBLES = std::numeric_limits<Address>::digits / 4>
 class Hex_Dump {
   public:
     static_assert( std::is_unsigned_v<Address> );
+    static_assert( ROW_BYTES > 0 );
+    static_assert( GROUP_BYTES > 0 );
+    static_assert( ADDRESS_NIBBLES <= std::numeric_limits<Address>::digits / 4 );
 
     Hex_Dump() = delete;
 
@@ -385,9 +651,14 @@ namespace microlibrary {
  * \brief microlibrary::Format::Bin output formatter.
  *
  * \tparam Integer The type of integer to format.
+ * \tparam KERNEL The formatting kernel to use.
+ * \tparam WIDTH The minimum field width.
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam PREFIX Include the "0b" prefix.
  */
-template<typename Integer>
-class Output_Formatter<Format::Bin<Integer>> {
+template<typename Integer, Format::Kernel KERNEL, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, bool PREFIX>
+class Output_Formatter<Format::Bin<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>> {
   public:
     /**
      * \brief Constructor.
@@ -442,7 +713,17 @@ class Output_Formatter<Format::Bin<Integer>> {
      */
     auto print( Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
     {
-        auto const formatted_integer = format( integer );
+        if ( auto const location = stream.reserve( SIZE ) ) {
+            format( integer, location );
+
+            stream.commit( SIZE );
+
+            return SIZE;
+        } // if
+
+        Formatted_Integer formatted_integer;
+
+        format( integer, formatted_integer.begin() );
 
         stream.put( formatted_integer.begin(), formatted_integer.end() );
 
@@ -461,7 +742,25 @@ class Output_Formatter<Format::Bin<Integer>> {
     auto print( Fault_Reporting_Output_Stream & stream, Integer integer ) const noexcept
         -> Result<std::size_t>
     {
-        auto const formatted_integer = format( integer );
+        auto reservation = stream.reserve( SIZE );
+        if ( reservation.is_error() ) {
+            return reservation.error();
+        } // if
+
+        if ( auto const location = reservation.value() ) {
+            format( integer, location );
+
+            auto result = stream.commit( SIZE );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return SIZE;
+        } // if
+
+        Formatted_Integer formatted_integer;
+
+        format( integer, formatted_integer.begin() );
 
         auto result = stream.put( formatted_integer.begin(), formatted_integer.end() );
         if ( result.is_error() ) {
@@ -477,33 +776,105 @@ class Output_Formatter<Format::Bin<Integer>> {
      */
     static constexpr auto DIGITS = std::numeric_limits<std::make_unsigned_t<Integer>>::digits;
 
+    /**
+     * \brief The number of bits in a byte.
+     */
+    static constexpr auto BYTE_DIGITS = std::numeric_limits<std::uint8_t>::digits;
+
+    /**
+     * \brief Byte bit mask.
+     */
+    static constexpr auto BYTE_MASK = mask<std::uint_fast8_t>( BYTE_DIGITS, 0 );
+
+    /**
+     * \brief The number of bits in a nibble.
+     */
+    static constexpr auto NIBBLE_DIGITS = std::uint_fast8_t{ 4 };
+
+    /**
+     * \brief Nibble bit mask.
+     */
+    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+
+    /**
+     * \brief The size of a formatted integer without padding.
+     */
+    static constexpr auto CONTENT_SIZE = std::size_t{ ( PREFIX ? 2 : 0 ) + DIGITS };
+
+    /**
+     * \brief The size of a formatted integer.
+     */
+    static constexpr auto SIZE = CONTENT_SIZE < WIDTH ? std::size_t{ WIDTH } : CONTENT_SIZE;
+
+    /**
+     * \brief The number of fill characters in a formatted integer.
+     */
+    static constexpr auto PADDING = SIZE - CONTENT_SIZE;
+
     /**
      * \brief Formatted integer.
      */
-    using Formatted_Integer = Array<char, 2 + DIGITS>;
+    using Formatted_Integer = Array<char, SIZE>;
 
     /**
      * \brief Format an integer.
      *
      * \param[in] integer The integer to format.
-     *
-     * \return The formatted integer.
+     * \param[out] location The location to write the formatted integer to (must have
+     *             space for the entire formatted integer).
      */
-    static constexpr auto format( Integer integer ) noexcept -> Formatted_Integer
+    static void format( Integer integer, char * location ) noexcept
     {
         auto unsigned_integer = to_unsigned( integer );
 
-        Formatted_Integer formatted_integer;
+        auto begin = location;
+        auto end   = location + SIZE;
 
-        auto i = formatted_integer.rbegin();
-        for ( auto bit = 0; bit < DIGITS; ++bit, ++i, unsigned_integer >>= 1 ) {
-            *i = '0' + ( unsigned_integer & 0b1 );
-        } // for
-        *i = 'b';
-        ++i;
-        *i = '0';
+        if constexpr ( ALIGNMENT == Format::Alignment::LEFT ) {
+            end -= PADDING;
+
+            fill( end, end + PADDING, FILL );
+        } else if constexpr ( ALIGNMENT == Format::Alignment::RIGHT ) {
+            fill( begin, begin + PADDING, FILL );
+
+            begin += PADDING;
+        } // else if
+
+        if constexpr ( PREFIX ) {
+            begin[ 0 ] = '0';
+            begin[ 1 ] = 'b';
+
+            begin += 2;
+        } // if
+
+        if constexpr ( ALIGNMENT == Format::Alignment::INTERNAL ) {
+            fill( begin, begin + PADDING, FILL );
 
-        return formatted_integer;
+            begin += PADDING;
+        } // if
+
+        if constexpr ( KERNEL == Format::Kernel::LOOKUP_TABLE ) {
+            auto const nibbles = Format::binary_nibbles();
+
+            for ( auto i = end; i != begin; unsigned_integer >>= BYTE_DIGITS ) {
+                i -= BYTE_DIGITS;
+
+                auto const byte = static_cast<std::uint_fast8_t>( unsigned_integer & BYTE_MASK );
+                auto const high = ( byte >> NIBBLE_DIGITS ) * NIBBLE_DIGITS;
+                auto const low  = ( byte & NIBBLE_MASK ) * NIBBLE_DIGITS;
+
+                for ( auto digit = std::uint_fast8_t{ 0 }; digit < NIBBLE_DIGITS; ++digit ) {
+                    i[ digit ]                 = nibbles[ high + digit ];
+                    i[ NIBBLE_DIGITS + digit ] = nibbles[ low + digit ];
+                } // for
+            }     // for
+        } else {
+            for ( auto i = end; i != begin; unsigned_integer >>= 1 ) {
+                --i;
+
+                *i = '0' + ( unsigned_integer & 0b1 );
+            } // for
+        }     // else
     }
 };
 
@@ -511,9 +882,13 @@ class Output_Formatter<Format::Bin<Integer>> {
  * \brief microlibrary::Format::Dec output formatter.
  *
  * \tparam Integer The type of integer to format.
+ * \tparam WIDTH The minimum field width.
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam SIGN The sign output policy.
  */
-template<typename Integer>
-class Output_Formatter<Format::Dec<Integer>> {
+template<typename Integer, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, Format::Sign SIGN>
+class Output_Formatter<Format::Dec<Integer, WIDTH, FILL, ALIGNMENT, SIGN>> {
   public:
     /**
      * \brief Constructor.
@@ -568,13 +943,24 @@ class Output_Formatter<Format::Dec<Integer>> {
      */
     auto print( Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
     {
+        auto const content_size = size( integer );
+        auto const n            = padded_size( content_size );
+
+        if ( auto const location = stream.reserve( n ) ) {
+            format( integer, content_size, location, location + n );
+
+            stream.commit( n );
+
+            return n;
+        } // if
+
         Formatted_Integer formatted_integer;
 
-        auto const begin = format( integer, formatted_integer );
+        format( integer, content_size, formatted_integer.begin(), formatted_integer.begin() + n );
 
-        stream.put( begin, formatted_integer.end() );
+        stream.put( formatted_integer.begin(), formatted_integer.begin() + n );
 
-        return formatted_integer.end() - begin;
+        return n;
     }
 
     /**
@@ -589,77 +975,271 @@ class Output_Formatter<Format::Dec<Integer>> {
     auto print( Fault_Reporting_Output_Stream & stream, Integer integer ) const noexcept
         -> Result<std::size_t>
     {
+        auto const content_size = size( integer );
+        auto const n            = padded_size( content_size );
+
+        auto reservation = stream.reserve( n );
+        if ( reservation.is_error() ) {
+            return reservation.error();
+        } // if
+
+        if ( auto const location = reservation.value() ) {
+            format( integer, content_size, location, location + n );
+
+            auto result = stream.commit( n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return n;
+        } // if
+
         Formatted_Integer formatted_integer;
 
-        auto const begin = format( integer, formatted_integer );
+        format( integer, content_size, formatted_integer.begin(), formatted_integer.begin() + n );
 
-        auto result = stream.put( begin, formatted_integer.end() );
+        auto result = stream.put( formatted_integer.begin(), formatted_integer.begin() + n );
         if ( result.is_error() ) {
             return result.error();
         } // if
 
-        return static_cast<std::size_t>( formatted_integer.end() - begin );
+        return n;
     }
 
   private:
+    /**
+     * \brief The maximum size of a formatted integer without padding.
+     */
+    static constexpr auto MAX_CONTENT_SIZE = std::size_t{
+        ( std::is_signed_v<Integer> or SIGN != Format::Sign::NEGATIVE ? 1 : 0 )
+        + std::numeric_limits<Integer>::digits10 + 1
+    };
+
     /**
      * \brief Formatted integer.
      */
     using Formatted_Integer =
-        Array<char, ( std::is_signed_v<Integer> ? 1 : 0 ) + std::numeric_limits<Integer>::digits10 + 1>;
+        Array<char, MAX_CONTENT_SIZE < WIDTH ? std::size_t{ WIDTH } : MAX_CONTENT_SIZE>;
 
     /**
-     * \brief Format an integer.
+     * \brief The unsigned integer type used to hold the magnitude of the integer.
+     */
+    using Unsigned_Integer = std::make_unsigned_t<Integer>;
+
+    /**
+     * \brief Get the magnitude of an integer.
      *
-     * \param[in] integer The integer to format.
-     * \param[in] formatted_integer The array to write the formatted integer to.
+     * \param[in] integer The integer whose magnitude is to be gotten.
      *
-     * \return An iterator to the beginning of the formatted integer.
+     * \return The magnitude of the integer.
      */
-    static constexpr auto format( Integer integer, Formatted_Integer & formatted_integer ) noexcept
-        -> typename Formatted_Integer::Iterator
+    static constexpr auto magnitude( Integer integer ) noexcept -> Unsigned_Integer
     {
-        // #lizard forgives the length
-
         if constexpr ( std::is_signed_v<Integer> ) {
-            auto const is_negative = integer < 0;
-
-            auto i = formatted_integer.rbegin();
-
-            do {
-                *i = '0' + std::abs( integer % 10 );
-
-                ++i;
-                integer /= 10;
-            } while ( integer );
+            if ( integer < 0 ) {
+                return static_cast<Unsigned_Integer>( 0 - to_unsigned( integer ) );
+            } // if
+        }     // if
 
-            if ( is_negative ) {
-                *i = '-';
+        return to_unsigned( integer );
+    }
 
-                ++i;
+    /**
+     * \brief Get an integer's sign character.
+     *
+     * \param[in] integer The integer whose sign character is to be gotten.
+     *
+     * \return The integer's sign character.
+     * \return '\0' if the integer does not have a sign character.
+     */
+    static constexpr auto sign( Integer integer ) noexcept -> char
+    {
+        if constexpr ( std::is_signed_v<Integer> ) {
+            if ( integer < 0 ) {
+                return '-';
             } // if
+        }     // if
 
-            return i.base();
+        if constexpr ( SIGN == Format::Sign::ALWAYS ) {
+            return '+';
+        } else if constexpr ( SIGN == Format::Sign::SPACE ) {
+            return ' ';
         } else {
-            auto i = formatted_integer.rbegin();
-            do {
-                *i = '0' + ( integer % 10 );
-
-                ++i;
-                integer /= 10;
-            } while ( integer );
-            return i.base();
+            return '\0';
         } // else
     }
-};
 
-/**
- * \brief microlibrary::Format::Hex output formatter.
- *
- * \tparam Integer The type of integer to format.
- */
-template<typename Integer>
-class Output_Formatter<Format::Hex<Integer>> {
+    /**
+     * \brief Get the size of a formatted integer without padding.
+     *
+     * The number of digits is determined by comparing the integer's magnitude against
+     * powers of ten, which does not require any divisions.
+     *
+     * \param[in] integer The integer whose formatted size is to be gotten.
+     *
+     * \return The size of the formatted integer without padding.
+     */
+    static constexpr auto size( Integer integer ) noexcept -> std::size_t
+    {
+        auto const integer_magnitude = magnitude( integer );
+
+        auto n = std::size_t{ 1 };
+        for ( auto threshold = Unsigned_Integer{ 10 }; integer_magnitude >= threshold; ) {
+            ++n;
+
+            if ( n > std::numeric_limits<Unsigned_Integer>::digits10 ) {
+                break;
+            } // if
+
+            threshold *= 10;
+        } // for
+
+        if ( sign( integer ) ) {
+            ++n;
+        } // if
+
+        return n;
+    }
+
+    /**
+     * \brief Get the size of a formatted integer.
+     *
+     * \param[in] content_size The size of the formatted integer without padding.
+     *
+     * \return The size of the formatted integer.
+     */
+    static constexpr auto padded_size( std::size_t content_size ) noexcept -> std::size_t
+    {
+        return content_size < WIDTH ? WIDTH : content_size;
+    }
+
+    /**
+     * \brief Format an integer.
+     *
+     * The fill characters, sign, and digits are written directly to their final
+     * locations, so no characters are moved after they are written.
+     *
+     * \param[in] integer The integer to format.
+     * \param[in] content_size The size of the formatted integer without padding.
+     * \param[out] begin The beginning of the location to write the formatted integer to.
+     * \param[out] end The end of the location to write the formatted integer to.
+     */
+    static void format( Integer integer, [[maybe_unused]] std::size_t content_size, char * begin, char * end ) noexcept
+    {
+        if constexpr ( ALIGNMENT == Format::Alignment::LEFT and WIDTH > 0 ) {
+            fill( begin + content_size, end, FILL );
+
+            end = begin + content_size;
+        } // if
+
+        auto const integer_sign = sign( integer );
+
+        if constexpr ( ALIGNMENT == Format::Alignment::INTERNAL and WIDTH > 0 ) {
+            if ( integer_sign ) {
+                *begin = integer_sign;
+
+                ++begin;
+            } // if
+        }     // if
+
+        auto i = format_digits( magnitude( integer ), end );
+
+        if constexpr ( ALIGNMENT != Format::Alignment::INTERNAL or WIDTH == 0 ) {
+            if ( integer_sign ) {
+                --i;
+                *i = integer_sign;
+            } // if
+        }     // if
+
+        if constexpr ( WIDTH > 0 ) {
+            fill( begin, i, FILL );
+        } // if
+    }
+
+    /**
+     * \brief Format an integer's magnitude.
+     *
+     * Two digits are produced per step using the decimal digit pair lookup table, which
+     * halves the number of divisions that are required. The digits are written
+     * backwards from their end.
+     *
+     * \param[in] integer_magnitude The integer magnitude to format.
+     * \param[out] end The end of the location to write the digits to.
+     *
+     * \return The beginning of the digits.
+     */
+    static auto format_digits( Unsigned_Integer integer_magnitude, char * end ) noexcept -> char *
+    {
+        auto const digit_pairs = Format::decimal_digit_pairs();
+
+        auto i = end;
+
+        while ( integer_magnitude >= 100 ) {
+            auto const quotient = divide_by_100( integer_magnitude );
+            auto const pair = static_cast<std::uint_fast8_t>( integer_magnitude - quotient * 100 ) * 2;
+
+            --i;
+            *i = digit_pairs[ pair + 1 ];
+            --i;
+            *i = digit_pairs[ pair ];
+
+            integer_magnitude = quotient;
+        } // while
+
+        if ( integer_magnitude >= 10 ) {
+            auto const pair = static_cast<std::uint_fast8_t>( integer_magnitude ) * 2;
+
+            --i;
+            *i = digit_pairs[ pair + 1 ];
+            --i;
+            *i = digit_pairs[ pair ];
+        } else {
+            --i;
+            *i = '0' + integer_magnitude;
+        } // else
+
+        return i;
+    }
+
+    /**
+     * \brief Divide an unsigned integer by 100.
+     *
+     * 8-bit and 16-bit integers are divided using a multiply-and-shift reciprocal, which
+     * avoids calling a software division routine on targets without a hardware divider.
+     *
+     * \param[in] dividend The unsigned integer to divide.
+     *
+     * \return The quotient.
+     */
+    static constexpr auto divide_by_100( Unsigned_Integer dividend ) noexcept -> Unsigned_Integer
+    {
+        if constexpr ( std::numeric_limits<Unsigned_Integer>::digits <= 8 ) {
+            // exact for 0 <= dividend < 1000
+            return static_cast<Unsigned_Integer>(
+                ( static_cast<std::uint_fast16_t>( dividend ) * 41 ) >> 12 );
+        } else if constexpr ( std::numeric_limits<Unsigned_Integer>::digits <= 16 ) {
+            // exact for 0 <= dividend < 65536
+            return static_cast<Unsigned_Integer>(
+                ( static_cast<std::uint_fast32_t>( dividend >> 2 ) * 5243 ) >> 17 );
+        } else {
+            return dividend / 100;
+        } // else
+    }
+};
+
+/**
+ * \brief microlibrary::Format::Fixed output formatter.
+ *
+ * The fixed-point value is formatted as an optional '-' sign, the integer part, and if
+ * PRECISION is not 0, a '.' followed by PRECISION fraction digits. The value is rounded to
+ * nearest (ties to even).
+ *
+ * \tparam Integer The fixed-point value's underlying integer type.
+ * \tparam FRACTION_BITS The number of fraction bits in the fixed-point value.
+ * \tparam PRECISION The number of fraction digits to format.
+ */
+template<typename Integer, std::uint_fast8_t FRACTION_BITS, std::uint_fast8_t PRECISION>
+class Output_Formatter<Format::Fixed<Integer, FRACTION_BITS, PRECISION>> {
   public:
     /**
      * \brief Constructor.
@@ -705,27 +1285,29 @@ class Output_Formatter<Format::Hex<Integer>> {
         -> Output_Formatter & = default;
 
     /**
-     * \brief Write a formatted integer to a stream.
+     * \brief Write a formatted fixed-point value to a stream.
      *
-     * \param[in] stream The stream to write the formatted integer to.
-     * \param[in] integer The integer to format.
+     * \param[in] stream The stream to write the formatted fixed-point value to.
+     * \param[in] integer The fixed-point value to format.
      *
      * \return The number of characters written to the stream.
      */
     auto print( Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
     {
-        auto const formatted_integer = format( integer );
+        Formatted_Value formatted_value;
 
-        stream.put( formatted_integer.begin(), formatted_integer.end() );
+        auto const begin = format( integer, formatted_value.end() );
 
-        return formatted_integer.size();
+        stream.put( begin, formatted_value.end() );
+
+        return static_cast<std::size_t>( formatted_value.end() - begin );
     }
 
     /**
-     * \brief Write a formatted integer to a stream.
+     * \brief Write a formatted fixed-point value to a stream.
      *
-     * \param[in] stream The stream to write the formatted integer to.
-     * \param[in] integer The integer to format.
+     * \param[in] stream The stream to write the formatted fixed-point value to.
+     * \param[in] integer The fixed-point value to format.
      *
      * \return The number of characters written to the stream if the write succeeded.
      * \return An error code if the write failed.
@@ -733,72 +1315,150 @@ class Output_Formatter<Format::Hex<Integer>> {
     auto print( Fault_Reporting_Output_Stream & stream, Integer integer ) const noexcept
         -> Result<std::size_t>
     {
-        auto const formatted_integer = format( integer );
+        Formatted_Value formatted_value;
 
-        auto result = stream.put( formatted_integer.begin(), formatted_integer.end() );
+        auto const begin = format( integer, formatted_value.end() );
+
+        auto result = stream.put( begin, formatted_value.end() );
         if ( result.is_error() ) {
             return result.error();
         } // if
 
-        return formatted_integer.size();
+        return static_cast<std::size_t>( formatted_value.end() - begin );
     }
 
   private:
     /**
-     * \brief The number of bits in a nibble.
+     * \brief The unsigned integer type used to hold the magnitude of the fixed-point
+     *        value.
      */
-    static constexpr auto NIBBLE_DIGITS = 4;
+    using Unsigned_Integer = std::make_unsigned_t<Integer>;
 
     /**
-     * \brief The number of nibbles in an unsigned integer.
+     * \brief The unsigned integer type used to generate fraction digits (must be able to
+     *        hold the fraction bits multiplied by 10).
      */
-    static constexpr auto NIBBLES = std::numeric_limits<std::make_unsigned_t<Integer>>::digits / NIBBLE_DIGITS;
+    using Fraction = std::conditional_t<
+        FRACTION_BITS + 4 <= 16,
+        std::uint_fast16_t,
+        std::conditional_t<FRACTION_BITS + 4 <= 32, std::uint_fast32_t, std::uint_fast64_t>>;
+
+    static_assert( FRACTION_BITS + 4 <= std::numeric_limits<std::uint_fast64_t>::digits );
 
     /**
-     * \brief Nibble bit mask.
+     * \brief Fraction bit mask.
      */
-    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+    static constexpr auto FRACTION_MASK = static_cast<Fraction>( ( Fraction{ 1 } << FRACTION_BITS ) - 1 );
 
     /**
-     * \brief Formatted integer.
+     * \brief One half.
      */
-    using Formatted_Integer = Array<char, 2 + NIBBLES>;
+    static constexpr auto HALF = static_cast<Fraction>( ( FRACTION_MASK >> 1 ) + 1 );
 
     /**
-     * \brief Format an integer.
+     * \brief Formatted fixed-point value.
+     */
+    using Formatted_Value =
+        Array<char, 1 + std::numeric_limits<Unsigned_Integer>::digits10 + 1 + 1 + PRECISION>;
+
+    /**
+     * \brief Get the magnitude of a fixed-point value.
      *
-     * \param[in] integer The integer to format.
+     * \param[in] integer The fixed-point value whose magnitude is to be gotten.
      *
-     * \return The formatted integer.
+     * \return The magnitude of the fixed-point value.
      */
-    static constexpr auto format( Integer integer ) noexcept -> Formatted_Integer
+    static constexpr auto magnitude( Integer integer ) noexcept -> Unsigned_Integer
     {
-        auto unsigned_integer = to_unsigned( integer );
+        if constexpr ( std::is_signed_v<Integer> ) {
+            if ( integer < 0 ) {
+                return static_cast<Unsigned_Integer>( 0 - to_unsigned( integer ) );
+            } // if
+        }     // if
 
-        Formatted_Integer formatted_integer;
+        return to_unsigned( integer );
+    }
+
+    /**
+     * \brief Format a fixed-point value.
+     *
+     * Fraction digits are generated by repeatedly multiplying the fraction by 10, and the
+     * last digit is rounded to nearest (ties to even) using the exact remainder. The
+     * formatted value is written backwards from its end.
+     *
+     * \param[in] integer The fixed-point value to format.
+     * \param[out] end The end of the location to write the formatted value to.
+     *
+     * \return The beginning of the formatted value.
+     */
+    static auto format( Integer integer, char * end ) noexcept -> char *
+    {
+        auto const integer_magnitude = magnitude( integer );
+
+        auto integer_part = Unsigned_Integer{ 0 };
+        if constexpr ( FRACTION_BITS < std::numeric_limits<Unsigned_Integer>::digits ) {
+            integer_part = integer_magnitude >> FRACTION_BITS;
+        } // if
 
-        auto i = formatted_integer.rbegin();
-        for ( auto nibble = 0; nibble < NIBBLES; ++nibble, ++i, unsigned_integer >>= NIBBLE_DIGITS ) {
-            auto const n = static_cast<std::uint_fast8_t>( unsigned_integer & NIBBLE_MASK );
+        auto fraction = static_cast<Fraction>( static_cast<Fraction>( integer_magnitude ) & FRACTION_MASK );
 
-            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+        auto const fraction_begin = end - PRECISION;
+
+        for ( auto i = fraction_begin; i != end; ++i ) {
+            fraction *= 10;
+
+            *i = '0' + static_cast<char>( fraction >> FRACTION_BITS );
+
+            fraction &= FRACTION_MASK;
         } // for
-        *i = 'x';
-        ++i;
-        *i = '0';
 
-        return formatted_integer;
+        auto const odd = PRECISION > 0 ? ( *( end - 1 ) - '0' ) & 1 : integer_part & 1;
+        if ( fraction > HALF or ( fraction == HALF and odd ) ) {
+            if ( Format::increment_decimal_digits( fraction_begin, end ) ) {
+                ++integer_part;
+            } // if
+        }     // if
+
+        auto i = fraction_begin;
+
+        if constexpr ( PRECISION > 0 ) {
+            --i;
+            *i = '.';
+        } // if
+
+        do {
+            --i;
+            *i = '0' + static_cast<char>( integer_part % 10 );
+
+            integer_part /= 10;
+        } while ( integer_part );
+
+        if constexpr ( std::is_signed_v<Integer> ) {
+            if ( integer < 0 ) {
+                --i;
+                *i = '-';
+            } // if
+        }     // if
+
+        return i;
     }
 };
 
 /**
- * \brief microlibrary::Format::Hex_Dump output formatter.
+ * \brief microlibrary::Format::Float output formatter.
  *
- * \tparam Address Data address. Must be an unsigned integer type.
- * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * The floating-point value is formatted as an optional '-' sign, the integer part, and if
+ * PRECISION is not 0, a '.' followed by PRECISION fraction digits. The value is rounded to
+ * nearest (ties to even) using exact arithmetic, so the output matches std::to_chars() with
+ * std::chars_format::fixed. Infinities are formatted as "inf" and NaNs are formatted as
+ * "nan". The formatter does not use the C library's floating-point formatting support
+ * and does not allocate memory.
+ *
+ * \tparam Floating_Point The type of floating-point value to format.
+ * \tparam PRECISION The number of fraction digits to format.
  */
-template<typename Address, typename Iterator>
-class Output_Formatter<Format::Hex_Dump<Address, Iterator>> {
+template<typename Floating_Point, std::uint_fast8_t PRECISION>
+class Output_Formatter<Format::Float<Floating_Point, PRECISION>> {
   public:
     /**
      * \brief Constructor.
@@ -844,187 +1504,1811 @@ class Output_Formatter<Format::Hex_Dump<Address, Iterator>> {
         -> Output_Formatter & = default;
 
     /**
-     * \brief Write a formatted microlibrary::Format::Hex_Dump to a stream.
+     * \brief Write a formatted floating-point value to a stream.
      *
-     * \param[in] stream The stream to write the formatted microlibrary::Format::Hex_Dump
-     *            to.
-     * \param[in] hex_dump The microlibrary::Format::Hex_Dump to format.
+     * \param[in] stream The stream to write the formatted floating-point value to.
+     * \param[in] value The floating-point value to format.
      *
      * \return The number of characters written to the stream.
      */
-    auto print( Output_Stream & stream, Format::Hex_Dump<Address, Iterator> const & hex_dump ) const noexcept
-        -> std::size_t
+    auto print( Output_Stream & stream, Floating_Point value ) const noexcept -> std::size_t
     {
-        Row row;
-
-        auto address = hex_dump.address();
-        auto begin   = hex_dump.begin();
-        auto end     = hex_dump.end();
-        auto n       = std::size_t{ 0 };
+        Formatted_Value formatted_value;
 
-        for ( ; begin != end; address += ROW_BYTES, n += row.size() ) {
-            begin = generate_row( address, begin, end, row );
+        auto const begin = format( value, formatted_value.end() );
 
-            stream.put( row.begin(), row.end() );
-        } // for
+        stream.put( begin, formatted_value.end() );
 
-        return n;
+        return static_cast<std::size_t>( formatted_value.end() - begin );
     }
 
     /**
-     * \brief Write a formatted microlibrary::Format::Hex_Dump to a stream.
+     * \brief Write a formatted floating-point value to a stream.
      *
-     * \param[in] stream The stream to write the formatted microlibrary::Format::Hex_Dump
-     *            to.
-     * \param[in] hex_dump The microlibrary::Format::Hex_Dump to format.
+     * \param[in] stream The stream to write the formatted floating-point value to.
+     * \param[in] value The floating-point value to format.
      *
      * \return The number of characters written to the stream if the write succeeded.
      * \return An error code if the write failed.
      */
-    auto print( Fault_Reporting_Output_Stream & stream, Format::Hex_Dump<Address, Iterator> const & hex_dump ) const noexcept
+    auto print( Fault_Reporting_Output_Stream & stream, Floating_Point value ) const noexcept
         -> Result<std::size_t>
     {
-        Row row;
-
-        auto address = hex_dump.address();
-        auto begin   = hex_dump.begin();
-        auto end     = hex_dump.end();
-        auto n       = std::size_t{ 0 };
+        Formatted_Value formatted_value;
 
-        for ( ; begin != end; address += ROW_BYTES, n += row.size() ) {
-            begin = generate_row( address, begin, end, row );
+        auto const begin = format( value, formatted_value.end() );
 
-            auto result = stream.put( row.begin(), row.end() );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }     // for
+        auto result = stream.put( begin, formatted_value.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
 
-        return n;
+        return static_cast<std::size_t>( formatted_value.end() - begin );
     }
 
   private:
+    static_assert( std::numeric_limits<Floating_Point>::is_iec559 );
+    static_assert(
+        std::numeric_limits<Floating_Point>::digits == 24
+        or std::numeric_limits<Floating_Point>::digits == 53 );
+
     /**
-     * \brief The number of bits in a nibble.
+     * \brief The unsigned integer type used to access the floating-point value's
+     *        representation.
      */
-    static constexpr auto NIBBLE_DIGITS = 4;
+    using Bits = std::conditional_t<std::numeric_limits<Floating_Point>::digits == 24, std::uint32_t, std::uint64_t>;
+
+    static_assert( sizeof( Bits ) == sizeof( Floating_Point ) );
 
     /**
-     * \brief Nibble bit mask.
+     * \brief The number of explicitly stored significand bits.
      */
-    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+    static constexpr auto SIGNIFICAND_BITS = std::numeric_limits<Floating_Point>::digits - 1;
 
     /**
-     * \brief The number of nibbles in an address.
+     * \brief Significand bit mask.
      */
-    static constexpr auto ADDRESS_NIBBLES = std::uint_fast8_t{ std::numeric_limits<Address>::digits
-                                                               / NIBBLE_DIGITS };
+    static constexpr auto SIGNIFICAND_MASK = static_cast<Bits>( ( Bits{ 1 } << SIGNIFICAND_BITS ) - 1 );
 
     /**
-     * \brief The number of nibbles in a byte.
+     * \brief Biased exponent bit mask (after shifting out the significand).
      */
-    static constexpr auto BYTE_NIBBLES = std::uint_fast8_t{ std::numeric_limits<std::uint8_t>::digits
-                                                            / NIBBLE_DIGITS };
+    static constexpr auto EXPONENT_MASK = static_cast<Bits>(
+        2 * std::numeric_limits<Floating_Point>::max_exponent - 1 );
 
     /**
-     * \brief Group separation spaces.
+     * \brief The exponent bias.
      */
-    static constexpr auto GROUP_SEPARATION = std::uint_fast8_t{ 2 };
+    static constexpr auto EXPONENT_BIAS = std::numeric_limits<Floating_Point>::max_exponent - 1;
 
     /**
-     * \brief The number of bytes in a row.
+     * \brief The sign bit position.
      */
-    static constexpr auto ROW_BYTES = std::uint_fast8_t{ 16 };
+    static constexpr auto SIGN_BIT = std::numeric_limits<Bits>::digits - 1;
 
     /**
-     * \brief Row buffer address (hex) offset.
+     * \brief The maximum number of fraction bits (the number of fraction bits in the
+     *        smallest subnormal value).
      */
-    static constexpr auto ADDRESS_HEX_OFFSET = std::uint_fast8_t{ 0 };
+    static constexpr auto MAX_FRACTION_BITS = EXPONENT_BIAS - 1 + SIGNIFICAND_BITS;
 
     /**
-     * \brief Row buffer data (hex) offset.
+     * \brief The maximum number of integer part digits.
      */
-    static constexpr auto DATA_HEX_OFFSET = std::uint_fast8_t{ ADDRESS_HEX_OFFSET + ADDRESS_NIBBLES
-                                                               + GROUP_SEPARATION };
+    static constexpr auto MAX_INTEGER_DIGITS = std::numeric_limits<Floating_Point>::max_exponent10 + 1;
 
     /**
-     * \brief Row buffer data (ASCII) offset.
+     * \brief Big integer word.
      */
-    static constexpr auto DATA_ASCII_OFFSET = std::uint_fast8_t{
-        DATA_HEX_OFFSET + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 ) + GROUP_SEPARATION + 1
-    };
+    using Word = std::uint32_t;
 
     /**
-     * \brief Row buffer.
+     * \brief The number of bits in a big integer word.
      */
-    using Row =
-        Array<char, ADDRESS_NIBBLES + GROUP_SEPARATION + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 ) + GROUP_SEPARATION + 1 + ROW_BYTES + 1 + 1>;
+    static constexpr auto WORD_BITS = std::numeric_limits<Word>::digits;
 
     /**
-     * \brief Format an integer (hex).
+     * \brief Integer part (little endian big integer).
+     */
+    using Integer_Part =
+        Array<Word, ( std::numeric_limits<Floating_Point>::max_exponent + WORD_BITS - 1 ) / WORD_BITS>;
+
+    /**
+     * \brief Fraction (little endian big integer with room for the fraction bits
+     *        multiplied by 10).
+     */
+    using Fraction = Array<Word, ( MAX_FRACTION_BITS + 4 + WORD_BITS - 1 ) / WORD_BITS>;
+
+    /**
+     * \brief Formatted floating-point value.
+     */
+    using Formatted_Value = Array<char, 1 + MAX_INTEGER_DIGITS + 1 + PRECISION>;
+
+    /**
+     * \brief Format a floating-point value.
      *
-     * \tparam Integer The type of integer to format.
+     * \param[in] value The floating-point value to format.
+     * \param[out] end The end of the location to write the formatted value to.
      *
-     * \param[in] integer The integer to format.
-     * \param[out] location The location to write the formatted integer to.
+     * \return The beginning of the formatted value.
      */
-    template<typename Integer>
-    static void format_hex( Integer integer, typename Row::Iterator location ) noexcept
+    static auto format( Floating_Point value, char * end ) noexcept -> char *
     {
-        constexpr auto nibbles = std::uint_fast8_t{ std::numeric_limits<Integer>::digits / 4 };
-        auto           nibble = std::uint_fast8_t{ 0 };
-        auto           i      = typename Row::Reverse_Iterator{ location + nibbles };
-        for ( ; nibble < nibbles; ++nibble, ++i, integer >>= NIBBLE_DIGITS ) {
-            auto const n = static_cast<std::uint_fast8_t>( integer & NIBBLE_MASK );
+        Bits bits;
+        std::memcpy( &bits, &value, sizeof( bits ) );
 
-            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
-        } // for
+        auto const biased_exponent = static_cast<std::int_fast16_t>(
+            ( bits >> SIGNIFICAND_BITS ) & EXPONENT_MASK );
+        auto const significand = static_cast<std::uint64_t>( bits & SIGNIFICAND_MASK );
+
+        auto i = end;
+
+        if ( biased_exponent == EXPONENT_MASK ) {
+            auto const string = significand ? "nan" : "inf";
+
+            i -= 3;
+            i[ 0 ] = string[ 0 ];
+            i[ 1 ] = string[ 1 ];
+            i[ 2 ] = string[ 2 ];
+        } else {
+            i = format_finite( biased_exponent, significand, end );
+        } // else
+
+        if ( bits >> SIGN_BIT ) {
+            --i;
+            *i = '-';
+        } // if
+
+        return i;
     }
 
     /**
-     * \brief Format a byte (ASCII).
+     * \brief Format a finite floating-point value's magnitude.
      *
-     * \param[in] byte The byte to format.
-     * \param[out] location The location to write the formatted byte to.
+     * The value is decomposed into an exact integer part and an exact fraction. Fraction
+     * digits are generated by repeatedly multiplying the fraction by 10, and the last
+     * digit is rounded to nearest (ties to even) using the exact remainder, which
+     * produces the same result as std::to_chars() with std::chars_format::fixed.
+     *
+     * \param[in] biased_exponent The floating-point value's biased exponent.
+     * \param[in] significand The floating-point value's stored significand bits.
+     * \param[out] end The end of the location to write the formatted magnitude to.
+     *
+     * \return The beginning of the formatted magnitude.
      */
-    static void format_ascii( std::uint8_t byte, typename Row::Iterator location ) noexcept
+    static auto format_finite( std::int_fast16_t biased_exponent, std::uint64_t significand, char * end ) noexcept
+        -> char *
     {
-        *location = std::isprint( byte ) ? static_cast<char>( byte ) : '.';
+        auto exponent = static_cast<std::int_fast16_t>( 1 - EXPONENT_BIAS - SIGNIFICAND_BITS );
+        if ( biased_exponent ) {
+            significand |= std::uint64_t{ 1 } << SIGNIFICAND_BITS;
+            exponent = biased_exponent - EXPONENT_BIAS - SIGNIFICAND_BITS;
+        } // if
+
+        auto integer_part  = Integer_Part{};
+        auto fraction      = Fraction{};
+        auto fraction_bits = std::uint_fast16_t{ 0 };
+
+        if ( exponent >= 0 ) {
+            for ( auto bit = std::uint_fast8_t{ 0 }; bit <= SIGNIFICAND_BITS; ++bit ) {
+                if ( ( significand >> bit ) & 0b1 ) {
+                    auto const position = exponent + bit;
+
+                    integer_part[ position / WORD_BITS ] |= Word{ 1 } << ( position % WORD_BITS );
+                } // if
+            }     // for
+        } else {
+            fraction_bits = -exponent;
+
+            if ( fraction_bits < std::numeric_limits<std::uint64_t>::digits ) {
+                auto const integer = significand >> fraction_bits;
+
+                integer_part[ 0 ] = static_cast<Word>( integer );
+                integer_part[ 1 ] = static_cast<Word>( integer >> WORD_BITS );
+
+                significand &= ( std::uint64_t{ 1 } << fraction_bits ) - 1;
+            } // if
+
+            fraction[ 0 ] = static_cast<Word>( significand );
+            fraction[ 1 ] = static_cast<Word>( significand >> WORD_BITS );
+        } // else
+
+        auto const fraction_begin = end - PRECISION;
+
+        for ( auto i = fraction_begin; i != end; ++i ) {
+            *i = '0' + static_cast<char>( next_digit( fraction, fraction_bits ) );
+        } // for
+
+        auto const odd = PRECISION > 0 ? ( *( end - 1 ) - '0' ) & 1 : integer_part[ 0 ] & 1;
+        if ( round_up( fraction, fraction_bits, odd ) ) {
+            if ( Format::increment_decimal_digits( fraction_begin, end ) ) {
+                increment( integer_part );
+            } // if
+        }     // if
+
+        auto i = fraction_begin;
+
+        if constexpr ( PRECISION > 0 ) {
+            --i;
+            *i = '.';
+        } // if
+
+        for ( ;; ) {
+            auto chunk = divide( integer_part, CHUNK_DIVISOR );
+
+            auto const last = is_zero( integer_part );
+
+            for ( auto digit = std::uint_fast8_t{ 0 }; digit < CHUNK_DIGITS and ( chunk or not last ); ++digit ) {
+                --i;
+                *i = '0' + static_cast<char>( chunk % 10 );
+
+                chunk /= 10;
+            } // for
+
+            if ( last ) {
+                if ( i == fraction_begin - ( PRECISION > 0 ? 1 : 0 ) ) {
+                    --i;
+                    *i = '0';
+                } // if
+
+                return i;
+            } // if
+        }         // for
     }
 
     /**
-     * \brief Generate a row.
+     * \brief The number of integer part digits generated per big integer division.
+     */
+    static constexpr auto CHUNK_DIGITS = std::uint_fast8_t{ 9 };
+
+    /**
+     * \brief The big integer divisor used to generate integer part digits.
+     */
+    static constexpr auto CHUNK_DIVISOR = Word{ 1'000'000'000 };
+
+    /**
+     * \brief Generate the next fraction digit.
      *
-     * \param[in] address The row's address.
-     * \param[in] begin The beginning of the data to dump.
-     * \param[in] end The end of the data to dump.
-     * \param[out] row The row buffer to write the generated row to.
+     * \param[in,out] fraction The fraction.
+     * \param[in] fraction_bits The number of fraction bits.
      *
-     * \return The beginning of the remaining data to dump.
+     * \return The next fraction digit.
      */
-    static auto generate_row( Address address, Iterator begin, Iterator end, Row & row ) noexcept -> Iterator
+    static auto next_digit( Fraction & fraction, std::uint_fast16_t fraction_bits ) noexcept -> Word
     {
-        fill( row.begin() + ADDRESS_NIBBLES, row.end() - 1, ' ' );
+        auto const word   = fraction_bits / WORD_BITS;
+        auto const offset = fraction_bits % WORD_BITS;
 
-        row.back() = '\n';
+        auto carry = std::uint64_t{ 0 };
+        for ( auto i = std::size_t{ 0 }; i <= word + 1 and i < fraction.size(); ++i ) {
+            auto const product = std::uint64_t{ fraction[ i ] } * 10 + carry;
 
-        *( row.begin() + DATA_ASCII_OFFSET - 1 ) = '|';
+            fraction[ i ] = static_cast<Word>( product );
+            carry         = product >> WORD_BITS;
+        } // for
 
-        format_hex( address, row.begin() + ADDRESS_HEX_OFFSET );
+        auto digit = fraction[ word ] >> offset;
+        fraction[ word ] &= ( Word{ 1 } << offset ) - 1;
 
-        auto byte = std::uint_fast8_t{ 0 };
-        for ( ; begin != end and byte < ROW_BYTES; ++begin, ++byte ) {
-            format_hex(
-                static_cast<std::uint8_t>( *begin ),
-                row.begin() + DATA_HEX_OFFSET + ( ( BYTE_NIBBLES + 1 ) * byte ) );
-            format_ascii( static_cast<std::uint8_t>( *begin ), row.begin() + DATA_ASCII_OFFSET + byte );
-        } // for
-        *( row.begin() + DATA_ASCII_OFFSET + byte ) = '|';
+        if ( offset and word + 1 < fraction.size() ) {
+            digit |= fraction[ word + 1 ] << ( WORD_BITS - offset );
+            fraction[ word + 1 ] = 0;
+        } // if
 
-        return begin;
+        return digit;
     }
-};
 
-} // namespace microlibrary
+    /**
+     * \brief Check if the formatted value must be rounded up.
+     *
+     * \param[in] fraction The fraction that remains after the last generated digit.
+     * \param[in] fraction_bits The number of fraction bits.
+     * \param[in] odd The last generated digit is odd.
+     *
+     * \return true if the formatted value must be rounded up.
+     * \return false if the formatted value must not be rounded up.
+     */
+    static auto round_up( Fraction const & fraction, std::uint_fast16_t fraction_bits, bool odd ) noexcept
+        -> bool
+    {
+        if ( not fraction_bits ) {
+            return false;
+        } // if
+
+        auto const word   = ( fraction_bits - 1 ) / WORD_BITS;
+        auto const offset = ( fraction_bits - 1 ) % WORD_BITS;
+
+        if ( not( ( fraction[ word ] >> offset ) & 0b1 ) ) {
+            return false;
+        } // if
+
+        if ( odd or fraction[ word ] & ( ( Word{ 1 } << offset ) - 1 ) ) {
+            return true;
+        } // if
+
+        for ( auto i = std::size_t{ 0 }; i < word; ++i ) {
+            if ( fraction[ i ] ) {
+                return true;
+            } // if
+        }     // for
+
+        return false;
+    }
+
+    /**
+     * \brief Increment a big integer.
+     *
+     * \param[in,out] integer The big integer to increment.
+     */
+    static void increment( Integer_Part & integer ) noexcept
+    {
+        for ( auto & word : integer ) {
+            ++word;
+
+            if ( word ) {
+                return;
+            } // if
+        }     // for
+    }
+
+    /**
+     * \brief Divide a big integer.
+     *
+     * \param[in,out] dividend The big integer to divide (replaced with the quotient).
+     * \param[in] divisor The divisor.
+     *
+     * \return The remainder.
+     */
+    static auto divide( Integer_Part & dividend, Word divisor ) noexcept -> Word
+    {
+        auto remainder = std::uint64_t{ 0 };
+
+        for ( auto i = dividend.size(); i; ) {
+            --i;
+
+            auto const n = ( remainder << WORD_BITS ) | dividend[ i ];
+
+            dividend[ i ] = static_cast<Word>( n / divisor );
+            remainder     = n % divisor;
+        } // for
+
+        return static_cast<Word>( remainder );
+    }
+
+    /**
+     * \brief Check if a big integer is zero.
+     *
+     * \param[in] integer The big integer to check.
+     *
+     * \return true if the big integer is zero.
+     * \return false if the big integer is not zero.
+     */
+    static auto is_zero( Integer_Part const & integer ) noexcept -> bool
+    {
+        for ( auto const word : integer ) {
+            if ( word ) {
+                return false;
+            } // if
+        }     // for
+
+        return true;
+    }
+};
+
+/**
+ * \brief microlibrary::Format::Hex output formatter.
+ *
+ * \tparam Integer The type of integer to format.
+ * \tparam KERNEL The formatting kernel to use.
+ * \tparam WIDTH The minimum field width.
+ * \tparam FILL The character used to pad the formatted integer to the minimum field width.
+ * \tparam ALIGNMENT The formatted integer's alignment within the field.
+ * \tparam PREFIX Include the "0x" prefix.
+ */
+template<typename Integer, Format::Kernel KERNEL, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, bool PREFIX>
+class Output_Formatter<Format::Hex<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write a formatted integer to a stream.
+     *
+     * \param[in] stream The stream to write the formatted integer to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
+    {
+        if ( auto const location = stream.reserve( SIZE ) ) {
+            format( integer, location );
+
+            stream.commit( SIZE );
+
+            return SIZE;
+        } // if
+
+        Formatted_Integer formatted_integer;
+
+        format( integer, formatted_integer.begin() );
+
+        stream.put( formatted_integer.begin(), formatted_integer.end() );
+
+        return formatted_integer.size();
+    }
+
+    /**
+     * \brief Write a formatted integer to a stream.
+     *
+     * \param[in] stream The stream to write the formatted integer to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Fault_Reporting_Output_Stream & stream, Integer integer ) const noexcept
+        -> Result<std::size_t>
+    {
+        auto reservation = stream.reserve( SIZE );
+        if ( reservation.is_error() ) {
+            return reservation.error();
+        } // if
+
+        if ( auto const location = reservation.value() ) {
+            format( integer, location );
+
+            auto result = stream.commit( SIZE );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return SIZE;
+        } // if
+
+        Formatted_Integer formatted_integer;
+
+        format( integer, formatted_integer.begin() );
+
+        auto result = stream.put( formatted_integer.begin(), formatted_integer.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return formatted_integer.size();
+    }
+
+  private:
+    /**
+     * \brief The number of bits in a nibble.
+     */
+    static constexpr auto NIBBLE_DIGITS = 4;
+
+    /**
+     * \brief The number of nibbles in an unsigned integer.
+     */
+    static constexpr auto NIBBLES = std::numeric_limits<std::make_unsigned_t<Integer>>::digits / NIBBLE_DIGITS;
+
+    /**
+     * \brief Nibble bit mask.
+     */
+    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+
+    /**
+     * \brief The number of bits in a byte.
+     */
+    static constexpr auto BYTE_DIGITS = std::numeric_limits<std::uint8_t>::digits;
+
+    /**
+     * \brief Byte bit mask.
+     */
+    static constexpr auto BYTE_MASK = mask<std::uint_fast8_t>( BYTE_DIGITS, 0 );
+
+    /**
+     * \brief The size of a formatted integer without padding.
+     */
+    static constexpr auto CONTENT_SIZE = std::size_t{ ( PREFIX ? 2 : 0 ) + NIBBLES };
+
+    /**
+     * \brief The size of a formatted integer.
+     */
+    static constexpr auto SIZE = CONTENT_SIZE < WIDTH ? std::size_t{ WIDTH } : CONTENT_SIZE;
+
+    /**
+     * \brief The number of fill characters in a formatted integer.
+     */
+    static constexpr auto PADDING = SIZE - CONTENT_SIZE;
+
+    /**
+     * \brief Formatted integer.
+     */
+    using Formatted_Integer = Array<char, SIZE>;
+
+    /**
+     * \brief Format an integer.
+     *
+     * \param[in] integer The integer to format.
+     * \param[out] location The location to write the formatted integer to (must have
+     *             space for the entire formatted integer).
+     */
+    static void format( Integer integer, char * location ) noexcept
+    {
+        auto unsigned_integer = to_unsigned( integer );
+
+        auto begin = location;
+        auto end   = location + SIZE;
+
+        if constexpr ( ALIGNMENT == Format::Alignment::LEFT ) {
+            end -= PADDING;
+
+            fill( end, end + PADDING, FILL );
+        } else if constexpr ( ALIGNMENT == Format::Alignment::RIGHT ) {
+            fill( begin, begin + PADDING, FILL );
+
+            begin += PADDING;
+        } // else if
+
+        if constexpr ( PREFIX ) {
+            begin[ 0 ] = '0';
+            begin[ 1 ] = 'x';
+
+            begin += 2;
+        } // if
+
+        if constexpr ( ALIGNMENT == Format::Alignment::INTERNAL ) {
+            fill( begin, begin + PADDING, FILL );
+
+            begin += PADDING;
+        } // if
+
+        if constexpr ( KERNEL == Format::Kernel::LOOKUP_TABLE ) {
+            auto const digit_pairs = Format::hexadecimal_digit_pairs();
+
+            for ( auto i = end; i != begin; unsigned_integer >>= BYTE_DIGITS ) {
+                auto const pair = static_cast<std::uint_fast16_t>( unsigned_integer & BYTE_MASK ) * 2;
+
+                --i;
+                *i = digit_pairs[ pair + 1 ];
+                --i;
+                *i = digit_pairs[ pair ];
+            } // for
+        } else {
+            for ( auto i = end; i != begin; unsigned_integer >>= NIBBLE_DIGITS ) {
+                --i;
+
+                auto const n = static_cast<std::uint_fast8_t>( unsigned_integer & NIBBLE_MASK );
+
+                *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+            } // for
+        }     // else
+    }
+};
+
+/**
+ * \brief microlibrary::Format::Hex_Dump output formatter.
+ *
+ * Each row is generated in a single pass. If the stream's driver supports writing
+ * directly to its write buffer (see microlibrary::Stream_IO_Driver::reserve() and
+ * microlibrary::Fault_Reporting_Stream_IO_Driver::reserve()), rows are generated
+ * directly in the driver's write buffer. Otherwise, rows are generated in a row buffer
+ * and written to the stream as a single block.
+ *
+ * \tparam Address Data address. Must be an unsigned integer type.
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam ROW_BYTES The number of bytes in a row.
+ * \tparam GROUP_BYTES The number of bytes in a group.
+ * \tparam ASCII_COLUMN Include the ASCII representation of each row's data.
+ * \tparam ADDRESS_NIBBLES The number of address nibbles to include in each row.
+ */
+template<typename Address, typename Iterator, std::uint_fast8_t ROW_BYTES, std::uint_fast8_t GROUP_BYTES, bool ASCII_COLUMN, std::uint_fast8_t ADDRESS_NIBBLES>
+class Output_Formatter<Format::Hex_Dump<Address, Iterator, ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES>> {
+  public:
+    /**
+     * \brief The hex dump output format specifier.
+     */
+    using Hex_Dump = Format::Hex_Dump<Address, Iterator, ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write a formatted microlibrary::Format::Hex_Dump to a stream.
+     *
+     * \param[in] stream The stream to write the formatted microlibrary::Format::Hex_Dump
+     *            to.
+     * \param[in] hex_dump The microlibrary::Format::Hex_Dump to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Output_Stream & stream, Hex_Dump const & hex_dump ) const noexcept -> std::size_t
+    {
+        auto address = hex_dump.address();
+        auto begin   = hex_dump.begin();
+        auto end     = hex_dump.end();
+        auto n       = std::size_t{ 0 };
+
+        for ( ; begin != end; address += ROW_BYTES ) {
+            if ( auto const row = stream.reserve( ROW_SIZE ) ) {
+                auto const row_size = static_cast<std::size_t>(
+                    generate_row( address, begin, end, row ) - row );
+
+                stream.commit( row_size );
+
+                n += row_size;
+            } else {
+                Row row_buffer;
+
+                auto const row_end = generate_row( address, begin, end, row_buffer.begin() );
+
+                stream.put( row_buffer.begin(), row_end );
+
+                n += static_cast<std::size_t>( row_end - row_buffer.begin() );
+            } // else
+        }     // for
+
+        return n;
+    }
+
+    /**
+     * \brief Write a formatted microlibrary::Format::Hex_Dump to a stream.
+     *
+     * \param[in] stream The stream to write the formatted microlibrary::Format::Hex_Dump
+     *            to.
+     * \param[in] hex_dump The microlibrary::Format::Hex_Dump to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Fault_Reporting_Output_Stream & stream, Hex_Dump const & hex_dump ) const noexcept
+        -> Result<std::size_t>
+    {
+        auto address = hex_dump.address();
+        auto begin   = hex_dump.begin();
+        auto end     = hex_dump.end();
+        auto n       = std::size_t{ 0 };
+
+        for ( ; begin != end; address += ROW_BYTES ) {
+            auto reservation = stream.reserve( ROW_SIZE );
+            if ( reservation.is_error() ) {
+                return reservation.error();
+            } // if
+
+            if ( auto const row = reservation.value() ) {
+                auto const row_size = static_cast<std::size_t>(
+                    generate_row( address, begin, end, row ) - row );
+
+                auto result = stream.commit( row_size );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+
+                n += row_size;
+            } else {
+                Row row_buffer;
+
+                auto const row_end = generate_row( address, begin, end, row_buffer.begin() );
+
+                auto result = stream.put( row_buffer.begin(), row_end );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+
+                n += static_cast<std::size_t>( row_end - row_buffer.begin() );
+            } // else
+        }     // for
+
+        return n;
+    }
+
+  private:
+    /**
+     * \brief The number of bits in a nibble.
+     */
+    static constexpr auto NIBBLE_DIGITS = 4;
+
+    /**
+     * \brief Nibble bit mask.
+     */
+    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+
+    /**
+     * \brief The number of nibbles in a byte.
+     */
+    static constexpr auto BYTE_NIBBLES = std::uint_fast8_t{ std::numeric_limits<std::uint8_t>::digits
+                                                            / NIBBLE_DIGITS };
+
+    /**
+     * \brief Group separation spaces.
+     */
+    static constexpr auto GROUP_SEPARATION = std::size_t{ 2 };
+
+    /**
+     * \brief Row data (hex) offset.
+     */
+    static constexpr auto DATA_HEX_OFFSET = std::size_t{ ADDRESS_NIBBLES ? ADDRESS_NIBBLES + GROUP_SEPARATION : 0 };
+
+    /**
+     * \brief Row data (hex) size.
+     */
+    static constexpr auto DATA_HEX_SIZE = std::size_t{ ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1
+                                                       + ( ROW_BYTES - 1 ) / GROUP_BYTES };
+
+    /**
+     * \brief Row data (ASCII) offset.
+     */
+    static constexpr auto DATA_ASCII_OFFSET = std::size_t{ DATA_HEX_OFFSET + DATA_HEX_SIZE
+                                                           + GROUP_SEPARATION + 1 };
+
+    /**
+     * \brief The maximum size of a row.
+     */
+    static constexpr auto ROW_SIZE = std::size_t{
+        ASCII_COLUMN ? DATA_ASCII_OFFSET + ROW_BYTES + 1 + 1 : DATA_HEX_OFFSET + DATA_HEX_SIZE + 1
+    };
+
+    /**
+     * \brief Row buffer.
+     */
+    using Row = Array<char, ROW_SIZE>;
+
+    /**
+     * \brief Format an integer (hex).
+     *
+     * \tparam NIBBLES The number of (least significant) nibbles to format.
+     * \tparam Integer The type of integer to format.
+     *
+     * \param[in] integer The integer to format.
+     * \param[out] location The location to write the formatted integer to.
+     *
+     * \return The location after the formatted integer.
+     */
+    template<std::uint_fast8_t NIBBLES, typename Integer>
+    static auto format_hex( Integer integer, char * location ) noexcept -> char *
+    {
+        for ( auto i = location + NIBBLES; i != location; integer >>= NIBBLE_DIGITS ) {
+            --i;
+
+            auto const n = static_cast<std::uint_fast8_t>( integer & NIBBLE_MASK );
+
+            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+        } // for
+
+        return location + NIBBLES;
+    }
+
+    /**
+     * \brief Format a byte (ASCII).
+     *
+     * \param[in] byte The byte to format.
+     *
+     * \return The formatted byte.
+     */
+    static auto format_ascii( std::uint8_t byte ) noexcept -> char
+    {
+        return std::isprint( byte ) ? static_cast<char>( byte ) : '.';
+    }
+
+    /**
+     * \brief Generate a row.
+     *
+     * Each character of the row is written exactly once.
+     *
+     * \param[in] address The row's address.
+     * \param[in,out] begin The beginning of the data to dump (updated to the beginning of
+     *                the remaining data to dump).
+     * \param[in] end The end of the data to dump.
+     * \param[out] row The location to write the generated row to (must have space for
+     *             ROW_SIZE characters).
+     *
+     * \return The end of the generated row.
+     */
+    static auto generate_row( Address address, Iterator & begin, Iterator end, char * row ) noexcept
+        -> char *
+    {
+        auto hex = format_hex<ADDRESS_NIBBLES>( address, row );
+
+        if constexpr ( ADDRESS_NIBBLES != 0 ) {
+            fill( hex, hex + GROUP_SEPARATION, ' ' );
+            hex += GROUP_SEPARATION;
+        } // if
+
+        [[maybe_unused]] auto ascii = row + DATA_ASCII_OFFSET;
+
+        auto byte = std::uint_fast8_t{ 0 };
+        for ( ; begin != end and byte < ROW_BYTES; ++begin, ++byte ) {
+            if ( byte ) {
+                *hex = ' ';
+                ++hex;
+
+                if ( byte % GROUP_BYTES == 0 ) {
+                    *hex = ' ';
+                    ++hex;
+                } // if
+            }     // if
+
+            hex = format_hex<BYTE_NIBBLES>( static_cast<std::uint8_t>( *begin ), hex );
+
+            if constexpr ( ASCII_COLUMN ) {
+                *ascii = format_ascii( static_cast<std::uint8_t>( *begin ) );
+                ++ascii;
+            } // if
+        }     // for
+
+        if constexpr ( ASCII_COLUMN ) {
+            fill( hex, row + DATA_ASCII_OFFSET - 1, ' ' );
+            row[ DATA_ASCII_OFFSET - 1 ] = '|';
+
+            *ascii = '|';
+            ++ascii;
+
+            fill( ascii, row + ROW_SIZE - 1, ' ' );
+            row[ ROW_SIZE - 1 ] = '\n';
+
+            return row + ROW_SIZE;
+        } else {
+            *hex = '\n';
+
+            return hex + 1;
+        } // else
+    }
+};
+
+/**
+ * \brief Integer input formatter (microlibrary::Format::Bin, microlibrary::Format::Dec,
+ *        and microlibrary::Format::Hex input formatter implementation).
+ *
+ * Integers are parsed without skipping leading whitespace. Parsing stops at the first
+ * character that cannot be part of the integer, and that character is left in the
+ * stream. If no digits are found, or the integer does not fit in the integer type, an I/O
+ * error is reported and the value is not modified.
+ *
+ * \tparam Format_Specifier The integer format specifier type.
+ * \tparam Integer The type of integer to parse.
+ * \tparam BASE The integer base (2, 10, or 16).
+ * \tparam PREFIX The optional prefix character that follows a leading '0' (e.g. 'x'), or
+ *         '\0' if the base does not support a prefix.
+ */
+template<typename Format_Specifier, typename Integer, std::uint_fast8_t BASE, char PREFIX>
+class Integer_Input_Formatter {
+  public:
+    static_assert( BASE == 2 or BASE == 10 or BASE == 16 );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Integer_Input_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Integer_Input_Formatter( Integer_Input_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Integer_Input_Formatter( Integer_Input_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Integer_Input_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Integer_Input_Formatter && expression ) noexcept
+        -> Integer_Input_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Integer_Input_Formatter const & expression ) noexcept
+        -> Integer_Input_Formatter & = default;
+
+    /**
+     * \brief Read a formatted integer from a stream.
+     *
+     * \param[in] stream The stream to read the formatted integer from.
+     * \param[out] value The parsed integer.
+     *
+     * \return The number of characters read from the stream.
+     */
+    auto scan( Input_Stream & stream, Format_Specifier & value ) const noexcept -> std::size_t
+    {
+        auto parser = Parser{};
+        auto n      = std::size_t{ 0 };
+
+        for ( ;; ) {
+            char character;
+
+            stream.peek( character );
+            if ( not stream.is_nominal() or not parser.parse( character ) ) {
+                break;
+            } // if
+
+            stream.get( character );
+            ++n;
+        } // for
+
+        if ( not parser.is_complete() ) {
+            stream.report_io_error();
+
+            return n;
+        } // if
+
+        value = Format_Specifier{ parser.value() };
+
+        return n;
+    }
+
+    /**
+     * \brief Read a formatted integer from a stream.
+     *
+     * \param[in] stream The stream to read the formatted integer from.
+     * \param[out] value The parsed integer.
+     *
+     * \return The number of characters read from the stream if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto scan( Fault_Reporting_Input_Stream & stream, Format_Specifier & value ) const noexcept
+        -> Result<std::size_t>
+    {
+        auto parser = Parser{};
+        auto n      = std::size_t{ 0 };
+
+        for ( ;; ) {
+            char character;
+
+            auto result = stream.peek( character );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            if ( not stream.is_nominal() or not parser.parse( character ) ) {
+                break;
+            } // if
+
+            // the character is already buffered by the stream so consuming it cannot fail
+            static_cast<void>( stream.get( character ) );
+            ++n;
+        } // for
+
+        if ( not parser.is_complete() ) {
+            stream.report_io_error();
+
+            return n;
+        } // if
+
+        value = Format_Specifier{ parser.value() };
+
+        return n;
+    }
+
+  private:
+    /**
+     * \brief The unsigned integer type used to accumulate digits.
+     */
+    using Unsigned_Integer = std::make_unsigned_t<Integer>;
+
+    /**
+     * \brief Integer parser.
+     */
+    class Parser {
+      public:
+        /**
+         * \brief Parse a character.
+         *
+         * \param[in] character The character to parse.
+         *
+         * \return true if the character is part of the integer.
+         * \return false if the character is not part of the integer.
+         */
+        constexpr auto parse( char character ) noexcept -> bool
+        {
+            if constexpr ( BASE == 10 and std::is_signed_v<Integer> ) {
+                if ( m_state == State::START and character == '-' ) {
+                    m_is_negative = true;
+                    m_state       = State::SIGN;
+
+                    return true;
+                } // if
+            }     // if
+
+            if constexpr ( PREFIX != '\0' ) {
+                if ( m_state == State::LEADING_ZERO and ( character | 0x20 ) == PREFIX ) {
+                    m_state = State::BASE_PREFIX;
+
+                    return true;
+                } // if
+            }     // if
+
+            auto const digit = digit_value( character );
+            if ( digit >= BASE ) {
+                return false;
+            } // if
+
+            auto const limit = m_is_negative
+                                   ? static_cast<Unsigned_Integer>(
+                                       to_unsigned( std::numeric_limits<Integer>::min() ) )
+                                   : static_cast<Unsigned_Integer>(
+                                       BASE == 10 ? to_unsigned( std::numeric_limits<Integer>::max() )
+                                                  : std::numeric_limits<Unsigned_Integer>::max() );
+
+            if ( m_value > ( limit - digit ) / BASE ) {
+                m_state = State::OUT_OF_RANGE;
+
+                return false;
+            } // if
+
+            m_value = static_cast<Unsigned_Integer>( m_value * BASE + digit );
+            m_state = m_state == State::START and digit == 0 ? State::LEADING_ZERO : State::DIGITS;
+
+            return true;
+        }
+
+        /**
+         * \brief Check if a complete integer has been parsed.
+         *
+         * \return true if a complete integer has been parsed.
+         * \return false if a complete integer has not been parsed.
+         */
+        constexpr auto is_complete() const noexcept -> bool
+        {
+            return m_state == State::LEADING_ZERO or m_state == State::DIGITS;
+        }
+
+        /**
+         * \brief Get the parsed integer.
+         *
+         * \return The parsed integer.
+         */
+        auto value() const noexcept -> Integer
+        {
+            auto const value = m_is_negative ? static_cast<Unsigned_Integer>( 0 - m_value ) : m_value;
+
+            Integer integer;
+            static_assert( sizeof( integer ) == sizeof( value ) );
+            std::memcpy( &integer, &value, sizeof( integer ) );
+            return integer;
+        }
+
+      private:
+        /**
+         * \brief Parser state.
+         */
+        enum class State : std::uint_fast8_t {
+            START,        ///< Start.
+            SIGN,         ///< Sign parsed.
+            LEADING_ZERO, ///< Leading zero parsed.
+            BASE_PREFIX,  ///< Base prefix parsed.
+            DIGITS,       ///< Digits parsed.
+            OUT_OF_RANGE, ///< Integer out of range.
+        };
+
+        /**
+         * \brief The parser's state.
+         */
+        State m_state{ State::START };
+
+        /**
+         * \brief The integer is negative.
+         */
+        bool m_is_negative{ false };
+
+        /**
+         * \brief The accumulated integer magnitude.
+         */
+        Unsigned_Integer m_value{ 0 };
+
+        /**
+         * \brief Get the value of a digit.
+         *
+         * \param[in] character The digit.
+         *
+         * \return The value of the digit if character is a digit.
+         * \return A value that is greater than or equal to the base if character is not a
+         *         digit.
+         */
+        static constexpr auto digit_value( char character ) noexcept -> std::uint_fast8_t
+        {
+            if ( character >= '0' and character <= '9' ) {
+                return character - '0';
+            } // if
+
+            auto const lowercase = static_cast<char>( character | 0x20 );
+            if ( lowercase >= 'a' and lowercase <= 'f' ) {
+                return 0xA + ( lowercase - 'a' );
+            } // if
+
+            return BASE;
+        }
+    };
+};
+
+/**
+ * \brief microlibrary::Format::Bin input formatter.
+ *
+ * An optional "0b" prefix is accepted.
+ *
+ * \tparam Integer The type of integer to parse.
+ * \tparam KERNEL The output formatting kernel (unused).
+ * \tparam WIDTH The output minimum field width (unused).
+ * \tparam FILL The output fill character (unused).
+ * \tparam ALIGNMENT The output alignment (unused).
+ * \tparam PREFIX The output prefix inclusion (unused).
+ */
+template<typename Integer, Format::Kernel KERNEL, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, bool PREFIX>
+class Input_Formatter<Format::Bin<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>> :
+    public Integer_Input_Formatter<Format::Bin<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>, Integer, 2, 'b'> {
+};
+
+/**
+ * \brief microlibrary::Format::Dec input formatter.
+ *
+ * A leading '-' is accepted if the integer type is signed.
+ *
+ * \tparam Integer The type of integer to parse.
+ * \tparam WIDTH The output minimum field width (unused).
+ * \tparam FILL The output fill character (unused).
+ * \tparam ALIGNMENT The output alignment (unused).
+ * \tparam SIGN The output sign policy (unused).
+ */
+template<typename Integer, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, Format::Sign SIGN>
+class Input_Formatter<Format::Dec<Integer, WIDTH, FILL, ALIGNMENT, SIGN>> :
+    public Integer_Input_Formatter<Format::Dec<Integer, WIDTH, FILL, ALIGNMENT, SIGN>, Integer, 10, '\0'> {
+};
+
+/**
+ * \brief microlibrary::Format::Hex input formatter.
+ *
+ * An optional "0x" prefix is accepted, and digits are case insensitive.
+ *
+ * \tparam Integer The type of integer to parse.
+ * \tparam KERNEL The output formatting kernel (unused).
+ * \tparam WIDTH The output minimum field width (unused).
+ * \tparam FILL The output fill character (unused).
+ * \tparam ALIGNMENT The output alignment (unused).
+ * \tparam PREFIX The output prefix inclusion (unused).
+ */
+template<typename Integer, Format::Kernel KERNEL, std::uint_fast8_t WIDTH, char FILL, Format::Alignment ALIGNMENT, bool PREFIX>
+class Input_Formatter<Format::Hex<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>> :
+    public Integer_Input_Formatter<Format::Hex<Integer, KERNEL, WIDTH, FILL, ALIGNMENT, PREFIX>, Integer, 16, 'x'> {
+};
+
+} // namespace microlibrary
+
+namespace microlibrary::Format {
+
+/**
+ * \brief Parsed compile-time format string.
+ *
+ * Replacement fields are delimited by braces:
+ * - "{}" formats the argument using its default output formatter (microlibrary::Format::Dec
+ *   if the argument is an integer other than char)
+ * - "{:b}" formats the argument using microlibrary::Format::Bin
+ * - "{:d}" formats the argument using microlibrary::Format::Dec
+ * - "{:x}" formats the argument using microlibrary::Format::Hex
+ *
+ * Literal braces are written as "{{" and "}}".
+ *
+ * \tparam N The length of the format string.
+ */
+template<std::size_t N>
+class Parsed_String {
+  public:
+    /**
+     * \brief A literal segment and the replacement field that follows it.
+     */
+    struct Segment {
+        /**
+         * \brief The position of the beginning of the segment's literal text.
+         */
+        std::size_t begin{ 0 };
+
+        /**
+         * \brief The position of the end of the segment's literal text.
+         */
+        std::size_t end{ 0 };
+
+        /**
+         * \brief The replacement field's format specifier ('\0' if the replacement field
+         *        does not have a format specifier).
+         */
+        char specifier{ '\0' };
+
+        /**
+         * \brief Get the size of the segment's literal text.
+         *
+         * \return The size of the segment's literal text.
+         */
+        constexpr auto size() const noexcept -> std::size_t
+        {
+            return end - begin;
+        }
+    };
+
+    Parsed_String() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] string The format string to parse.
+     */
+    constexpr Parsed_String( char const * string ) noexcept
+    {
+        auto segment = Segment{};
+
+        for ( auto i = std::size_t{ 0 }; i < N; ++i ) {
+            if ( string[ i ] == '}' ) {
+                if ( i + 1 >= N or string[ i + 1 ] != '}' ) {
+                    m_is_valid = false;
+
+                    return;
+                } // if
+
+                m_literals[ m_literals_size ] = '}';
+                ++m_literals_size;
+                ++i;
+            } else if ( string[ i ] != '{' ) {
+                m_literals[ m_literals_size ] = string[ i ];
+                ++m_literals_size;
+            } else if ( i + 1 < N and string[ i + 1 ] == '{' ) {
+                m_literals[ m_literals_size ] = '{';
+                ++m_literals_size;
+                ++i;
+            } else {
+                if ( i + 1 < N and string[ i + 1 ] == '}' ) {
+                    segment.specifier = '\0';
+                    i += 1;
+                } else if (
+                    i + 3 < N and string[ i + 1 ] == ':' and string[ i + 3 ] == '}'
+                    and ( string[ i + 2 ] == 'b' or string[ i + 2 ] == 'd' or string[ i + 2 ] == 'x' ) ) {
+                    segment.specifier = string[ i + 2 ];
+                    i += 3;
+                } else {
+                    m_is_valid = false;
+
+                    return;
+                } // else
+
+                segment.end             = m_literals_size;
+                m_segments[ m_fields ] = segment;
+                ++m_fields;
+
+                segment       = Segment{};
+                segment.begin = m_literals_size;
+            } // else
+        }     // for
+
+        segment.end            = m_literals_size;
+        m_segments[ m_fields ] = segment;
+    }
+
+    /**
+     * \brief Check if the format string is valid.
+     *
+     * \return true if the format string is valid.
+     * \return false if the format string is not valid.
+     */
+    constexpr auto is_valid() const noexcept -> bool
+    {
+        return m_is_valid;
+    }
+
+    /**
+     * \brief Get the number of replacement fields in the format string.
+     *
+     * \return The number of replacement fields in the format string.
+     */
+    constexpr auto fields() const noexcept -> std::size_t
+    {
+        return m_fields;
+    }
+
+    /**
+     * \brief Get a segment.
+     *
+     * \param[in] position The position of the segment (0 through fields()).
+     *
+     * \return The segment.
+     */
+    constexpr auto segment( std::size_t position ) const noexcept -> Segment
+    {
+        return m_segments[ position ];
+    }
+
+    /**
+     * \brief Get the literal text (with escaped braces replaced).
+     *
+     * \return The literal text.
+     */
+    constexpr auto literals() const noexcept -> char const *
+    {
+        return m_literals.data();
+    }
+
+    /**
+     * \brief Get a segment's literal text.
+     *
+     * \tparam SIZE The size of the segment's literal text.
+     *
+     * \param[in] position The position of the segment (0 through fields()).
+     *
+     * \return The segment's null-terminated literal text.
+     */
+    template<std::size_t SIZE>
+    constexpr auto literal( std::size_t position ) const noexcept -> Array<char, SIZE + 1>
+    {
+        auto const begin = m_segments[ position ].begin;
+
+        Array<char, SIZE + 1> literal{};
+        for ( auto i = std::size_t{ 0 }; i < SIZE; ++i ) {
+            literal[ i ] = m_literals[ begin + i ];
+        } // for
+
+        return literal;
+    }
+
+  private:
+    /**
+     * \brief The format string is valid.
+     */
+    bool m_is_valid{ true };
+
+    /**
+     * \brief The number of replacement fields in the format string.
+     */
+    std::size_t m_fields{ 0 };
+
+    /**
+     * \brief The segments (one per replacement field, plus the trailing literal text).
+     */
+    Array<Segment, N / 2 + 1> m_segments{};
+
+    /**
+     * \brief The size of the literal text.
+     */
+    std::size_t m_literals_size{ 0 };
+
+    /**
+     * \brief The literal text.
+     */
+    Array<char, N + 1> m_literals{};
+};
+
+/**
+ * \brief Get the length of a null-terminated string at compile time.
+ *
+ * \param[in] string The null-terminated string to get the length of.
+ *
+ * \return The length of the null-terminated string.
+ */
+constexpr auto string_length( char const * string ) noexcept -> std::size_t
+{
+    auto n = std::size_t{ 0 };
+
+    for ( ; string[ n ]; ++n ) {} // for
+
+    return n;
+}
+
+/**
+ * \brief Compile-time format string.
+ *
+ * The format string is parsed and validated against the argument types at compile time.
+ * Literal text is written as a single block per segment, and replacement fields are
+ * formatted using the existing output formatters. Only each segment's literal text
+ * (stored in ROM if the HIL supports it) is kept in the program image, and single
+ * character segments are written as characters.
+ *
+ * \attention Compile-time format strings should be created using MICROLIBRARY_FORMAT().
+ *
+ * \tparam Source A type with a constexpr static member function named string() that
+ *         returns the null-terminated format string.
+ */
+template<typename Source>
+class String {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr String() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr String( String && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr String( String const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~String() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( String && expression ) noexcept -> String & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( String const & expression ) noexcept -> String & = default;
+
+    /**
+     * \brief Write formatted values to a stream.
+     *
+     * \tparam Types The types to format.
+     *
+     * \param[in] stream The stream to write the formatted values to.
+     * \param[in] values The values to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<typename... Types>
+    auto print( Output_Stream & stream, Types &&... values ) const noexcept -> std::size_t
+    {
+        static_assert( PARSED.is_valid(), "invalid format string" );
+        static_assert(
+            PARSED.fields() == sizeof...( Types ),
+            "format string replacement field count does not match argument count" );
+
+        return print_implementation<0>( stream, std::size_t{ 0 }, std::forward<Types>( values )... );
+    }
+
+    /**
+     * \brief Write formatted values to a stream.
+     *
+     * \tparam Types The types to format.
+     *
+     * \param[in] stream The stream to write the formatted values to.
+     * \param[in] values The values to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<typename... Types>
+    auto print( Fault_Reporting_Output_Stream & stream, Types &&... values ) const noexcept
+        -> Result<std::size_t>
+    {
+        static_assert( PARSED.is_valid(), "invalid format string" );
+        static_assert(
+            PARSED.fields() == sizeof...( Types ),
+            "format string replacement field count does not match argument count" );
+
+        return print_implementation<0>( stream, std::size_t{ 0 }, std::forward<Types>( values )... );
+    }
+
+  private:
+    /**
+     * \brief The parsed format string.
+     */
+    static constexpr auto PARSED = Parsed_String<string_length( Source::string() )>{
+        Source::string()
+    };
+
+    /**
+     * \brief A segment's null-terminated literal text (stored in ROM if the HIL supports
+     *        it).
+     *
+     * \tparam SEGMENT The segment whose literal text is stored.
+     */
+    template<std::size_t SEGMENT>
+    static constexpr auto LITERAL MICROLIBRARY_ROM_STORAGE = PARSED.template literal<PARSED.segment( SEGMENT ).size()>(
+        SEGMENT );
+
+    /**
+     * \brief Write a segment's literal text to a stream.
+     *
+     * \tparam SEGMENT The segment whose literal text is to be written.
+     * \tparam Stream The type of stream to write the literal text to.
+     *
+     * \param[in] stream The stream to write the literal text to.
+     *
+     * \return The result of the write.
+     */
+    template<std::size_t SEGMENT, typename Stream>
+    static auto put_literal( Stream & stream ) noexcept
+    {
+        constexpr auto segment = PARSED.segment( SEGMENT );
+
+        if constexpr ( segment.size() == 1 ) {
+            constexpr auto character = PARSED.literals()[ segment.begin ];
+
+            return stream.put( character );
+        } else {
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+            return stream.put( ROM::String{ LITERAL<SEGMENT>.data() } );
+#else  // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+            return stream.put( LITERAL<SEGMENT>.begin(), LITERAL<SEGMENT>.end() - 1 );
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+        } // else
+    }
+
+    /**
+     * \brief Write a formatted value to a stream.
+     *
+     * \tparam SPECIFIER The replacement field's format specifier.
+     * \tparam Stream The type of stream to write the formatted value to.
+     * \tparam Type The type of value to format.
+     *
+     * \param[in] stream The stream to write the formatted value to.
+     * \param[in] value The value to format.
+     *
+     * \return The result of the write.
+     */
+    template<char SPECIFIER, typename Stream, typename Type>
+    static auto print_field( Stream & stream, Type const & value ) noexcept
+    {
+        if constexpr ( std::is_same_v<Type, bool> ) {
+            static_assert( not std::is_same_v<Type, bool>, "format strings do not support bool arguments" );
+
+            // format as an integer so that only the static assertion is reported
+            return print_field<SPECIFIER>( stream, static_cast<unsigned char>( value ) );
+        } else if constexpr ( SPECIFIER == '\0' and std::is_integral_v<Type> and not std::is_same_v<Type, char> ) {
+            return Output_Formatter<Dec<Type>>{}.print( stream, value );
+        } else if constexpr ( SPECIFIER == '\0' ) {
+            return Output_Formatter<Type>{}.print( stream, value );
+        } else {
+            static_assert( std::is_integral_v<Type>, "format specifier requires an integer argument" );
+
+            if constexpr ( SPECIFIER == 'b' ) {
+                return Output_Formatter<Bin<Type>>{}.print( stream, value );
+            } else if constexpr ( SPECIFIER == 'd' ) {
+                return Output_Formatter<Dec<Type>>{}.print( stream, value );
+            } else {
+                return Output_Formatter<Hex<Type>>{}.print( stream, value );
+            } // else
+        }     // else
+    }
+
+    /**
+     * \brief Write the trailing literal text to a stream.
+     *
+     * \tparam SEGMENT The trailing segment.
+     *
+     * \param[in] stream The stream to write the trailing literal text to.
+     * \param[in] n The number of characters that have been written to the stream.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<std::size_t SEGMENT>
+    static auto print_implementation( Output_Stream & stream, std::size_t n ) noexcept -> std::size_t
+    {
+        constexpr auto segment = PARSED.segment( SEGMENT );
+
+        if constexpr ( segment.end != segment.begin ) {
+            put_literal<SEGMENT>( stream );
+        } // if
+
+        return n + ( segment.end - segment.begin );
+    }
+
+    /**
+     * \brief Write a segment's literal text and formatted value to a stream.
+     *
+     * \tparam SEGMENT The segment to write.
+     * \tparam Type The type of value to format.
+     * \tparam Types The types of the remaining values to format.
+     *
+     * \param[in] stream The stream to write to.
+     * \param[in] n The number of characters that have been written to the stream.
+     * \param[in] value The value to format.
+     * \param[in] values The remaining values to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<std::size_t SEGMENT, typename Type, typename... Types>
+    static auto print_implementation( Output_Stream & stream, std::size_t n, Type && value, Types &&... values ) noexcept
+        -> std::size_t
+    {
+        constexpr auto segment = PARSED.segment( SEGMENT );
+
+        if constexpr ( segment.end != segment.begin ) {
+            put_literal<SEGMENT>( stream );
+        } // if
+
+        n += ( segment.end - segment.begin )
+             + print_field<segment.specifier>( stream, static_cast<std::decay_t<Type> const &>( value ) );
+
+        return print_implementation<SEGMENT + 1>( stream, n, std::forward<Types>( values )... );
+    }
+
+    /**
+     * \brief Write the trailing literal text to a stream.
+     *
+     * \tparam SEGMENT The trailing segment.
+     *
+     * \param[in] stream The stream to write the trailing literal text to.
+     * \param[in] n The number of characters that have been written to the stream.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<std::size_t SEGMENT>
+    static auto print_implementation( Fault_Reporting_Output_Stream & stream, std::size_t n ) noexcept
+        -> Result<std::size_t>
+    {
+        constexpr auto segment = PARSED.segment( SEGMENT );
+
+        if constexpr ( segment.end != segment.begin ) {
+            auto result = put_literal<SEGMENT>( stream );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        return n + ( segment.end - segment.begin );
+    }
+
+    /**
+     * \brief Write a segment's literal text and formatted value to a stream.
+     *
+     * \tparam SEGMENT The segment to write.
+     * \tparam Type The type of value to format.
+     * \tparam Types The types of the remaining values to format.
+     *
+     * \param[in] stream The stream to write to.
+     * \param[in] n The number of characters that have been written to the stream.
+     * \param[in] value The value to format.
+     * \param[in] values The remaining values to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<std::size_t SEGMENT, typename Type, typename... Types>
+    static auto print_implementation( Fault_Reporting_Output_Stream & stream, std::size_t n, Type && value, Types &&... values ) noexcept
+        -> Result<std::size_t>
+    {
+        constexpr auto segment = PARSED.segment( SEGMENT );
+
+        if constexpr ( segment.end != segment.begin ) {
+            auto result = put_literal<SEGMENT>( stream );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        auto result = print_field<segment.specifier>(
+            stream, static_cast<std::decay_t<Type> const &>( value ) );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return print_implementation<SEGMENT + 1>(
+            stream, n + ( segment.end - segment.begin ) + result.value(), std::forward<Types>( values )... );
+    }
+};
+
+} // namespace microlibrary::Format
+
+/**
+ * \brief Create a compile-time format string.
+ *
+ * \relatedalso microlibrary::Format::String
+ *
+ * \param[in] format_string The format string literal.
+ *
+ * \return The compile-time format string.
+ */
+#define MICROLIBRARY_FORMAT( format_string )                                     \
+    ( []() noexcept {                                                            \
+        struct Source {                                                          \
+            static constexpr auto string() noexcept -> char const *              \
+            {                                                                    \
+                return format_string;                                            \
+            }                                                                    \
+        };                                                                       \
+                                                                                 \
+        return ::microlibrary::Format::String<Source>{};                         \
+    }() )
 
 #endif // MICROLIBRARY_FORMAT_H
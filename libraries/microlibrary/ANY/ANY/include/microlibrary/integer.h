@@ -65,9 +65,22 @@ constexpr auto highest_bit_set( Integer value ) noexcept -> std::uint_fast8_t
 {
     static_assert( std::is_unsigned_v<Integer> );
 
+#if defined( __GNUC__ )
+    if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>(
+            std::numeric_limits<unsigned int>::digits - 1 - __builtin_clz( value ) );
+    } else if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned long>::digits ) {
+        return static_cast<std::uint_fast8_t>(
+            std::numeric_limits<unsigned long>::digits - 1 - __builtin_clzl( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>(
+            std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll( value ) );
+    } // else
+#else  // defined( __GNUC__ )
     auto bit = std::uint_fast8_t{ 0 };
     for ( ; value >>= 1; ++bit ) {} // for
     return bit;
+#endif // defined( __GNUC__ )
 }
 
 /**
@@ -90,6 +103,45 @@ constexpr auto mask( std::uint_fast8_t size, std::uint_fast8_t bit ) noexcept ->
            << bit;
 }
 
+/**
+ * \brief Reverse the order of an unsigned integer's bytes.
+ *
+ * \tparam Integer The type of unsigned integer the byte swap will be performed on.
+ *
+ * \param[in] value The unsigned integer value to byte swap.
+ *
+ * \return The byte swapped unsigned integer value.
+ */
+template<typename Integer>
+constexpr auto byte_swap( Integer value ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+    static_assert( std::numeric_limits<Integer>::digits % 8 == 0 );
+
+    if constexpr ( std::numeric_limits<Integer>::digits == 8 ) {
+        return value;
+    } else {
+#if defined( __GNUC__ )
+        if constexpr ( std::numeric_limits<Integer>::digits == 16 ) {
+            return __builtin_bswap16( value );
+        } else if constexpr ( std::numeric_limits<Integer>::digits == 32 ) {
+            return __builtin_bswap32( value );
+        } else {
+            static_assert( std::numeric_limits<Integer>::digits == 64 );
+
+            return __builtin_bswap64( value );
+        } // else
+#else  // defined( __GNUC__ )
+        auto result = Integer{ 0 };
+        for ( auto byte = 0; byte < std::numeric_limits<Integer>::digits / 8; ++byte ) {
+            result = static_cast<Integer>( ( result << 8 ) | ( value & 0xFF ) );
+            value >>= 8;
+        } // for
+        return result;
+#endif // defined( __GNUC__ )
+    } // else
+}
+
 /**
  * \brief Reflect an unsigned integer's bits.
  *
@@ -104,16 +156,30 @@ constexpr auto reflect( Integer value ) noexcept -> Integer
 {
     static_assert( std::is_unsigned_v<Integer> );
 
-    auto result = value;
-    value >>= 1;
-    auto remaining_shifts = std::numeric_limits<Integer>::digits - 1;
-    while ( value ) {
-        result <<= 1;
-        result |= value & 0b1;
-        value >>= 1;
-        --remaining_shifts;
-    } // while
-    return result << remaining_shifts;
+#if defined( __clang__ )
+    if constexpr ( std::numeric_limits<Integer>::digits == 8 ) {
+        return __builtin_bitreverse8( value );
+    } else if constexpr ( std::numeric_limits<Integer>::digits == 16 ) {
+        return __builtin_bitreverse16( value );
+    } else if constexpr ( std::numeric_limits<Integer>::digits == 32 ) {
+        return __builtin_bitreverse32( value );
+    } else {
+        static_assert( std::numeric_limits<Integer>::digits == 64 );
+
+        return __builtin_bitreverse64( value );
+    } // else
+#else  // defined( __clang__ )
+    constexpr auto NIBBLES = static_cast<Integer>( std::numeric_limits<Integer>::max() / 0x11 );
+    constexpr auto PAIRS   = static_cast<Integer>( std::numeric_limits<Integer>::max() / 0x05 );
+    constexpr auto BITS    = static_cast<Integer>( std::numeric_limits<Integer>::max() / 0x03 );
+
+    value = byte_swap( value );
+    value = static_cast<Integer>( ( ( value >> 4 ) & NIBBLES ) | ( ( value & NIBBLES ) << 4 ) );
+    value = static_cast<Integer>( ( ( value >> 2 ) & PAIRS ) | ( ( value & PAIRS ) << 2 ) );
+    value = static_cast<Integer>( ( ( value >> 1 ) & BITS ) | ( ( value & BITS ) << 1 ) );
+
+    return value;
+#endif // defined( __clang__ )
 }
 
 /**
@@ -134,6 +200,121 @@ constexpr auto is_power_of_two( Integer value ) noexcept -> bool
     return value != 0 and ( value & ( value - 1 ) ) == 0;
 }
 
+/**
+ * \brief Count the number of bits set in an unsigned integer.
+ *
+ * \tparam Integer The type of unsigned integer the count will be performed on.
+ *
+ * \param[in] value The unsigned integer value to perform the count on.
+ *
+ * \return The number of bits set in the unsigned integer value.
+ */
+template<typename Integer>
+constexpr auto popcount( Integer value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+#if defined( __GNUC__ )
+    if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_popcount( value ) );
+    } else if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned long>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_popcountl( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_popcountll( value ) );
+    } // else
+#else  // defined( __GNUC__ )
+    auto count = std::uint_fast8_t{ 0 };
+    for ( ; value; value &= value - 1 ) { ++count; } // for
+    return count;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Count the number of consecutive bits that are not set in an unsigned integer,
+ *        starting from the least significant bit.
+ *
+ * \tparam Integer The type of unsigned integer the count will be performed on.
+ *
+ * \param[in] value The unsigned integer value to perform the count on.
+ *
+ * \return The number of consecutive bits that are not set in the unsigned integer value,
+ *         starting from the least significant bit (the number of bits in the unsigned
+ *         integer type if value is zero).
+ */
+template<typename Integer>
+constexpr auto countr_zero( Integer value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    if ( not value ) {
+        return std::numeric_limits<Integer>::digits;
+    } // if
+
+#if defined( __GNUC__ )
+    if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_ctz( value ) );
+    } else if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned long>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_ctzl( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_ctzll( value ) );
+    } // else
+#else  // defined( __GNUC__ )
+    auto count = std::uint_fast8_t{ 0 };
+    for ( ; not( value & 0b1 ); value >>= 1 ) { ++count; } // for
+    return count;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Rotate an unsigned integer's bits to the left.
+ *
+ * \tparam Integer The type of unsigned integer the rotation will be performed on.
+ *
+ * \param[in] value The unsigned integer value to rotate.
+ * \param[in] shift The number of bit positions to rotate the unsigned integer value by.
+ *
+ * \return The rotated unsigned integer value.
+ */
+template<typename Integer>
+constexpr auto rotl( Integer value, std::uint_fast8_t shift ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    shift %= std::numeric_limits<Integer>::digits;
+
+    if ( not shift ) {
+        return value;
+    } // if
+
+    return static_cast<Integer>(
+        ( value << shift ) | ( value >> ( std::numeric_limits<Integer>::digits - shift ) ) );
+}
+
+/**
+ * \brief Rotate an unsigned integer's bits to the right.
+ *
+ * \tparam Integer The type of unsigned integer the rotation will be performed on.
+ *
+ * \param[in] value The unsigned integer value to rotate.
+ * \param[in] shift The number of bit positions to rotate the unsigned integer value by.
+ *
+ * \return The rotated unsigned integer value.
+ */
+template<typename Integer>
+constexpr auto rotr( Integer value, std::uint_fast8_t shift ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    shift %= std::numeric_limits<Integer>::digits;
+
+    if ( not shift ) {
+        return value;
+    } // if
+
+    return static_cast<Integer>(
+        ( value >> shift ) | ( value << ( std::numeric_limits<Integer>::digits - shift ) ) );
+}
+
 } // namespace microlibrary
 
 #endif // MICROLIBRARY_INTEGER_H
@@ -0,0 +1,285 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log interface.
+ */
+
+#ifndef MICROLIBRARY_LOG_H
+#define MICROLIBRARY_LOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "microlibrary/array.h"
+#include "microlibrary/format.h"
+#include "microlibrary/integer.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+/**
+ * \brief Deferred (binary) logging facilities.
+ *
+ * Instead of formatting text on the device, a binary log record containing a format string
+ * ID followed by the raw (little endian) bytes of each argument is written. The format
+ * string is only used at compile time to compute the format string ID, so it is not
+ * stored in the device's image. Records are converted back to text on a host using
+ * microlibrary::Log_Decoder.
+ */
+namespace microlibrary::Log {
+
+/**
+ * \brief Format string ID.
+ */
+using ID = std::uint32_t;
+
+/**
+ * \brief Get the type code of a binary log argument type.
+ *
+ * \tparam T The binary log argument type (must be an integer type other than bool).
+ *
+ * \return The type code of the binary log argument type.
+ */
+template<typename T>
+constexpr auto type_code() noexcept -> char
+{
+    static_assert(
+        std::is_integral_v<T> and not std::is_same_v<T, bool>,
+        "binary log arguments must be integers" );
+
+    if constexpr ( std::is_same_v<T, char> ) {
+        return 'c';
+    } else if constexpr ( sizeof( T ) == 1 ) {
+        return std::is_signed_v<T> ? 'b' : 'B';
+    } else if constexpr ( sizeof( T ) == 2 ) {
+        return std::is_signed_v<T> ? 'h' : 'H';
+    } else if constexpr ( sizeof( T ) == 4 ) {
+        return std::is_signed_v<T> ? 'i' : 'I';
+    } else {
+        static_assert( sizeof( T ) == 8 );
+
+        return std::is_signed_v<T> ? 'q' : 'Q';
+    } // else
+}
+
+/**
+ * \brief Compute a format string ID.
+ *
+ * The format string ID is the 32-bit FNV-1a hash of the format string, a null character,
+ * and the argument type codes.
+ *
+ * \tparam Types The argument types.
+ *
+ * \param[in] format The null-terminated format string.
+ *
+ * \return The format string ID.
+ */
+template<typename... Types>
+constexpr auto id( char const * format ) noexcept -> ID
+{
+    constexpr auto OFFSET_BASIS = ID{ 2166136261 };
+    constexpr auto PRIME        = ID{ 16777619 };
+
+    auto hash = OFFSET_BASIS;
+
+    auto const accumulate = [ &hash ]( char character ) noexcept {
+        hash = static_cast<ID>( ( hash ^ static_cast<std::uint8_t>( character ) ) * PRIME );
+    };
+
+    for ( ; *format; ++format ) {
+        accumulate( *format );
+    } // for
+
+    accumulate( '\0' );
+
+    ( accumulate( type_code<std::decay_t<Types>>() ), ... );
+
+    return hash;
+}
+
+/**
+ * \brief Binary log record.
+ *
+ * \tparam Types The argument types.
+ */
+template<typename... Types>
+using Record = Array<std::uint8_t, sizeof( ID ) + ( sizeof( Types ) + ... + 0 )>;
+
+/**
+ * \brief Serialize an integer (little endian).
+ *
+ * \tparam Integer The type of integer to serialize.
+ *
+ * \param[in] integer The integer to serialize.
+ * \param[out] i The position to write the serialized integer to.
+ *
+ * \return The position after the serialized integer.
+ */
+template<typename Integer>
+constexpr auto serialize( Integer integer, std::uint8_t * i ) noexcept -> std::uint8_t *
+{
+    auto unsigned_integer = to_unsigned( integer );
+
+    for ( auto byte = std::size_t{ 0 }; byte < sizeof( Integer ); ++byte ) {
+        *i = static_cast<std::uint8_t>( unsigned_integer );
+
+        ++i;
+
+        if constexpr ( sizeof( Integer ) > 1 ) {
+            unsigned_integer >>= 8;
+        } // if
+    }     // for
+
+    return i;
+}
+
+/**
+ * \brief Create a binary log record.
+ *
+ * \tparam Source The compile-time format string's source.
+ * \tparam Types The argument types.
+ *
+ * \param[in] values The arguments.
+ *
+ * \return The binary log record.
+ */
+template<typename Source, typename... Types>
+constexpr auto record( Format::String<Source>, Types... values ) noexcept -> Record<Types...>
+{
+    constexpr auto PARSED = Format::Parsed_String<Format::string_length( Source::string() )>{
+        Source::string()
+    };
+
+    static_assert( PARSED.is_valid(), "invalid format string" );
+    static_assert(
+        PARSED.fields() == sizeof...( Types ),
+        "format string replacement field count does not match argument count" );
+
+    constexpr auto FORMAT_STRING_ID = id<Types...>( Source::string() );
+
+    Record<Types...> log_record{};
+
+    [[maybe_unused]] auto i = serialize( FORMAT_STRING_ID, log_record.data() );
+
+    ( ( i = serialize( values, i ) ), ... );
+
+    return log_record;
+}
+
+/**
+ * \brief Write a binary log record to a stream.
+ *
+ * \pre microlibrary::Stream::is_nominal()
+ *
+ * \tparam Source The compile-time format string's source.
+ * \tparam Types The argument types (must be integer types).
+ *
+ * \param[in] stream The stream to write the binary log record to.
+ * \param[in] format The compile-time format string (see MICROLIBRARY_FORMAT()).
+ * \param[in] values The arguments.
+ */
+template<typename Source, typename... Types>
+void write( Output_Stream & stream, Format::String<Source> format, Types... values ) noexcept
+{
+    auto const log_record = record( format, values... );
+
+    stream.put( log_record.begin(), log_record.end() );
+}
+
+/**
+ * \brief Write a binary log record to a stream.
+ *
+ * \pre microlibrary::Stream::is_nominal()
+ *
+ * \tparam Source The compile-time format string's source.
+ * \tparam Types The argument types (must be integer types).
+ *
+ * \param[in] stream The stream to write the binary log record to.
+ * \param[in] format The compile-time format string (see MICROLIBRARY_FORMAT()).
+ * \param[in] values The arguments.
+ *
+ * \return Nothing if writing the binary log record to the stream succeeded.
+ * \return An error code if writing the binary log record to the stream failed.
+ */
+template<typename Source, typename... Types>
+auto write( Fault_Reporting_Output_Stream & stream, Format::String<Source> format, Types... values ) noexcept
+    -> Result<void>
+{
+    auto const log_record = record( format, values... );
+
+    return stream.put( log_record.begin(), log_record.end() );
+}
+
+/**
+ * \brief Binary log message.
+ *
+ * Binds a format string to its argument types so that a single definition (e.g. in a
+ * header shared by the device code and the host code that decodes its binary log) can be
+ * used to write records (see write()) and to add the format string to a
+ * microlibrary::Log_Decoder (see microlibrary::Log_Decoder::add()). Messages are defined
+ * by deriving from this class and defining a constexpr static member function named
+ * string() that returns the null-terminated format string:
+ * \code
+ * struct Temperature : ::microlibrary::Log::Message<Temperature, std::int16_t> {
+ *     static constexpr auto string() noexcept -> char const *
+ *     {
+ *         return "temperature={}";
+ *     }
+ * };
+ * \endcode
+ *
+ * \tparam Source The message (must define string()).
+ * \tparam Types The argument types (must be integer types).
+ */
+template<typename Source, typename... Types>
+class Message {
+  public:
+    /**
+     * \brief Write a binary log record to a stream.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] stream The stream to write the binary log record to.
+     * \param[in] values The arguments.
+     */
+    static void write( Output_Stream & stream, Types... values ) noexcept
+    {
+        Log::write( stream, Format::String<Source>{}, values... );
+    }
+
+    /**
+     * \brief Write a binary log record to a stream.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] stream The stream to write the binary log record to.
+     * \param[in] values The arguments.
+     *
+     * \return Nothing if writing the binary log record to the stream succeeded.
+     * \return An error code if writing the binary log record to the stream failed.
+     */
+    static auto write( Fault_Reporting_Output_Stream & stream, Types... values ) noexcept -> Result<void>
+    {
+        return Log::write( stream, Format::String<Source>{}, values... );
+    }
+};
+
+} // namespace microlibrary::Log
+
+#endif // MICROLIBRARY_LOG_H
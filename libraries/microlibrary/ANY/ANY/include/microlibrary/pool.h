@@ -0,0 +1,407 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Pool interface.
+ */
+
+#ifndef MICROLIBRARY_POOL_H
+#define MICROLIBRARY_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "microlibrary/error.h"
+#include "microlibrary/precondition.h"
+#include "microlibrary/result.h"
+
+namespace microlibrary {
+
+/**
+ * \brief No locking pool lock policy (the pool must only be used from a single execution
+ *        context).
+ */
+struct No_Pool_Lock {
+};
+
+/**
+ * \brief Fixed-block object pool.
+ *
+ * Objects are allocated from, and freed back to, a fixed number of blocks in O(1) time
+ * using an intrusive free list (free blocks store the handle of the next free block). An
+ * allocated object is identified by a handle, which uses the smallest unsigned integer
+ * type that can identify every block in the pool and the null handle (std::uint8_t for
+ * pools of up to 254 objects).
+ *
+ * Blocks that have never been allocated are handed out in order when the free list is
+ * empty, so constructing a pool does not need to link the blocks into the free list.
+ *
+ * \attention Objects that have not been freed when the pool is destroyed are not
+ *            destroyed.
+ *
+ * \tparam T The pool object type.
+ * \tparam N The pool capacity.
+ * \tparam Lock The pool lock policy. If the pool is shared between execution contexts
+ *         (e.g. the main loop and an interrupt service routine), this must be a
+ *         default constructible guard type that prevents the other execution contexts
+ *         from using the pool for its lifetime (e.g. by disabling interrupts when
+ *         constructed and restoring the interrupt enable state when destroyed).
+ *         Otherwise, microlibrary::No_Pool_Lock.
+ */
+template<typename T, std::size_t N, typename Lock = No_Pool_Lock>
+class Pool {
+  public:
+    static_assert( N > 0 );
+    static_assert( N < UINT32_MAX );
+
+    /**
+     * \brief The pool object type.
+     */
+    using Value = T;
+
+    /**
+     * \brief A number of pool objects.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A pool object handle.
+     */
+    using Handle = std::conditional_t<N < UINT8_MAX, std::uint8_t, std::conditional_t<N < UINT16_MAX, std::uint16_t, std::uint32_t>>;
+
+    /**
+     * \brief A reference to a pool object.
+     */
+    using Reference = Value &;
+
+    /**
+     * \brief A reference to a const pool object.
+     */
+    using Const_Reference = Value const &;
+
+    /**
+     * \brief A pointer to a pool object.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const pool object.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief A handle that is never returned by microlibrary::Pool::allocate().
+     */
+    static constexpr auto NULL_HANDLE = static_cast<Handle>( N );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Pool() noexcept = default;
+
+    Pool( Pool && ) = delete;
+
+    Pool( Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Pool() noexcept = default;
+
+    auto operator=( Pool && ) = delete;
+
+    auto operator=( Pool const & ) = delete;
+
+    /**
+     * \brief Get the pool's capacity.
+     *
+     * \return The pool's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if no objects are allocated from the pool.
+     *
+     * \return true if no objects are allocated from the pool.
+     * \return false if objects are allocated from the pool.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * \brief Check if all of the pool's objects are allocated.
+     *
+     * \return true if all of the pool's objects are allocated.
+     * \return false if not all of the pool's objects are allocated.
+     */
+    auto full() const noexcept -> bool
+    {
+        return size() == N;
+    }
+
+    /**
+     * \brief Get the number of objects allocated from the pool.
+     *
+     * \return The number of objects allocated from the pool.
+     */
+    auto size() const noexcept -> Size
+    {
+        [[maybe_unused]] auto const lock = Lock{};
+
+        return m_size;
+    }
+
+    /**
+     * \brief Get the number of objects that can be allocated from the pool.
+     *
+     * \return The number of objects that can be allocated from the pool.
+     */
+    auto available() const noexcept -> Size
+    {
+        return N - size();
+    }
+
+    /**
+     * \brief Get the largest number of objects that have been allocated from the pool at
+     *        the same time since the pool's statistics were last reset.
+     *
+     * \return The largest number of objects that have been allocated from the pool at the
+     *         same time since the pool's statistics were last reset.
+     */
+    auto high_water_mark() const noexcept -> Size
+    {
+        [[maybe_unused]] auto const lock = Lock{};
+
+        return m_high_water_mark;
+    }
+
+    /**
+     * \brief Get the number of allocations that have failed since the pool's statistics
+     *        were last reset.
+     *
+     * \return The number of allocations that have failed since the pool's statistics were
+     *         last reset.
+     */
+    auto failed_allocations() const noexcept -> Size
+    {
+        [[maybe_unused]] auto const lock = Lock{};
+
+        return m_failed_allocations;
+    }
+
+    /**
+     * \brief Reset the pool's statistics.
+     */
+    void reset_statistics() noexcept
+    {
+        [[maybe_unused]] auto const lock = Lock{};
+
+        m_high_water_mark    = m_size;
+        m_failed_allocations = 0;
+    }
+
+    /**
+     * \brief Allocate an object from the pool.
+     *
+     * \tparam Arguments The types of the arguments to use to construct the object.
+     *
+     * \param[in] arguments The arguments to use to construct the object.
+     *
+     * \return The handle of the allocated object if the allocation succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if all of the pool's objects are
+     *         allocated.
+     */
+    template<typename... Arguments>
+    auto allocate( Arguments &&... arguments ) noexcept -> Result<Handle>
+    {
+        auto handle = NULL_HANDLE;
+
+        {
+            [[maybe_unused]] auto const lock = Lock{};
+
+            if ( m_free != NULL_HANDLE ) {
+                handle = m_free;
+                m_free = m_blocks[ handle ].next;
+            } else if ( m_unused < N ) {
+                handle = m_unused++;
+            } else {
+                ++m_failed_allocations;
+
+                return Generic_Error::WOULD_OVERFLOW;
+            } // else
+
+            if ( ++m_size > m_high_water_mark ) {
+                m_high_water_mark = m_size;
+            } // if
+        }
+
+        new ( &m_blocks[ handle ].value ) Value( std::forward<Arguments>( arguments )... );
+
+        return handle;
+    }
+
+    /**
+     * \brief Free an object back to the pool.
+     *
+     * \param[in] handle The handle of the object to free.
+     *
+     * \pre handle < microlibrary::Pool::capacity()
+     * \pre The object identified by handle is allocated.
+     */
+    void free( Handle handle ) noexcept
+    {
+        MICROLIBRARY_EXPECT( handle < N, Generic_Error::OUT_OF_RANGE );
+
+        m_blocks[ handle ].value.~Value();
+
+        [[maybe_unused]] auto const lock = Lock{};
+
+        m_blocks[ handle ].next = m_free;
+        m_free                  = handle;
+
+        --m_size;
+    }
+
+    /**
+     * \brief Access an allocated object.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] handle The handle of the object to access.
+     *
+     * \return The object identified by the handle.
+     */
+    auto operator[]( Handle handle ) noexcept -> Reference
+    {
+        return m_blocks[ handle ].value;
+    }
+
+    /**
+     * \brief Access an allocated object.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] handle The handle of the object to access.
+     *
+     * \return The object identified by the handle.
+     */
+    auto operator[]( Handle handle ) const noexcept -> Const_Reference
+    {
+        return m_blocks[ handle ].value;
+    }
+
+    /**
+     * \brief Get the handle of an allocated object.
+     *
+     * \param[in] object The object whose handle is to be gotten.
+     *
+     * \pre object is an object allocated from the pool.
+     *
+     * \return The handle of the object.
+     */
+    auto handle( Const_Pointer object ) const noexcept -> Handle
+    {
+        auto const block = reinterpret_cast<Block const *>( object );
+
+        MICROLIBRARY_EXPECT( block >= &m_blocks[ 0 ] and block < &m_blocks[ 0 ] + N, Generic_Error::OUT_OF_RANGE );
+
+        return static_cast<Handle>( block - &m_blocks[ 0 ] );
+    }
+
+  private:
+    /**
+     * \brief A pool block.
+     */
+    union Block {
+        /**
+         * \brief Constructor.
+         */
+        constexpr Block() noexcept : next{ 0 }
+        {
+        }
+
+        Block( Block && ) = delete;
+
+        Block( Block const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Block() noexcept
+        {
+        }
+
+        auto operator=( Block && ) = delete;
+
+        auto operator=( Block const & ) = delete;
+
+        /**
+         * \brief The allocated object.
+         */
+        Value value;
+
+        /**
+         * \brief The handle of the next free block (if the block is free).
+         */
+        Handle next;
+    };
+
+    /**
+     * \brief The pool's blocks.
+     */
+    Block m_blocks[ N ];
+
+    /**
+     * \brief The handle of the first free block.
+     */
+    Handle m_free{ NULL_HANDLE };
+
+    /**
+     * \brief The handle of the first block that has never been allocated.
+     */
+    Handle m_unused{ 0 };
+
+    /**
+     * \brief The number of objects allocated from the pool.
+     */
+    Handle m_size{ 0 };
+
+    /**
+     * \brief The largest number of objects that have been allocated from the pool at the
+     *        same time since the pool's statistics were last reset.
+     */
+    Handle m_high_water_mark{ 0 };
+
+    /**
+     * \brief The number of allocations that have failed since the pool's statistics were
+     *        last reset.
+     */
+    Size m_failed_allocations{ 0 };
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_POOL_H
@@ -23,8 +23,14 @@
 #ifndef MICROLIBRARY_REGISTER_H
 #define MICROLIBRARY_REGISTER_H
 
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <type_traits>
 
+#include "microlibrary/enum.h"
+#include "microlibrary/integer.h"
+
 #if MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
 #include "microlibrary/testing/automated/register.h"
 #endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
@@ -289,6 +295,523 @@ class MICROLIBRARY_PACKED_REGISTER Write_Only_Register {
 };
 #endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
 
+/**
+ * \brief Register transaction (shadow register).
+ *
+ * A register transaction stages updates to a register in a local copy of the register's
+ * contents, and writes the staged contents to the register when the transaction is
+ * committed. This allows multiple field updates to be performed with a single register
+ * read and a single register write instead of a read-modify-write per update.
+ *
+ * \attention A transaction is not committed when it is destroyed.
+ *
+ * \tparam Register_Type The type of register the transaction stages updates to (e.g.
+ *         microlibrary::Register).
+ */
+template<typename Register_Type>
+class Register_Transaction {
+  public:
+    /**
+     * \brief The register's underlying integer type.
+     */
+    using Type = typename Register_Type::Type;
+
+    static_assert( std::is_integral_v<Type> );
+
+    Register_Transaction() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] reg The register to stage updates to. The register is read once to
+     *            initialize the transaction.
+     */
+    explicit Register_Transaction( Register_Type & reg ) noexcept :
+        m_register{ &reg },
+        m_value{ static_cast<Type>( reg ) }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] reg The register to stage updates to. The register is not read.
+     * \param[in] value The value to initialize the transaction with.
+     */
+    constexpr Register_Transaction( Register_Type & reg, Type value ) noexcept :
+        m_register{ &reg },
+        m_value{ value }
+    {
+    }
+
+    Register_Transaction( Register_Transaction && ) = delete;
+
+    Register_Transaction( Register_Transaction const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Register_Transaction() noexcept = default;
+
+    auto operator=( Register_Transaction && ) = delete;
+
+    auto operator=( Register_Transaction const & ) = delete;
+
+    /**
+     * \brief Get the staged register contents.
+     *
+     * \return The staged register contents.
+     */
+    constexpr auto value() const noexcept -> Type
+    {
+        return m_value;
+    }
+
+    /**
+     * \brief Get the staged register contents.
+     *
+     * \return The staged register contents.
+     */
+    constexpr operator Type() const noexcept
+    {
+        return m_value;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to assign to the staged register contents.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Type expression ) noexcept -> Register_Transaction &
+    {
+        m_value = expression;
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise AND assignment operator.
+     *
+     * \param[in] expression The expression to bitwise AND into the staged register
+     *            contents.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator&=( Type expression ) noexcept -> Register_Transaction &
+    {
+        m_value &= expression;
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise OR assignment operator.
+     *
+     * \param[in] expression The expression to bitwise OR into the staged register
+     *            contents.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator|=( Type expression ) noexcept -> Register_Transaction &
+    {
+        m_value |= expression;
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise XOR assignment operator.
+     *
+     * \param[in] expression The expression to bitwise XOR into the staged register
+     *            contents.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator^=( Type expression ) noexcept -> Register_Transaction &
+    {
+        m_value ^= expression;
+
+        return *this;
+    }
+
+    /**
+     * \brief Replace a field in the staged register contents.
+     *
+     * \param[in] mask The field's bit mask (e.g. a value from a peripheral register
+     *            information's Mask table).
+     * \param[in] value The field's new value (already shifted into position). Bits
+     *            outside of the field's bit mask are ignored.
+     *
+     * \return The modified object.
+     */
+    constexpr auto modify( Type mask, Type value ) noexcept -> Register_Transaction &
+    {
+        m_value = static_cast<Type>( ( m_value & ~mask ) | ( value & mask ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Set bits in the staged register contents.
+     *
+     * \param[in] mask The bit mask of the bits to set.
+     *
+     * \return The modified object.
+     */
+    constexpr auto set( Type mask ) noexcept -> Register_Transaction &
+    {
+        m_value |= mask;
+
+        return *this;
+    }
+
+    /**
+     * \brief Clear bits in the staged register contents.
+     *
+     * \param[in] mask The bit mask of the bits to clear.
+     *
+     * \return The modified object.
+     */
+    constexpr auto clear( Type mask ) noexcept -> Register_Transaction &
+    {
+        m_value = static_cast<Type>( m_value & ~mask );
+
+        return *this;
+    }
+
+    /**
+     * \brief Write the staged register contents to the register.
+     */
+    void commit() noexcept
+    {
+        *m_register = m_value;
+    }
+
+  private:
+    /**
+     * \brief The register to stage updates to.
+     */
+    Register_Type * m_register;
+
+    /**
+     * \brief The staged register contents.
+     */
+    Type m_value;
+};
+
+/**
+ * \brief Register field value (the result of assigning a value to a
+ *        microlibrary::Field).
+ *
+ * \tparam Field_Type The field the value is for.
+ */
+template<typename Field_Type>
+class Field_Value {
+  public:
+    /**
+     * \brief The field's register's underlying integer type.
+     */
+    using Type = typename Field_Type::Type;
+
+    Field_Value() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] bits The field value's bits (shifted into position).
+     */
+    constexpr explicit Field_Value( Type bits ) noexcept : m_bits{ bits }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Field_Value( Field_Value && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Field_Value( Field_Value const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Field_Value() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Field_Value && expression ) noexcept -> Field_Value & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Field_Value const & expression ) noexcept -> Field_Value & = default;
+
+    /**
+     * \brief Get the field value's bits.
+     *
+     * \return The field value's bits (shifted into position).
+     */
+    constexpr auto bits() const noexcept -> Type
+    {
+        return m_bits;
+    }
+
+  private:
+    /**
+     * \brief The field value's bits (shifted into position).
+     */
+    Type m_bits;
+};
+
+/**
+ * \brief Register field descriptor.
+ *
+ * Field descriptors fold a field's bit position and size into a compile-time bit mask so
+ * that drivers do not need to hand-compose shifts and masks. Multiple fields in the same
+ * register can be updated with a single read-modify-write using microlibrary::set():
+ * \code
+ * set( clkctrl->mclkctrlb, CLKCTRL::MCLKCTRLB::Field::PDIV = CLKCTRL::MCLKCTRLB::PDIV_DIV4, CLKCTRL::MCLKCTRLB::Field::PEN = true );
+ * \endcode
+ *
+ * If Value_Type is an enum, the enum's values are the field's bits shifted into position
+ * (this matches the peripheral register information field value enums, e.g.
+ * CLKCTRL::MCLKCTRLB::PDIV). Otherwise, values are the field's bits shifted to bit 0.
+ *
+ * \tparam Register_Type The type of register the field is in (e.g.
+ *         microlibrary::Register).
+ * \tparam BIT The bit position of the field's least significant bit.
+ * \tparam SIZE The size of the field (the number of bits in the field).
+ * \tparam Value_Type The field's value type.
+ */
+template<typename Register_Type, std::uint_fast8_t BIT, std::uint_fast8_t SIZE, typename Value_Type = typename Register_Type::Type>
+class Field {
+  public:
+    /**
+     * \brief The type of register the field is in.
+     */
+    using Register = Register_Type;
+
+    /**
+     * \brief The field's register's underlying integer type.
+     */
+    using Type = typename Register_Type::Type;
+
+    /**
+     * \brief The field's value type.
+     */
+    using Value = Value_Type;
+
+    static_assert( std::is_unsigned_v<Type> );
+    static_assert( SIZE > 0 and BIT + SIZE <= std::numeric_limits<Type>::digits );
+    static_assert( std::is_integral_v<Value> or std::is_enum_v<Value> );
+
+    /**
+     * \brief The field's bit mask.
+     */
+    static constexpr auto MASK = mask<Type>( SIZE, BIT );
+
+    /**
+     * \brief Convert a field value to the field's bits (shifted into position).
+     *
+     * \param[in] value The field value to convert. Bits that do not fit in the field are
+     *            ignored.
+     *
+     * \return The field's bits (shifted into position).
+     */
+    static constexpr auto encode( Value value ) noexcept -> Type
+    {
+        if constexpr ( std::is_enum_v<Value> ) {
+            return static_cast<Type>( to_underlying( value ) & MASK );
+        } else {
+            return static_cast<Type>( ( static_cast<Type>( value ) << BIT ) & MASK );
+        } // else
+    }
+
+    /**
+     * \brief Extract a field value from register contents.
+     *
+     * \param[in] contents The register contents to extract the field value from.
+     *
+     * \return The field value.
+     */
+    static constexpr auto decode( Type contents ) noexcept -> Value
+    {
+        if constexpr ( std::is_enum_v<Value> ) {
+            return static_cast<Value>( contents & MASK );
+        } else {
+            return static_cast<Value>( ( contents & MASK ) >> BIT );
+        } // else
+    }
+
+    /**
+     * \brief Read the field (one register read).
+     *
+     * \param[in] reg The register to read the field from.
+     *
+     * \return The field value.
+     */
+    static auto read( Register_Type const & reg ) noexcept -> Value
+    {
+        return decode( static_cast<Type>( reg ) );
+    }
+
+    /**
+     * \brief Write the field (one register write, all other bits in the register are
+     *        cleared).
+     *
+     * \param[in] reg The register to write the field to.
+     * \param[in] value The field value to write.
+     */
+    static void write( Register_Type & reg, Value value ) noexcept
+    {
+        reg = encode( value );
+    }
+
+    /**
+     * \brief Modify the field (one register read and one register write, all other bits
+     *        in the register are preserved).
+     *
+     * \param[in] reg The register to modify the field in.
+     * \param[in] value The field value to write.
+     */
+    static void modify( Register_Type & reg, Value value ) noexcept
+    {
+        auto transaction = Register_Transaction{ reg };
+
+        transaction.modify( MASK, encode( value ) );
+
+        transaction.commit();
+    }
+
+    /**
+     * \brief Create a field value for use with microlibrary::set() or
+     *        microlibrary::write().
+     *
+     * \param[in] value The field value.
+     *
+     * \return The field value.
+     */
+    constexpr auto operator=( Value value ) const noexcept -> Field_Value<Field>
+    {
+        return Field_Value<Field>{ encode( value ) };
+    }
+};
+
+namespace Implementation {
+
+/**
+ * \brief Check if a set of fields are all in a register of a specific type and do not
+ *        overlap.
+ *
+ * \tparam Register_Type The register type.
+ * \tparam Fields The fields to check.
+ *
+ * \return true if the fields are all in a register of the specified type and do not
+ *         overlap.
+ * \return false if any of the fields are not in a register of the specified type, or if
+ *         any of the fields overlap.
+ */
+template<typename Register_Type, typename... Fields>
+constexpr auto fields_are_valid() noexcept -> bool
+{
+    if constexpr ( not( std::is_same_v<typename Fields::Register, Register_Type> and ... ) ) {
+        return false;
+    } else {
+        using Type = typename Register_Type::Type;
+
+        auto mask = Type{ 0 };
+        for ( auto const field_mask : { Fields::MASK... } ) {
+            if ( mask & field_mask ) {
+                return false;
+            } // if
+
+            mask |= field_mask;
+        } // for
+
+        return true;
+    } // else
+}
+
+} // namespace Implementation
+
+/**
+ * \brief Stage field updates in a register transaction.
+ *
+ * \tparam Register_Type The type of register the transaction stages updates to.
+ * \tparam Fields The fields to update.
+ *
+ * \param[in] transaction The register transaction to stage the field updates in.
+ * \param[in] values The field values to stage.
+ */
+template<typename Register_Type, typename... Fields>
+constexpr void set( Register_Transaction<Register_Type> & transaction, Field_Value<Fields>... values ) noexcept
+{
+    static_assert( sizeof...( Fields ) > 0 );
+    static_assert( Implementation::fields_are_valid<Register_Type, Fields...>() );
+
+    using Type = typename Register_Type::Type;
+
+    transaction.modify( static_cast<Type>( ( Fields::MASK | ... ) ), static_cast<Type>( ( values.bits() | ... ) ) );
+}
+
+/**
+ * \brief Update fields in a register (one register read and one register write, all
+ *        other bits in the register are preserved).
+ *
+ * \tparam Register_Type The register type.
+ * \tparam Fields The fields to update.
+ *
+ * \param[in] reg The register to update the fields in.
+ * \param[in] values The field values to write.
+ */
+template<typename Register_Type, typename... Fields>
+void set( Register_Type & reg, Field_Value<Fields>... values ) noexcept
+{
+    auto transaction = Register_Transaction{ reg };
+
+    set( transaction, values... );
+
+    transaction.commit();
+}
+
+/**
+ * \brief Write fields to a register (one register write, all other bits in the register
+ *        are cleared).
+ *
+ * \tparam Register_Type The register type.
+ * \tparam Fields The fields to write.
+ *
+ * \param[in] reg The register to write the fields to.
+ * \param[in] values The field values to write.
+ */
+template<typename Register_Type, typename... Fields>
+void write( Register_Type & reg, Field_Value<Fields>... values ) noexcept
+{
+    static_assert( sizeof...( Fields ) > 0 );
+    static_assert( Implementation::fields_are_valid<Register_Type, Fields...>() );
+
+    using Type = typename Register_Type::Type;
+
+    reg = static_cast<Type>( ( values.bits() | ... ) );
+}
+
 } // namespace microlibrary
 
 #endif // MICROLIBRARY_REGISTER_H
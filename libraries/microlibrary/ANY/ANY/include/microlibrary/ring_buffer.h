@@ -0,0 +1,354 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Ring_Buffer interface.
+ */
+
+#ifndef MICROLIBRARY_RING_BUFFER_H
+#define MICROLIBRARY_RING_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "microlibrary/array.h"
+#include "microlibrary/error.h"
+#include "microlibrary/integer.h"
+#include "microlibrary/result.h"
+
+#if MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+#include <atomic>
+#endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+
+namespace microlibrary {
+
+/**
+ * \brief Single-producer, single-consumer lock-free ring buffer.
+ *
+ * One execution context (e.g. an interrupt service routine) may push elements while
+ * another execution context (e.g. the main loop) concurrently pops elements without
+ * disabling interrupts.
+ *
+ * \attention Only one execution context may push elements, and only one execution context
+ *            may pop elements.
+ * \attention If the ring buffer is shared between execution contexts, loads and stores of
+ *            microlibrary::Ring_Buffer::Index must be atomic on the target. On 8-bit
+ *            targets, this requires a capacity of 128 elements or less.
+ *
+ * \tparam T The ring buffer element type (must be default constructible).
+ * \tparam N The ring buffer capacity (must be a power of two).
+ */
+template<typename T, std::size_t N>
+class Ring_Buffer {
+  public:
+    static_assert( is_power_of_two( N ) );
+    static_assert( N <= ( std::size_t{ 1 } << 31 ) );
+
+    /**
+     * \brief The ring buffer element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the ring buffer.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A ring buffer index.
+     *
+     * Indices are free running (they are not wrapped at the ring buffer capacity), and
+     * are only wrapped when used to access an element.
+     */
+    using Index = std::conditional_t<
+        N <= 128,
+        std::uint8_t,
+        std::conditional_t<N <= 32768, std::uint16_t, std::uint32_t>>;
+
+    /**
+     * \brief A pointer to a ring buffer element.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const ring buffer element.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Ring_Buffer() noexcept = default;
+
+    Ring_Buffer( Ring_Buffer && ) = delete;
+
+    Ring_Buffer( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Ring_Buffer() noexcept = default;
+
+    auto operator=( Ring_Buffer && ) = delete;
+
+    auto operator=( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the ring buffer's capacity.
+     *
+     * \return The ring buffer's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if the ring buffer is empty.
+     *
+     * \attention If called from an execution context other than the consumer's, the
+     *            result may be stale by the time it is used.
+     *
+     * \return true if the ring buffer is empty.
+     * \return false if the ring buffer is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * \brief Check if the ring buffer is full.
+     *
+     * \attention If called from an execution context other than the producer's, the
+     *            result may be stale by the time it is used.
+     *
+     * \return true if the ring buffer is full.
+     * \return false if the ring buffer is not full.
+     */
+    auto full() const noexcept -> bool
+    {
+        return size() == N;
+    }
+
+    /**
+     * \brief Get the number of elements in the ring buffer.
+     *
+     * \return The number of elements in the ring buffer.
+     */
+    auto size() const noexcept -> Size
+    {
+        return static_cast<Index>( load( m_write_index ) - load( m_read_index ) );
+    }
+
+    /**
+     * \brief Push an element into the ring buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] value The element to push into the ring buffer.
+     *
+     * \return Nothing if the push succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the ring buffer is full.
+     */
+    auto push( Value const & value ) noexcept -> Result<void>
+    {
+        auto const write_index = load( m_write_index );
+
+        if ( static_cast<Index>( write_index - load( m_read_index ) ) == N ) {
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        m_storage[ write_index & MASK ] = value;
+
+        store( m_write_index, static_cast<Index>( write_index + 1 ) );
+
+        return {};
+    }
+
+    /**
+     * \brief Push a block of elements into the ring buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] begin The beginning of the block of elements to push into the ring
+     *            buffer.
+     * \param[in] end The end of the block of elements to push into the ring buffer.
+     *
+     * \return The end of the block of elements that were pushed into the ring buffer. If
+     *         the ring buffer does not have space for the entire block, only the
+     *         beginning of the block is pushed.
+     */
+    auto push( Const_Pointer begin, Const_Pointer end ) noexcept -> Const_Pointer
+    {
+        auto const write_index = load( m_write_index );
+
+        auto const available = static_cast<Size>(
+            N - static_cast<Index>( write_index - load( m_read_index ) ) );
+        auto const requested = static_cast<Size>( end - begin );
+        auto const n         = requested < available ? requested : available;
+
+        auto const offset = static_cast<Size>( write_index & MASK );
+        auto const first  = n < N - offset ? n : N - offset;
+
+        for ( auto i = Size{ 0 }; i < first; ++i ) {
+            m_storage[ offset + i ] = begin[ i ];
+        } // for
+
+        for ( auto i = first; i < n; ++i ) {
+            m_storage[ i - first ] = begin[ i ];
+        } // for
+
+        store( m_write_index, static_cast<Index>( write_index + n ) );
+
+        return begin + n;
+    }
+
+    /**
+     * \brief Pop an element from the ring buffer.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \return The element that was popped from the ring buffer if the pop succeeded.
+     * \return microlibrary::Generic_Error::WOULD_UNDERFLOW if the ring buffer is empty.
+     */
+    auto pop() noexcept -> Result<Value>
+    {
+        auto const read_index = load( m_read_index );
+
+        if ( load( m_write_index ) == read_index ) {
+            return Generic_Error::WOULD_UNDERFLOW;
+        } // if
+
+        auto value = std::move( m_storage[ read_index & MASK ] );
+
+        store( m_read_index, static_cast<Index>( read_index + 1 ) );
+
+        return Result<Value>{ VALUE, std::move( value ) };
+    }
+
+    /**
+     * \brief Pop a block of elements from the ring buffer.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \param[in] begin The beginning of the block to pop elements into.
+     * \param[in] end The end of the block to pop elements into.
+     *
+     * \return The end of the block of elements that were popped from the ring buffer. If
+     *         the ring buffer does not contain enough elements to fill the entire block,
+     *         only the beginning of the block is filled.
+     */
+    auto pop( Pointer begin, Pointer end ) noexcept -> Pointer
+    {
+        auto const read_index = load( m_read_index );
+
+        auto const available = static_cast<Size>(
+            static_cast<Index>( load( m_write_index ) - read_index ) );
+        auto const requested = static_cast<Size>( end - begin );
+        auto const n         = requested < available ? requested : available;
+
+        auto const offset = static_cast<Size>( read_index & MASK );
+        auto const first  = n < N - offset ? n : N - offset;
+
+        for ( auto i = Size{ 0 }; i < first; ++i ) {
+            begin[ i ] = std::move( m_storage[ offset + i ] );
+        } // for
+
+        for ( auto i = first; i < n; ++i ) {
+            begin[ i ] = std::move( m_storage[ i - first ] );
+        } // for
+
+        store( m_read_index, static_cast<Index>( read_index + n ) );
+
+        return begin + n;
+    }
+
+  private:
+    /**
+     * \brief The mask used to convert a free running index to a storage position.
+     */
+    static constexpr auto MASK = static_cast<Index>( N - 1 );
+
+#if MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+    /**
+     * \brief An index shared between the producer and the consumer.
+     */
+    using Shared_Index = std::atomic<Index>;
+#else  // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+    /**
+     * \brief An index shared between the producer and the consumer.
+     */
+    using Shared_Index = Index volatile;
+#endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+
+    /**
+     * \brief The element storage.
+     */
+    Array<Value, N> m_storage{};
+
+    /**
+     * \brief The index of the next element to be pushed (written by the producer).
+     */
+    Shared_Index m_write_index{ 0 };
+
+    /**
+     * \brief The index of the next element to be popped (written by the consumer).
+     */
+    Shared_Index m_read_index{ 0 };
+
+    /**
+     * \brief Load a shared index (acquire).
+     *
+     * \param[in] index The shared index to load.
+     *
+     * \return The loaded index.
+     */
+    static auto load( Shared_Index const & index ) noexcept -> Index
+    {
+#if MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+        return index.load( std::memory_order_acquire );
+#else  // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+        Index const value = index;
+        asm volatile( "" ::: "memory" );
+        return value;
+#endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+    }
+
+    /**
+     * \brief Store a shared index (release).
+     *
+     * \param[in] index The shared index to store to.
+     * \param[in] value The value to store.
+     */
+    static void store( Shared_Index & index, Index value ) noexcept
+    {
+#if MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+        index.store( value, std::memory_order_release );
+#else  // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+        asm volatile( "" ::: "memory" );
+        index = value;
+#endif // MICROLIBRARY_TARGET_IS_DEVELOPMENT_ENVIRONMENT
+    }
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_RING_BUFFER_H
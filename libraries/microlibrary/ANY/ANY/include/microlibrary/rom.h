@@ -72,6 +72,24 @@ using String = char const *;
 #define MICROLIBRARY_ROM_STRING( string ) ( string )
 #endif // !MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
 
+#if !MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+/**
+ * \brief Store a constexpr object with static storage duration in ROM.
+ *
+ * The object's bytes must only be accessed through microlibrary::ROM::String (e.g.
+ * microlibrary::ROM::String{ reinterpret_cast<char const *>( &object ) }).
+ *
+ * A custom HIL can replace this macro with a HIL specific version if MICROLIBRARY_TARGET
+ * is HARDWARE by doing the following:
+ * - Provide a microlibrary-custom library that provides microlibrary/hil/rom.h
+ * - Define MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED to be a value that will be evaluated as
+ *   true by the preprocessor (e.g. 1) in microlibrary/hil/rom.h
+ * - Define the HIL specific version of MICROLIBRARY_ROM_STORAGE in
+ *   microlibrary/hil/rom.h
+ */
+#define MICROLIBRARY_ROM_STORAGE
+#endif // !MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
 /**
  * \brief Get the length of a null-terminated string that may be stored in ROM.
  *
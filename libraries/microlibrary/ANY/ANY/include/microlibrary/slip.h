@@ -0,0 +1,529 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Serial Line Internet Protocol (SLIP) framing interface.
+ */
+
+#ifndef MICROLIBRARY_SLIP_H
+#define MICROLIBRARY_SLIP_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "microlibrary/array.h"
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief SLIP frame delimiter.
+ */
+constexpr auto SLIP_END = std::uint8_t{ 0xC0 };
+
+/**
+ * \brief SLIP escape.
+ */
+constexpr auto SLIP_ESC = std::uint8_t{ 0xDB };
+
+/**
+ * \brief SLIP escaped frame delimiter.
+ */
+constexpr auto SLIP_ESC_END = std::uint8_t{ 0xDC };
+
+/**
+ * \brief SLIP escaped escape.
+ */
+constexpr auto SLIP_ESC_ESC = std::uint8_t{ 0xDD };
+
+/**
+ * \brief Serial Line Internet Protocol (SLIP) framing stream I/O driver.
+ *
+ * Characters/data written to the driver are SLIP encoded (RFC 1055) and written to the
+ * wrapped stream I/O driver. The end of a frame is marked by calling
+ * microlibrary::SLIP_Stream_IO_Driver::end_frame(), or by flushing the driver.
+ *
+ * Encoding is single-pass and unbuffered. Runs of bytes that do not need to be escaped
+ * are written to the wrapped stream I/O driver as a single block.
+ */
+class SLIP_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    SLIP_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write encoded frames to.
+     */
+    constexpr SLIP_Stream_IO_Driver( Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    SLIP_Stream_IO_Driver( SLIP_Stream_IO_Driver && ) = delete;
+
+    SLIP_Stream_IO_Driver( SLIP_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~SLIP_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( SLIP_Stream_IO_Driver && ) = delete;
+
+    auto operator=( SLIP_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if a frame is in progress (characters/data have been written since
+     *        the end of the previous frame).
+     *
+     * \return true if a frame is in progress.
+     * \return false if a frame is not in progress.
+     */
+    constexpr auto frame_in_progress() const noexcept -> bool
+    {
+        return m_frame_in_progress;
+    }
+
+    /**
+     * \brief Encode a character.
+     *
+     * \param[in] character The character to encode.
+     */
+    void put( char character ) noexcept override final;
+
+    /**
+     * \brief Encode a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to encode.
+     * \param[in] end The end of the block of characters to encode.
+     */
+    void put( char const * begin, char const * end ) noexcept override final;
+
+    /**
+     * \brief Encode a null-terminated string.
+     *
+     * \param[in] string The null-terminated string to encode.
+     */
+    void put( char const * string ) noexcept override final;
+
+    /**
+     * \brief Encode data.
+     *
+     * \param[in] data The data to encode.
+     */
+    void put( std::uint8_t data ) noexcept override final;
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final;
+
+    /**
+     * \brief Encode a list of blocks of characters.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to encode.
+     * \param[in] end The end of the list of blocks of characters to encode.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final;
+
+    /**
+     * \brief End the frame that is in progress (if any), and flush the wrapped stream I/O
+     *        driver.
+     */
+    void flush() noexcept override final;
+
+    /**
+     * \brief End the current frame.
+     */
+    void end_frame() noexcept;
+
+  private:
+    /**
+     * \brief The stream I/O driver to write encoded frames to.
+     */
+    Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The frame in progress flag.
+     */
+    bool m_frame_in_progress{ false };
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     */
+    void encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept;
+};
+
+/**
+ * \brief Fault reporting Serial Line Internet Protocol (SLIP) framing stream I/O driver.
+ *
+ * Characters/data written to the driver are SLIP encoded (RFC 1055) and written to the
+ * wrapped stream I/O driver. The end of a frame is marked by calling
+ * microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::end_frame(), or by flushing the
+ * driver.
+ *
+ * Encoding is single-pass and unbuffered. Runs of bytes that do not need to be escaped
+ * are written to the wrapped stream I/O driver as a single block.
+ *
+ * \attention If writing to the wrapped stream I/O driver fails, the frame that is in
+ *            progress will be corrupt. The frame should be ended so that the receiver
+ *            can resynchronize.
+ */
+class Fault_Reporting_SLIP_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    Fault_Reporting_SLIP_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write encoded frames to.
+     */
+    constexpr Fault_Reporting_SLIP_Stream_IO_Driver( Fault_Reporting_Stream_IO_Driver & driver ) noexcept :
+        m_driver{ &driver }
+    {
+    }
+
+    Fault_Reporting_SLIP_Stream_IO_Driver( Fault_Reporting_SLIP_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_SLIP_Stream_IO_Driver( Fault_Reporting_SLIP_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_SLIP_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_SLIP_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_SLIP_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if a frame is in progress (characters/data have been written since
+     *        the end of the previous frame).
+     *
+     * \return true if a frame is in progress.
+     * \return false if a frame is not in progress.
+     */
+    constexpr auto frame_in_progress() const noexcept -> bool
+    {
+        return m_frame_in_progress;
+    }
+
+    /**
+     * \brief Encode a character.
+     *
+     * \param[in] character The character to encode.
+     *
+     * \return Nothing if encoding the character succeeded.
+     * \return An error code if encoding the character failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a block of characters.
+     *
+     * \param[in] begin The beginning of the block of characters to encode.
+     * \param[in] end The end of the block of characters to encode.
+     *
+     * \return Nothing if encoding the block of characters succeeded.
+     * \return An error code if encoding the block of characters failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a null-terminated string.
+     *
+     * \param[in] string The null-terminated string to encode.
+     *
+     * \return Nothing if encoding the null-terminated string succeeded.
+     * \return An error code if encoding the null-terminated string failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode data.
+     *
+     * \param[in] data The data to encode.
+     *
+     * \return Nothing if encoding the data succeeded.
+     * \return An error code if encoding the data failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final;
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     *
+     * \return Nothing if encoding the block of data succeeded.
+     * \return An error code if encoding the block of data failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief Encode a list of blocks of characters.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to encode.
+     * \param[in] end The end of the list of blocks of characters to encode.
+     *
+     * \return Nothing if encoding the list of blocks of characters succeeded.
+     * \return An error code if encoding the list of blocks of characters failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final;
+
+    /**
+     * \brief End the frame that is in progress (if any), and flush the wrapped stream I/O
+     *        driver.
+     *
+     * \return Nothing if flushing the driver succeeded.
+     * \return An error code if flushing the driver failed.
+     */
+    auto flush() noexcept -> Result<void> override final;
+
+    /**
+     * \brief End the current frame.
+     *
+     * \return Nothing if ending the current frame succeeded.
+     * \return An error code if ending the current frame failed.
+     */
+    auto end_frame() noexcept -> Result<void>;
+
+  private:
+    /**
+     * \brief The stream I/O driver to write encoded frames to.
+     */
+    Fault_Reporting_Stream_IO_Driver * m_driver;
+
+    /**
+     * \brief The frame in progress flag.
+     */
+    bool m_frame_in_progress{ false };
+
+    /**
+     * \brief Encode a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to encode.
+     * \param[in] end The end of the block of data to encode.
+     *
+     * \return Nothing if encoding the block of data succeeded.
+     * \return An error code if encoding the block of data failed.
+     */
+    auto encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void>;
+};
+
+/**
+ * \brief Streaming Serial Line Internet Protocol (SLIP) decoder.
+ *
+ * Encoded data is decoded one byte at a time as it is received (e.g. in chunks read using
+ * microlibrary::Stream_IO_Driver::get()), and the decoded frame is accumulated in a fixed
+ * capacity frame buffer.
+ *
+ * Empty frames (e.g. frame delimiters used to resynchronize a link) are ignored. If an
+ * error is detected, the remainder of the frame is discarded and decoding resumes with
+ * the next frame.
+ *
+ * \tparam N The capacity of the frame buffer.
+ */
+template<std::size_t N>
+class SLIP_Decoder {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The frame buffer size type.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr SLIP_Decoder() noexcept = default;
+
+    SLIP_Decoder( SLIP_Decoder && ) = delete;
+
+    SLIP_Decoder( SLIP_Decoder const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~SLIP_Decoder() noexcept = default;
+
+    auto operator=( SLIP_Decoder && ) = delete;
+
+    auto operator=( SLIP_Decoder const & ) = delete;
+
+    /**
+     * \brief Get the capacity of the frame buffer.
+     *
+     * \return The capacity of the frame buffer.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the beginning of the decoded frame.
+     *
+     * \return The beginning of the decoded frame.
+     */
+    constexpr auto begin() const noexcept -> std::uint8_t const *
+    {
+        return m_frame.begin();
+    }
+
+    /**
+     * \brief Get the end of the decoded frame.
+     *
+     * \return The end of the decoded frame.
+     */
+    constexpr auto end() const noexcept -> std::uint8_t const *
+    {
+        return m_frame.begin() + m_size;
+    }
+
+    /**
+     * \brief Get the size of the decoded frame.
+     *
+     * \return The size of the decoded frame.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Decode a byte.
+     *
+     * \attention The decoded frame is only complete after this function reports that a
+     *            frame has been decoded, and is only valid until this function is called
+     *            again.
+     *
+     * \param[in] byte The byte to decode.
+     *
+     * \return true if a frame has been decoded.
+     * \return false if a frame has not been decoded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the frame being decoded does
+     *         not fit in the frame buffer.
+     * \return microlibrary::Generic_Error::RUNTIME_ERROR if the frame being decoded is
+     *         malformed (invalid escape sequence).
+     */
+    auto decode( std::uint8_t byte ) noexcept -> Result<bool>
+    {
+        if ( m_frame_complete ) {
+            m_frame_complete = false;
+            m_size           = 0;
+        } // if
+
+        if ( byte == SLIP_END ) {
+            auto const state = m_state;
+
+            m_state = State::DECODING;
+
+            switch ( state ) {
+                case State::DECODING: break;
+                case State::ESCAPING: m_size = 0; return Generic_Error::RUNTIME_ERROR;
+                case State::DISCARDING: m_size = 0; return false;
+            } // switch
+
+            if ( not m_size ) {
+                return false;
+            } // if
+
+            m_frame_complete = true;
+
+            return true;
+        } // if
+
+        switch ( m_state ) {
+            case State::DECODING:
+                if ( byte == SLIP_ESC ) {
+                    m_state = State::ESCAPING;
+
+                    return false;
+                } // if
+                break;
+            case State::ESCAPING:
+                m_state = State::DECODING;
+
+                switch ( byte ) {
+                    case SLIP_ESC_END: byte = SLIP_END; break;
+                    case SLIP_ESC_ESC: byte = SLIP_ESC; break;
+                    default: m_state = State::DISCARDING; return Generic_Error::RUNTIME_ERROR;
+                } // switch
+                break;
+            case State::DISCARDING: return false;
+        } // switch
+
+        if ( m_size == N ) {
+            m_state = State::DISCARDING;
+
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        m_frame[ m_size ] = byte;
+        ++m_size;
+
+        return false;
+    }
+
+  private:
+    /**
+     * \brief Decoder state.
+     */
+    enum class State : std::uint_fast8_t {
+        DECODING,   ///< Decoding a frame.
+        ESCAPING,   ///< Decoding an escape sequence.
+        DISCARDING, ///< Discarding the remainder of a frame after an error.
+    };
+
+    /**
+     * \brief The frame buffer.
+     */
+    Array<std::uint8_t, N> m_frame{};
+
+    /**
+     * \brief The size of the decoded frame.
+     */
+    Size m_size{ 0 };
+
+    /**
+     * \brief The decoder state.
+     */
+    State m_state{ State::DECODING };
+
+    /**
+     * \brief The frame complete flag.
+     */
+    bool m_frame_complete{ false };
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_SLIP_H
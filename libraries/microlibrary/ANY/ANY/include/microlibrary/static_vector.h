@@ -0,0 +1,846 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Static_Vector interface.
+ */
+
+#ifndef MICROLIBRARY_STATIC_VECTOR_H
+#define MICROLIBRARY_STATIC_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "microlibrary/algorithm.h"
+#include "microlibrary/error.h"
+#include "microlibrary/precondition.h"
+#include "microlibrary/result.h"
+
+namespace microlibrary {
+
+/**
+ * \brief microlibrary::Static_Vector storage.
+ *
+ * \relatedalso microlibrary::Static_Vector
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ */
+template<typename T, std::size_t N, bool = std::is_trivially_destructible_v<T>>
+class Static_Vector_Storage;
+
+/**
+ * \brief microlibrary::Static_Vector storage specialized for trivially destructible
+ *        elements.
+ *
+ * \relatedalso microlibrary::Static_Vector
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ */
+template<typename T, std::size_t N>
+class Static_Vector_Storage<T, N, true> {
+  protected:
+    /**
+     * \brief The number of elements in the vector.
+     */
+    using Count = std::conditional_t<N <= UINT8_MAX, std::uint8_t, std::conditional_t<N <= UINT16_MAX, std::uint16_t, std::size_t>>;
+
+    /**
+     * \brief Constructor.
+     */
+    Static_Vector_Storage() noexcept
+    {
+    }
+
+    Static_Vector_Storage( Static_Vector_Storage && ) = delete;
+
+    Static_Vector_Storage( Static_Vector_Storage const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Vector_Storage() noexcept = default;
+
+    auto operator=( Static_Vector_Storage && ) = delete;
+
+    auto operator=( Static_Vector_Storage const & ) = delete;
+
+    union {
+        /**
+         * \brief The element storage.
+         */
+        T m_elements[ N ];
+    };
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    Count m_size{ 0 };
+};
+
+/**
+ * \brief microlibrary::Static_Vector storage specialized for non-trivially destructible
+ *        elements.
+ *
+ * \relatedalso microlibrary::Static_Vector
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ */
+template<typename T, std::size_t N>
+class Static_Vector_Storage<T, N, false> {
+  protected:
+    /**
+     * \brief The number of elements in the vector.
+     */
+    using Count = std::conditional_t<N <= UINT8_MAX, std::uint8_t, std::conditional_t<N <= UINT16_MAX, std::uint16_t, std::size_t>>;
+
+    /**
+     * \brief Constructor.
+     */
+    Static_Vector_Storage() noexcept
+    {
+    }
+
+    Static_Vector_Storage( Static_Vector_Storage && ) = delete;
+
+    Static_Vector_Storage( Static_Vector_Storage const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Vector_Storage() noexcept
+    {
+        for ( auto i = Count{ 0 }; i < m_size; ++i ) { m_elements[ i ].~T(); } // for
+    }
+
+    auto operator=( Static_Vector_Storage && ) = delete;
+
+    auto operator=( Static_Vector_Storage const & ) = delete;
+
+    union {
+        /**
+         * \brief The element storage.
+         */
+        T m_elements[ N ];
+    };
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    Count m_size{ 0 };
+};
+
+/**
+ * \brief Vector with fixed capacity inline storage.
+ *
+ * Elements are constructed in place when they are added to the vector, and are destroyed
+ * when they are removed from the vector. If the vector element type is trivially
+ * destructible, the vector is trivially destructible, and removing elements does not
+ * involve a destructor loop.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ */
+template<typename T, std::size_t N>
+class Static_Vector : private Static_Vector_Storage<T, N> {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The vector element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A vector element position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief A reference to a vector element.
+     */
+    using Reference = Value &;
+
+    /**
+     * \brief A reference to a const vector element.
+     */
+    using Const_Reference = Value const &;
+
+    /**
+     * \brief A pointer to a vector element.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const vector element.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief A vector iterator.
+     */
+    using Iterator = Pointer;
+
+    /**
+     * \brief A const vector iterator.
+     */
+    using Const_Iterator = Const_Pointer;
+
+    /**
+     * \brief A vector reverse iterator.
+     */
+    using Reverse_Iterator = std::reverse_iterator<Iterator>;
+
+    /**
+     * \brief A const vector reverse iterator.
+     */
+    using Const_Reverse_Iterator = std::reverse_iterator<Const_Iterator>;
+
+    /**
+     * \brief Constructor.
+     */
+    Static_Vector() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Static_Vector( Static_Vector && source ) noexcept
+    {
+        for ( auto & element : source ) { construct( std::move( element ) ); } // for
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Static_Vector( Static_Vector const & original ) noexcept
+    {
+        for ( auto const & element : original ) { construct( element ); } // for
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Vector() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Static_Vector && expression ) noexcept -> Static_Vector &
+    {
+        if ( &expression != this ) {
+            clear();
+
+            for ( auto & element : expression ) { construct( std::move( element ) ); } // for
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Static_Vector const & expression ) noexcept -> Static_Vector &
+    {
+        if ( &expression != this ) {
+            clear();
+
+            for ( auto const & element : expression ) { construct( element ); } // for
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \return The element at the specified position in the vector.
+     */
+    constexpr auto operator[]( Position position ) noexcept -> Reference
+    {
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \return The element at the specified position in the vector.
+     */
+    constexpr auto operator[]( Position position ) const noexcept -> Const_Reference
+    {
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \pre position < microlibrary::Static_Vector::size()
+     *
+     * \return The element at the specified position in the vector.
+     */
+    constexpr auto at( Position position ) noexcept -> Reference
+    {
+        MICROLIBRARY_EXPECT( position < size(), Generic_Error::OUT_OF_RANGE );
+
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \pre position < microlibrary::Static_Vector::size()
+     *
+     * \return The element at the specified position in the vector.
+     */
+    constexpr auto at( Position position ) const noexcept -> Const_Reference
+    {
+        MICROLIBRARY_EXPECT( position < size(), Generic_Error::OUT_OF_RANGE );
+
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the first element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The first element of the vector.
+     */
+    constexpr auto front() noexcept -> Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the first element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The first element of the vector.
+     */
+    constexpr auto front() const noexcept -> Const_Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the last element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The last element of the vector.
+     */
+    constexpr auto back() noexcept -> Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the last element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The last element of the vector.
+     */
+    constexpr auto back() const noexcept -> Const_Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the underlying element storage.
+     *
+     * \return The underlying element storage.
+     */
+    constexpr auto data() noexcept -> Pointer
+    {
+        return &this->m_elements[ 0 ];
+    }
+
+    /**
+     * \brief Access the underlying element storage.
+     *
+     * \return The underlying element storage.
+     */
+    constexpr auto data() const noexcept -> Const_Pointer
+    {
+        return &this->m_elements[ 0 ];
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    constexpr auto begin() noexcept -> Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    constexpr auto begin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    constexpr auto cbegin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    constexpr auto end() noexcept -> Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    constexpr auto end() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    constexpr auto cend() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    constexpr auto rbegin() noexcept -> Reverse_Iterator
+    {
+        return Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    constexpr auto rbegin() const noexcept -> Const_Reverse_Iterator
+    {
+        return Const_Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    constexpr auto crbegin() const noexcept -> Const_Reverse_Iterator
+    {
+        return Const_Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    constexpr auto rend() noexcept -> Reverse_Iterator
+    {
+        return Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    constexpr auto rend() const noexcept -> Const_Reverse_Iterator
+    {
+        return Const_Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    constexpr auto crend() const noexcept -> Const_Reverse_Iterator
+    {
+        return Const_Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Check if the vector is empty.
+     *
+     * \return true if the vector is empty.
+     * \return false if the vector is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * \brief Check if the vector is full.
+     *
+     * \return true if the vector is full.
+     * \return false if the vector is not full.
+     */
+    constexpr auto full() const noexcept -> bool
+    {
+        return size() == N;
+    }
+
+    /**
+     * \brief Get the number of elements in the vector.
+     *
+     * \return The number of elements in the vector.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return this->m_size;
+    }
+
+    /**
+     * \brief Get the vector's capacity.
+     *
+     * \return The vector's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Remove all elements from the vector.
+     */
+    void clear() noexcept
+    {
+        destroy( begin(), end() );
+
+        this->m_size = 0;
+    }
+
+    /**
+     * \brief Add an element to the end of the vector.
+     *
+     * \param[in] value The element to add to the end of the vector.
+     *
+     * \return Nothing if adding the element succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the vector is full.
+     */
+    auto push_back( Value const & value ) noexcept -> Result<void>
+    {
+        return emplace_back( value );
+    }
+
+    /**
+     * \brief Add an element to the end of the vector.
+     *
+     * \param[in] value The element to add to the end of the vector.
+     *
+     * \return Nothing if adding the element succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the vector is full.
+     */
+    auto push_back( Value && value ) noexcept -> Result<void>
+    {
+        return emplace_back( std::move( value ) );
+    }
+
+    /**
+     * \brief Construct an element in place at the end of the vector.
+     *
+     * \tparam Arguments The types of the arguments to use to construct the element.
+     *
+     * \param[in] arguments The arguments to use to construct the element.
+     *
+     * \return Nothing if constructing the element succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the vector is full.
+     */
+    template<typename... Arguments>
+    auto emplace_back( Arguments &&... arguments ) noexcept -> Result<void>
+    {
+        if ( full() ) {
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        construct( std::forward<Arguments>( arguments )... );
+
+        return {};
+    }
+
+    /**
+     * \brief Insert an element into the vector.
+     *
+     * \param[in] position The position to insert the element at.
+     * \param[in] value The element to insert into the vector.
+     *
+     * \pre position >= microlibrary::Static_Vector::begin() and position <=
+     *      microlibrary::Static_Vector::end()
+     *
+     * \return An iterator to the inserted element if inserting the element succeeded.
+     * \return microlibrary::Generic_Error::WOULD_OVERFLOW if the vector is full.
+     */
+    auto insert( Const_Iterator position, Value value ) noexcept -> Result<Iterator>
+    {
+        MICROLIBRARY_EXPECT( position >= begin() and position <= end(), Generic_Error::OUT_OF_RANGE );
+
+        if ( full() ) {
+            return Generic_Error::WOULD_OVERFLOW;
+        } // if
+
+        auto const inserted = begin() + ( position - cbegin() );
+
+        if ( inserted == end() ) {
+            construct( std::move( value ) );
+
+            return inserted;
+        } // if
+
+        construct( std::move( back() ) );
+
+        for ( auto element = end() - 2; element != inserted; --element ) {
+            *element = std::move( *( element - 1 ) );
+        } // for
+
+        *inserted = std::move( value );
+
+        return inserted;
+    }
+
+    /**
+     * \brief Remove the last element of the vector.
+     *
+     * \pre not microlibrary::Static_Vector::empty()
+     */
+    void pop_back() noexcept
+    {
+        MICROLIBRARY_EXPECT( not empty(), Generic_Error::WOULD_UNDERFLOW );
+
+        destroy( end() - 1, end() );
+
+        --this->m_size;
+    }
+
+    /**
+     * \brief Remove an element from the vector.
+     *
+     * \param[in] position The position of the element to remove.
+     *
+     * \pre position >= microlibrary::Static_Vector::begin() and position <
+     *      microlibrary::Static_Vector::end()
+     *
+     * \return An iterator to the element following the removed element.
+     */
+    auto erase( Const_Iterator position ) noexcept -> Iterator
+    {
+        MICROLIBRARY_EXPECT( position >= begin() and position < end(), Generic_Error::OUT_OF_RANGE );
+
+        return erase( position, position + 1 );
+    }
+
+    /**
+     * \brief Remove a range of elements from the vector.
+     *
+     * \param[in] first The beginning of the range of elements to remove.
+     * \param[in] last The end of the range of elements to remove.
+     *
+     * \pre first >= microlibrary::Static_Vector::begin() and first <= last and last <=
+     *      microlibrary::Static_Vector::end()
+     *
+     * \return An iterator to the element following the last removed element.
+     */
+    auto erase( Const_Iterator first, Const_Iterator last ) noexcept -> Iterator
+    {
+        MICROLIBRARY_EXPECT( first >= begin() and first <= last and last <= end(), Generic_Error::OUT_OF_RANGE );
+
+        auto const removed = begin() + ( first - cbegin() );
+        auto const count   = last - first;
+
+        if ( count == 0 ) {
+            return removed;
+        } // if
+
+        auto element = removed;
+        for ( ; element + count != end(); ++element ) {
+            *element = std::move( *( element + count ) );
+        } // for
+
+        destroy( element, end() );
+
+        this->m_size -= static_cast<typename Static_Vector::Count>( count );
+
+        return removed;
+    }
+
+  private:
+    /**
+     * \brief Construct an element in place at the end of the vector.
+     *
+     * \attention The vector must not be full.
+     *
+     * \tparam Arguments The types of the arguments to use to construct the element.
+     *
+     * \param[in] arguments The arguments to use to construct the element.
+     */
+    template<typename... Arguments>
+    void construct( Arguments &&... arguments ) noexcept
+    {
+        new ( end() ) Value( std::forward<Arguments>( arguments )... );
+
+        ++this->m_size;
+    }
+
+    /**
+     * \brief Destroy a range of elements.
+     *
+     * \param[in] first The beginning of the range of elements to destroy.
+     * \param[in] last The end of the range of elements to destroy.
+     */
+    static void destroy( Iterator first, Iterator last ) noexcept
+    {
+        if constexpr ( not std::is_trivially_destructible_v<Value> ) {
+            for ( ; first != last; ++first ) { first->~Value(); } // for
+        } else {
+            static_cast<void>( first );
+            static_cast<void>( last );
+        } // else
+    }
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso microlibrary::Static_Vector
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<typename T, std::size_t N>
+constexpr auto operator==( Static_Vector<T, N> const & lhs, Static_Vector<T, N> const & rhs ) noexcept
+    -> bool
+{
+    return ::microlibrary::equal( lhs.begin(), lhs.end(), rhs.begin(), rhs.end() );
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso microlibrary::Static_Vector
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<typename T, std::size_t N>
+constexpr auto operator!=( Static_Vector<T, N> const & lhs, Static_Vector<T, N> const & rhs ) noexcept
+    -> bool
+{
+    return not( lhs == rhs );
+}
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_STATIC_VECTOR_H
@@ -40,6 +40,32 @@ class Output_Stream;
 
 class Fault_Reporting_Output_Stream;
 
+class Input_Stream;
+
+class Fault_Reporting_Input_Stream;
+
+namespace Format {
+
+template<typename Source>
+class String;
+
+} // namespace Format
+
+/**
+ * \brief Block of characters (scatter-gather write element).
+ */
+struct Character_Block {
+    /**
+     * \brief The beginning of the block of characters.
+     */
+    char const * begin;
+
+    /**
+     * \brief The end of the block of characters.
+     */
+    char const * end;
+};
+
 /**
  * \brief Output formatter.
  *
@@ -116,6 +142,82 @@ class Output_Formatter {
         -> Result<std::size_t>;
 };
 
+/**
+ * \brief Input formatter.
+ *
+ * \tparam T The type to scan.
+ *
+ * \attention This class must be fully or partially specialized for each type that will
+ *            support formatted input.
+ */
+template<typename T, typename = void>
+class Input_Formatter {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Input_Formatter() noexcept;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Input_Formatter( Input_Formatter && source ) noexcept;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Input_Formatter( Input_Formatter const & original ) noexcept;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Input_Formatter() noexcept;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Input_Formatter && expression ) noexcept -> Input_Formatter &;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Input_Formatter const & expression ) noexcept -> Input_Formatter &;
+
+    /**
+     * \brief Read a formatted value from a stream.
+     *
+     * \param[in] stream The stream to read the formatted value from.
+     * \param[out] value The parsed value.
+     *
+     * \return The number of characters read from the stream.
+     */
+    auto scan( Input_Stream & stream, T & value ) const noexcept -> std::size_t;
+
+    /**
+     * \brief Read a formatted value from a stream.
+     *
+     * \param[in] stream The stream to read the formatted value from.
+     * \param[out] value The parsed value.
+     *
+     * \return The number of characters read from the stream if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto scan( Fault_Reporting_Input_Stream & stream, T & value ) const noexcept
+        -> Result<std::size_t>;
+};
+
 /**
  * \brief Stream I/O driver.
  */
@@ -168,11 +270,85 @@ class Stream_IO_Driver {
      */
     virtual void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept;
 
+    /**
+     * \brief Write a list of blocks of characters to the data sink (scatter-gather
+     *        write).
+     *
+     * The default implementation writes each block of characters using
+     * microlibrary::Stream_IO_Driver::put( char const *, char const * ). Drivers that can
+     * write a list of blocks more efficiently (e.g. using a single DMA transfer) should
+     * override this function.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            data sink.
+     * \param[in] end The end of the list of blocks of characters to write to the data
+     *            sink.
+     */
+    virtual void put( Character_Block const * begin, Character_Block const * end ) noexcept;
+
     /**
      * \brief Write any data that has been buffered to the data sink.
      */
     virtual void flush() noexcept = 0;
 
+    /**
+     * \brief Reserve space for a block of characters in the driver's write buffer.
+     *
+     * Characters written to the reserved space are not written to the data sink until
+     * they are committed (see microlibrary::Stream_IO_Driver::commit()).
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if the driver supports writing
+     *         directly to its write buffer and space for n characters is available.
+     * \return nullptr if the driver does not support writing directly to its write
+     *         buffer, or space for n characters is not available.
+     */
+    virtual auto reserve( std::size_t n ) noexcept -> char *;
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Stream_IO_Driver::reserve().
+     *
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     */
+    virtual void commit( std::size_t n ) noexcept;
+
+    /**
+     * \brief Get the number of characters/data that can be read from the data source
+     *        without blocking.
+     *
+     * \return The number of characters/data that can be read from the data source
+     *         without blocking (0 if the driver is not associated with a data source).
+     */
+    virtual auto available() noexcept -> std::size_t;
+
+    /**
+     * \brief Read a block of characters from the data source.
+     *
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the characters that were read. If the data source reaches
+     *         end-of-file before the block is filled (immediately if the driver is not
+     *         associated with a data source), the returned pointer precedes end.
+     */
+    virtual auto get( char * begin, char * end ) noexcept -> char *;
+
+    /**
+     * \brief Read a block of data from the data source.
+     *
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the data that was read. If the data source reaches end-of-file
+     *         before the block is filled (immediately if the driver is not associated
+     *         with a data source), the returned pointer precedes end.
+     */
+    virtual auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t *;
+
   protected:
     /**
      * \brief Constructor.
@@ -289,6 +465,27 @@ class Fault_Reporting_Stream_IO_Driver {
     virtual auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
         -> Result<void>;
 
+    /**
+     * \brief Write a list of blocks of characters to the data sink (scatter-gather
+     *        write).
+     *
+     * The default implementation writes each block of characters using
+     * microlibrary::Fault_Reporting_Stream_IO_Driver::put( char const *, char const * ),
+     * and stops at the first block that cannot be written. Drivers that can write a list
+     * of blocks more efficiently (e.g. using a single DMA transfer) should override this
+     * function.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            data sink.
+     * \param[in] end The end of the list of blocks of characters to write to the data
+     *            sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    virtual auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void>;
+
     /**
      * \brief Write any data that has been buffered to the data sink.
      *
@@ -297,6 +494,75 @@ class Fault_Reporting_Stream_IO_Driver {
      */
     virtual auto flush() noexcept -> Result<void> = 0;
 
+    /**
+     * \brief Reserve space for a block of characters in the driver's write buffer.
+     *
+     * Characters written to the reserved space are not written to the data sink until
+     * they are committed (see microlibrary::Fault_Reporting_Stream_IO_Driver::commit()).
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if the driver supports writing
+     *         directly to its write buffer and space for n characters is available.
+     * \return nullptr if the driver does not support writing directly to its write
+     *         buffer, or space for n characters is not available.
+     * \return An error code if making space for n characters available failed.
+     */
+    virtual auto reserve( std::size_t n ) noexcept -> Result<char *>;
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Fault_Reporting_Stream_IO_Driver::reserve().
+     *
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     *
+     * \return Nothing if the commit succeeded.
+     * \return An error code if the commit failed.
+     */
+    virtual auto commit( std::size_t n ) noexcept -> Result<void>;
+
+    /**
+     * \brief Get the number of characters/data that can be read from the data source
+     *        without blocking.
+     *
+     * \return The number of characters/data that can be read from the data source
+     *         without blocking (0 if the driver is not associated with a data source) if
+     *         the query succeeded.
+     * \return An error code if the query failed.
+     */
+    virtual auto available() noexcept -> Result<std::size_t>;
+
+    /**
+     * \brief Read a block of characters from the data source.
+     *
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the characters that were read if the read succeeded. If the
+     *         data source reaches end-of-file before the block is filled (immediately if
+     *         the driver is not associated with a data source), the returned pointer
+     *         precedes end.
+     * \return An error code if the read failed.
+     */
+    virtual auto get( char * begin, char * end ) noexcept -> Result<char *>;
+
+    /**
+     * \brief Read a block of data from the data source.
+     *
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the data that was read if the read succeeded. If the data
+     *         source reaches end-of-file before the block is filled (immediately if the
+     *         driver is not associated with a data source), the returned pointer precedes
+     *         end.
+     * \return An error code if the read failed.
+     */
+    virtual auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+        -> Result<std::uint8_t *>;
+
   protected:
     /**
      * \brief Constructor.
@@ -829,6 +1095,44 @@ class Output_Stream : public Stream {
      */
     void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept;
 
+    /**
+     * \brief Write a list of blocks of characters to the data sink (scatter-gather
+     *        write).
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            data sink.
+     * \param[in] end The end of the list of blocks of characters to write to the data
+     *            sink.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept;
+
+    /**
+     * \brief Reserve space for a block of characters in the driver's write buffer.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if the driver supports writing
+     *         directly to its write buffer and space for n characters is available.
+     * \return nullptr if the driver does not support writing directly to its write
+     *         buffer, or space for n characters is not available.
+     */
+    auto reserve( std::size_t n ) noexcept -> char *;
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Output_Stream::reserve().
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     */
+    void commit( std::size_t n ) noexcept;
+
     /**
      * \brief Write formatted values to the data sink.
      *
@@ -852,6 +1156,27 @@ class Output_Stream : public Stream {
         return print_implementation( std::size_t{ 0 }, std::forward<Types>( values )... );
     }
 
+    /**
+     * \brief Write formatted values to the data sink using a compile-time format string.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \tparam Source The compile-time format string's source.
+     * \tparam Types The types to print.
+     *
+     * \param[in] format The compile-time format string (see MICROLIBRARY_FORMAT()).
+     * \param[in] values The values to format.
+     *
+     * \return The number of characters written to the data sink.
+     */
+    template<typename Source, typename... Types>
+    auto print( Format::String<Source> format, Types &&... values ) noexcept -> std::size_t
+    {
+        MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        return format.print( *this, std::forward<Types>( values )... );
+    }
+
     /**
      * \brief Write any data that has been buffered to the data sink.
      *
@@ -1043,6 +1368,52 @@ class Fault_Reporting_Output_Stream : public Fault_Reporting_Stream {
      */
     auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void>;
 
+    /**
+     * \brief Write a list of blocks of characters to the data sink (scatter-gather
+     *        write).
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            data sink.
+     * \param[in] end The end of the list of blocks of characters to write to the data
+     *            sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void>;
+
+    /**
+     * \brief Reserve space for a block of characters in the driver's write buffer.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[in] n The number of characters to reserve space for.
+     *
+     * \return The beginning of the reserved space if the driver supports writing
+     *         directly to its write buffer and space for n characters is available.
+     * \return nullptr if the driver does not support writing directly to its write
+     *         buffer, or space for n characters is not available.
+     * \return An error code if making space for n characters available failed.
+     */
+    auto reserve( std::size_t n ) noexcept -> Result<char *>;
+
+    /**
+     * \brief Commit characters that have been written to space reserved by the most
+     *        recent call to microlibrary::Fault_Reporting_Output_Stream::reserve().
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     * \pre n does not exceed the number of characters that space was reserved for
+     *
+     * \param[in] n The number of characters to commit.
+     *
+     * \return Nothing if the commit succeeded.
+     * \return An error code if the commit failed.
+     */
+    auto commit( std::size_t n ) noexcept -> Result<void>;
+
     /**
      * \brief Write formatted values to the data sink.
      *
@@ -1067,6 +1438,29 @@ class Fault_Reporting_Output_Stream : public Fault_Reporting_Stream {
         return print_implementation( std::size_t{ 0 }, std::forward<Types>( values )... );
     }
 
+    /**
+     * \brief Write formatted values to the data sink using a compile-time format string.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \tparam Source The compile-time format string's source.
+     * \tparam Types The types to print.
+     *
+     * \param[in] format The compile-time format string (see MICROLIBRARY_FORMAT()).
+     * \param[in] values The values to format.
+     *
+     * \return The number of characters written to the data sink if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<typename Source, typename... Types>
+    auto print( Format::String<Source> format, Types &&... values ) noexcept
+        -> Result<std::size_t>
+    {
+        MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        return format.print( *this, std::forward<Types>( values )... );
+    }
+
     /**
      * \brief Write any data that has been buffered to the data sink.
      *
@@ -1188,69 +1582,521 @@ class Fault_Reporting_Output_Stream : public Fault_Reporting_Stream {
 };
 
 /**
- * \brief Character output formatter.
+ * \brief Input stream.
  */
-template<>
-class Output_Formatter<char> {
+class Input_Stream : public Stream {
   public:
     /**
-     * \brief Constructor.
-     */
-    constexpr Output_Formatter() noexcept = default;
-
-    /**
-     * \brief Constructor.
+     * \brief Get the number of characters/data that can be read from the data source
+     *        without blocking.
      *
-     * \param[in] source The source of the move.
+     * \return The number of characters/data that can be read from the data source
+     *         without blocking.
      */
-    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+    auto available() noexcept -> std::size_t;
 
     /**
-     * \brief Constructor.
+     * \brief Get the next character from the data source without removing it from the
+     *        data source.
      *
-     * \param[in] original The original to copy.
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[out] character The next character from the data source. If end-of-file is
+     *             reached, end-of-file reached is reported and character is not
+     *             modified.
      */
-    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+    void peek( char & character ) noexcept;
 
     /**
-     * \brief Destructor.
+     * \brief Read a character from the data source.
+     *
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \param[out] character The character that was read from the data source. If
+     *             end-of-file is reached, end-of-file reached is reported and character
+     *             is not modified.
      */
-    ~Output_Formatter() noexcept = default;
+    void get( char & character ) noexcept;
 
     /**
-     * \brief Assignment operator.
+     * \brief Read a block of characters from the data source.
      *
-     * \param[in] expression The expression to be assigned.
+     * \pre microlibrary::Stream::is_nominal()
      *
-     * \return The assigned to object.
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the characters that were read. If end-of-file is reached before
+     *         the block is filled, end-of-file reached is reported and the returned
+     *         pointer precedes end.
      */
-    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+    auto get( char * begin, char * end ) noexcept -> char *;
 
     /**
-     * \brief Assignment operator.
+     * \brief Read data from the data source.
      *
-     * \param[in] expression The expression to be assigned.
+     * \pre microlibrary::Stream::is_nominal()
      *
-     * \return The assigned to object.
+     * \param[out] data The data that was read from the data source. If end-of-file is
+     *             reached, end-of-file reached is reported and data is not modified.
      */
-    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
-        -> Output_Formatter & = default;
+    void get( std::uint8_t & data ) noexcept;
 
     /**
-     * \brief Write a formatted character to a stream.
+     * \brief Read a block of data from the data source.
      *
-     * \param[in] stream The stream to write the formatted character to.
-     * \param[in] character The character to format.
+     * \pre microlibrary::Stream::is_nominal()
      *
-     * \return The number of characters written to the stream.
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the data that was read. If end-of-file is reached before the
+     *         block is filled, end-of-file reached is reported and the returned pointer
+     *         precedes end.
      */
-    auto print( Output_Stream & stream, char character ) const noexcept -> std::size_t;
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t *;
 
     /**
-     * \brief Write a formatted character to a stream.
+     * \brief Read formatted values from the data source.
      *
-     * \param[in] stream The stream to write the formatted character to.
-     * \param[in] character The character to format.
+     * \pre microlibrary::Stream::is_nominal()
+     *
+     * \tparam Types The types to scan.
+     *
+     * \param[out] values The values to parse. If a value is followed by an input
+     *             formatter, the input formatter will be used to read and parse the
+     *             value. If a value is not followed by an input formatter, a default
+     *             constructed input formatter will be used to read and parse the value.
+     *             If the stream stops being nominal (malformed input or end-of-file),
+     *             the remaining values are not parsed.
+     *
+     * \return The number of characters read from the data source.
+     */
+    template<typename... Types>
+    auto scan( Types &&... values ) noexcept -> std::size_t
+    {
+        MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        return scan_implementation( std::size_t{ 0 }, std::forward<Types>( values )... );
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Input_Stream() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Input_Stream( Input_Stream && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Input_Stream( Input_Stream const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Input_Stream() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Input_Stream && expression ) noexcept -> Input_Stream & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Input_Stream const & expression ) noexcept -> Input_Stream & = default;
+
+  private:
+    /**
+     * \brief The character that has been read from the data source by
+     *        microlibrary::Input_Stream::peek() but not yet consumed.
+     */
+    char m_lookahead{};
+
+    /**
+     * \brief m_lookahead is valid.
+     */
+    bool m_lookahead_is_valid{ false };
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     *
+     * \return The number of characters read from the data source.
+     */
+    auto scan_implementation( std::size_t n ) noexcept -> std::size_t
+    {
+        return n;
+    }
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \tparam Type The type to scan.
+     * \tparam Types The types to scan.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     * \param[out] value The value to parse.
+     * \param[in] formatter The input formatter to use to read and parse the value.
+     * \param[out] values The values to parse.
+     *
+     * \return The number of characters read from the data source.
+     */
+    template<typename Type, typename... Types>
+    auto scan_implementation( std::size_t n, Type && value, Input_Formatter<std::decay_t<Type>> formatter, Types &&... values ) noexcept
+        -> std::size_t
+    {
+        n += formatter.scan( *this, value );
+
+        if ( not is_nominal() ) {
+            return n;
+        } // if
+
+        return scan_implementation( n, std::forward<Types>( values )... );
+    }
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \tparam Type The type to scan.
+     * \tparam Types The types to scan.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     * \param[out] value The value to parse.
+     * \param[out] values The values to parse.
+     *
+     * \return The number of characters read from the data source.
+     */
+    template<typename Type, typename... Types>
+    auto scan_implementation( std::size_t n, Type && value, Types &&... values ) noexcept
+        -> std::size_t
+    {
+        return scan_implementation(
+            n,
+            std::forward<Type>( value ),
+            Input_Formatter<std::decay_t<Type>>{},
+            std::forward<Types>( values )... );
+    }
+};
+
+/**
+ * \brief Fault reporting input stream.
+ */
+class Fault_Reporting_Input_Stream : public Fault_Reporting_Stream {
+  public:
+    /**
+     * \brief Get the number of characters/data that can be read from the data source
+     *        without blocking.
+     *
+     * \return The number of characters/data that can be read from the data source
+     *         without blocking if the query succeeded.
+     * \return An error code if the query failed.
+     */
+    auto available() noexcept -> Result<std::size_t>;
+
+    /**
+     * \brief Get the next character from the data source without removing it from the
+     *        data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \param[out] character The next character from the data source. If end-of-file is
+     *             reached, end-of-file reached is reported and character is not
+     *             modified.
+     *
+     * \return Nothing if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto peek( char & character ) noexcept -> Result<void>;
+
+    /**
+     * \brief Read a character from the data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \param[out] character The character that was read from the data source. If
+     *             end-of-file is reached, end-of-file reached is reported and character
+     *             is not modified.
+     *
+     * \return Nothing if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto get( char & character ) noexcept -> Result<void>;
+
+    /**
+     * \brief Read a block of characters from the data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block to read characters into.
+     * \param[in] end The end of the block to read characters into.
+     *
+     * \return The end of the characters that were read if the read succeeded. If
+     *         end-of-file is reached before the block is filled, end-of-file reached is
+     *         reported and the returned pointer precedes end.
+     * \return An error code if the read failed.
+     */
+    auto get( char * begin, char * end ) noexcept -> Result<char *>;
+
+    /**
+     * \brief Read data from the data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \param[out] data The data that was read from the data source. If end-of-file is
+     *             reached, end-of-file reached is reported and data is not modified.
+     *
+     * \return Nothing if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto get( std::uint8_t & data ) noexcept -> Result<void>;
+
+    /**
+     * \brief Read a block of data from the data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block to read data into.
+     * \param[in] end The end of the block to read data into.
+     *
+     * \return The end of the data that was read if the read succeeded. If end-of-file is
+     *         reached before the block is filled, end-of-file reached is reported and the
+     *         returned pointer precedes end.
+     * \return An error code if the read failed.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> Result<std::uint8_t *>;
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \pre microlibrary::Fault_Reporting_Stream::is_nominal()
+     *
+     * \tparam Types The types to scan.
+     *
+     * \param[out] values The values to parse. If a value is followed by an input
+     *             formatter, the input formatter will be used to read and parse the
+     *             value. If a value is not followed by an input formatter, a default
+     *             constructed input formatter will be used to read and parse the value.
+     *             If the stream stops being nominal (malformed input or end-of-file),
+     *             the remaining values are not parsed.
+     *
+     * \return The number of characters read from the data source if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    template<typename... Types>
+    auto scan( Types &&... values ) noexcept -> Result<std::size_t>
+    {
+        MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        return scan_implementation( std::size_t{ 0 }, std::forward<Types>( values )... );
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fault_Reporting_Input_Stream() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fault_Reporting_Input_Stream( Fault_Reporting_Input_Stream && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fault_Reporting_Input_Stream( Fault_Reporting_Input_Stream const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_Input_Stream() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fault_Reporting_Input_Stream && expression ) noexcept
+        -> Fault_Reporting_Input_Stream & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fault_Reporting_Input_Stream const & expression ) noexcept
+        -> Fault_Reporting_Input_Stream & = default;
+
+  private:
+    /**
+     * \brief The character that has been read from the data source by
+     *        microlibrary::Fault_Reporting_Input_Stream::peek() but not yet consumed.
+     */
+    char m_lookahead{};
+
+    /**
+     * \brief m_lookahead is valid.
+     */
+    bool m_lookahead_is_valid{ false };
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     *
+     * \return The number of characters read from the data source.
+     */
+    auto scan_implementation( std::size_t n ) noexcept -> Result<std::size_t>
+    {
+        return n;
+    }
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \tparam Type The type to scan.
+     * \tparam Types The types to scan.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     * \param[out] value The value to parse.
+     * \param[in] formatter The input formatter to use to read and parse the value.
+     * \param[out] values The values to parse.
+     *
+     * \return The number of characters read from the data source if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    template<typename Type, typename... Types>
+    auto scan_implementation( std::size_t n, Type && value, Input_Formatter<std::decay_t<Type>> formatter, Types &&... values ) noexcept
+        -> Result<std::size_t>
+    {
+        auto result = formatter.scan( *this, value );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        if ( not is_nominal() ) {
+            return n + result.value();
+        } // if
+
+        return scan_implementation( n + result.value(), std::forward<Types>( values )... );
+    }
+
+    /**
+     * \brief Read formatted values from the data source.
+     *
+     * \tparam Type The type to scan.
+     * \tparam Types The types to scan.
+     *
+     * \param[in] n The number of characters that have been read from the data source.
+     * \param[out] value The value to parse.
+     * \param[out] values The values to parse.
+     *
+     * \return The number of characters read from the data source if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    template<typename Type, typename... Types>
+    auto scan_implementation( std::size_t n, Type && value, Types &&... values ) noexcept
+        -> Result<std::size_t>
+    {
+        return scan_implementation(
+            n,
+            std::forward<Type>( value ),
+            Input_Formatter<std::decay_t<Type>>{},
+            std::forward<Types>( values )... );
+    }
+};
+
+/**
+ * \brief Character output formatter.
+ */
+template<>
+class Output_Formatter<char> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write a formatted character to a stream.
+     *
+     * \param[in] stream The stream to write the formatted character to.
+     * \param[in] character The character to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Output_Stream & stream, char character ) const noexcept -> std::size_t;
+
+    /**
+     * \brief Write a formatted character to a stream.
+     *
+     * \param[in] stream The stream to write the formatted character to.
+     * \param[in] character The character to format.
      *
      * \return The number of characters written to the stream if the write succeeded.
      * \return An error code if the write failed.
@@ -1487,6 +2333,78 @@ class Output_Formatter<Enum, std::enable_if_t<is_error_code_enum_v<Enum>>> :
     public Output_Formatter<Error_Code> {
 };
 
+/**
+ * \brief Character input formatter.
+ */
+template<>
+class Input_Formatter<char> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Input_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Input_Formatter( Input_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Input_Formatter( Input_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Input_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Input_Formatter && expression ) noexcept -> Input_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Input_Formatter const & expression ) noexcept
+        -> Input_Formatter & = default;
+
+    /**
+     * \brief Read a character from a stream.
+     *
+     * \param[in] stream The stream to read the character from.
+     * \param[out] character The character that was read.
+     *
+     * \return The number of characters read from the stream.
+     */
+    auto scan( Input_Stream & stream, char & character ) const noexcept -> std::size_t;
+
+    /**
+     * \brief Read a character from a stream.
+     *
+     * \param[in] stream The stream to read the character from.
+     * \param[out] character The character that was read.
+     *
+     * \return The number of characters read from the stream if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto scan( Fault_Reporting_Input_Stream & stream, char & character ) const noexcept
+        -> Result<std::size_t>;
+};
+
 } // namespace microlibrary
 
 #endif // MICROLIBRARY_STREAM_H
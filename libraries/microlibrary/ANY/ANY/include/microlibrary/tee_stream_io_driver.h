@@ -0,0 +1,628 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Tee_Stream_IO_Driver and
+ *        microlibrary::Fault_Reporting_Tee_Stream_IO_Driver interface.
+ */
+
+#ifndef MICROLIBRARY_TEE_STREAM_IO_DRIVER_H
+#define MICROLIBRARY_TEE_STREAM_IO_DRIVER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "microlibrary/array.h"
+#include "microlibrary/result.h"
+#include "microlibrary/rom.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief Tee stream I/O driver.
+ *
+ * Each write is forwarded, unchanged, to every enabled sink. This allows a message to be
+ * formatted once and written to multiple data sinks (e.g. a console and a log buffer).
+ * Sinks are written to in the order they were provided to the constructor.
+ *
+ * \tparam N The number of sinks (must be between 1 and 32 inclusive).
+ */
+template<std::size_t N>
+class Tee_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    static_assert( N > 0 );
+    static_assert( N <= 32 );
+
+    /**
+     * \brief The sink enable mask type (bit n enables sink n).
+     */
+    using Mask = std::uint_fast32_t;
+
+    /**
+     * \brief The sink index type.
+     */
+    using Index = std::uint_fast8_t;
+
+    Tee_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * All sinks are enabled.
+     *
+     * \tparam Drivers The sink types.
+     *
+     * \param[in] drivers The sinks to write to.
+     */
+    template<typename... Drivers>
+    constexpr Tee_Stream_IO_Driver( Drivers &... drivers ) noexcept :
+        m_sinks{ { static_cast<Stream_IO_Driver *>( &drivers )... } }
+    {
+        static_assert( sizeof...( Drivers ) == N );
+    }
+
+    Tee_Stream_IO_Driver( Tee_Stream_IO_Driver && ) = delete;
+
+    Tee_Stream_IO_Driver( Tee_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tee_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Tee_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Tee_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the number of sinks.
+     *
+     * \return The number of sinks.
+     */
+    static constexpr auto sinks() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the sink enable mask.
+     *
+     * \return The sink enable mask.
+     */
+    constexpr auto mask() const noexcept -> Mask
+    {
+        return m_mask;
+    }
+
+    /**
+     * \brief Set the sink enable mask.
+     *
+     * \param[in] mask The sink enable mask (bits that do not correspond to a sink are
+     *            ignored).
+     */
+    constexpr void set_mask( Mask mask ) noexcept
+    {
+        m_mask = mask & ALL;
+    }
+
+    /**
+     * \brief Enable a sink.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to enable.
+     */
+    constexpr void enable( Index sink ) noexcept
+    {
+        m_mask |= Mask{ 1 } << sink;
+    }
+
+    /**
+     * \brief Disable a sink.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to disable.
+     */
+    constexpr void disable( Index sink ) noexcept
+    {
+        m_mask &= ~( Mask{ 1 } << sink );
+    }
+
+    /**
+     * \brief Check if a sink is enabled.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to check.
+     *
+     * \return true if the sink is enabled.
+     * \return false if the sink is not enabled.
+     */
+    constexpr auto is_enabled( Index sink ) const noexcept -> bool
+    {
+        return m_mask & ( Mask{ 1 } << sink );
+    }
+
+    /**
+     * \brief Write a character to the enabled sinks.
+     *
+     * \param[in] character The character to write to the enabled sinks.
+     */
+    void put( char character ) noexcept override final
+    {
+        for_each_enabled_sink( [ character ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( character );
+        } );
+    }
+
+    /**
+     * \brief Write a block of characters to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the enabled
+     *            sinks.
+     * \param[in] end The end of the block of characters to write to the enabled sinks.
+     */
+    void put( char const * begin, char const * end ) noexcept override final
+    {
+        for_each_enabled_sink( [ begin, end ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the enabled sinks.
+     *
+     * \param[in] string The null-terminated string to write to the enabled sinks.
+     */
+    void put( char const * string ) noexcept override final
+    {
+        for_each_enabled_sink( [ string ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( string );
+        } );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the enabled sinks.
+     *
+     * \param[in] string The null-terminated ROM string to write to the enabled sinks.
+     */
+    void put( ROM::String string ) noexcept override final
+    {
+        for_each_enabled_sink( [ string ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( string );
+        } );
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the enabled sinks.
+     *
+     * \param[in] data The data to write to the enabled sinks.
+     */
+    void put( std::uint8_t data ) noexcept override final
+    {
+        for_each_enabled_sink(
+            [ data ]( Stream_IO_Driver & sink ) noexcept { sink.put( data ); } );
+    }
+
+    /**
+     * \brief Write a block of data to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the block of data to write to the enabled sinks.
+     * \param[in] end The end of the block of data to write to the enabled sinks.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final
+    {
+        for_each_enabled_sink( [ begin, end ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            enabled sinks.
+     * \param[in] end The end of the list of blocks of characters to write to the enabled
+     *            sinks.
+     */
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override final
+    {
+        for_each_enabled_sink( [ begin, end ]( Stream_IO_Driver & sink ) noexcept {
+            sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Flush the enabled sinks.
+     */
+    void flush() noexcept override final
+    {
+        for_each_enabled_sink( []( Stream_IO_Driver & sink ) noexcept { sink.flush(); } );
+    }
+
+  private:
+    /**
+     * \brief The sink enable mask with all sinks enabled.
+     */
+    static constexpr auto ALL = static_cast<Mask>( std::uint32_t{ 0xFFFF'FFFF } >> ( 32 - N ) );
+
+    /**
+     * \brief The sinks.
+     */
+    Array<Stream_IO_Driver *, N> m_sinks;
+
+    /**
+     * \brief The sink enable mask.
+     */
+    Mask m_mask{ ALL };
+
+    /**
+     * \brief Call a function on each enabled sink.
+     *
+     * \tparam Function The function type.
+     *
+     * \param[in] function The function to call on each enabled sink.
+     */
+    template<typename Function>
+    void for_each_enabled_sink( Function function ) noexcept
+    {
+        for ( auto sink = Index{ 0 }; sink < N; ++sink ) {
+            if ( is_enabled( sink ) ) {
+                function( *m_sinks[ sink ] );
+            } // if
+        }     // for
+    }
+};
+
+/**
+ * \brief Tee stream I/O driver deduction guide.
+ *
+ * \tparam Drivers The sink types.
+ */
+template<typename... Drivers>
+Tee_Stream_IO_Driver( Drivers &... ) -> Tee_Stream_IO_Driver<sizeof...( Drivers )>;
+
+/**
+ * \brief Fault reporting tee stream I/O driver.
+ *
+ * Each write is forwarded, unchanged, to every enabled sink. This allows a message to be
+ * formatted once and written to multiple data sinks (e.g. a console and a log buffer).
+ * Sinks are written to in the order they were provided to the constructor.
+ *
+ * \attention A sink that reports an error does not prevent the write from being forwarded
+ *            to the remaining enabled sinks. If one or more sinks report an error, the
+ *            first error that was reported is returned.
+ *
+ * \tparam N The number of sinks (must be between 1 and 32 inclusive).
+ */
+template<std::size_t N>
+class Fault_Reporting_Tee_Stream_IO_Driver final : public Fault_Reporting_Stream_IO_Driver {
+  public:
+    static_assert( N > 0 );
+    static_assert( N <= 32 );
+
+    /**
+     * \brief The sink enable mask type (bit n enables sink n).
+     */
+    using Mask = std::uint_fast32_t;
+
+    /**
+     * \brief The sink index type.
+     */
+    using Index = std::uint_fast8_t;
+
+    Fault_Reporting_Tee_Stream_IO_Driver() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * All sinks are enabled.
+     *
+     * \tparam Drivers The sink types.
+     *
+     * \param[in] drivers The sinks to write to.
+     */
+    template<typename... Drivers>
+    constexpr Fault_Reporting_Tee_Stream_IO_Driver( Drivers &... drivers ) noexcept :
+        m_sinks{ { static_cast<Fault_Reporting_Stream_IO_Driver *>( &drivers )... } }
+    {
+        static_assert( sizeof...( Drivers ) == N );
+    }
+
+    Fault_Reporting_Tee_Stream_IO_Driver( Fault_Reporting_Tee_Stream_IO_Driver && ) = delete;
+
+    Fault_Reporting_Tee_Stream_IO_Driver( Fault_Reporting_Tee_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fault_Reporting_Tee_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Fault_Reporting_Tee_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Fault_Reporting_Tee_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the number of sinks.
+     *
+     * \return The number of sinks.
+     */
+    static constexpr auto sinks() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the sink enable mask.
+     *
+     * \return The sink enable mask.
+     */
+    constexpr auto mask() const noexcept -> Mask
+    {
+        return m_mask;
+    }
+
+    /**
+     * \brief Set the sink enable mask.
+     *
+     * \param[in] mask The sink enable mask (bits that do not correspond to a sink are
+     *            ignored).
+     */
+    constexpr void set_mask( Mask mask ) noexcept
+    {
+        m_mask = mask & ALL;
+    }
+
+    /**
+     * \brief Enable a sink.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to enable.
+     */
+    constexpr void enable( Index sink ) noexcept
+    {
+        m_mask |= Mask{ 1 } << sink;
+    }
+
+    /**
+     * \brief Disable a sink.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to disable.
+     */
+    constexpr void disable( Index sink ) noexcept
+    {
+        m_mask &= ~( Mask{ 1 } << sink );
+    }
+
+    /**
+     * \brief Check if a sink is enabled.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to check.
+     *
+     * \return true if the sink is enabled.
+     * \return false if the sink is not enabled.
+     */
+    constexpr auto is_enabled( Index sink ) const noexcept -> bool
+    {
+        return m_mask & ( Mask{ 1 } << sink );
+    }
+
+    /**
+     * \brief Write a character to the enabled sinks.
+     *
+     * \param[in] character The character to write to the enabled sinks.
+     *
+     * \return Nothing if writing the character to the enabled sinks succeeded.
+     * \return The first error reported by an enabled sink if writing the character to an
+     *         enabled sink failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ character ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( character );
+        } );
+    }
+
+    /**
+     * \brief Write a block of characters to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the enabled
+     *            sinks.
+     * \param[in] end The end of the block of characters to write to the enabled sinks.
+     *
+     * \return Nothing if writing the block of characters to the enabled sinks succeeded.
+     * \return The first error reported by an enabled sink if writing the block of
+     *         characters to an enabled sink failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ begin, end ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the enabled sinks.
+     *
+     * \param[in] string The null-terminated string to write to the enabled sinks.
+     *
+     * \return Nothing if writing the null-terminated string to the enabled sinks
+     *         succeeded.
+     * \return The first error reported by an enabled sink if writing the null-terminated
+     *         string to an enabled sink failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ string ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( string );
+        } );
+    }
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the enabled sinks.
+     *
+     * \param[in] string The null-terminated ROM string to write to the enabled sinks.
+     *
+     * \return Nothing if writing the null-terminated ROM string to the enabled sinks
+     *         succeeded.
+     * \return The first error reported by an enabled sink if writing the null-terminated
+     *         ROM string to an enabled sink failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ string ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( string );
+        } );
+    }
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write data to the enabled sinks.
+     *
+     * \param[in] data The data to write to the enabled sinks.
+     *
+     * \return Nothing if writing the data to the enabled sinks succeeded.
+     * \return The first error reported by an enabled sink if writing the data to an
+     *         enabled sink failed.
+     */
+    auto put( std::uint8_t data ) noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ data ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( data );
+        } );
+    }
+
+    /**
+     * \brief Write a block of data to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the block of data to write to the enabled sinks.
+     * \param[in] end The end of the block of data to write to the enabled sinks.
+     *
+     * \return Nothing if writing the block of data to the enabled sinks succeeded.
+     * \return The first error reported by an enabled sink if writing the block of data to
+     *         an enabled sink failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ begin, end ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a list of blocks of characters to the enabled sinks.
+     *
+     * \param[in] begin The beginning of the list of blocks of characters to write to the
+     *            enabled sinks.
+     * \param[in] end The end of the list of blocks of characters to write to the enabled
+     *            sinks.
+     *
+     * \return Nothing if writing the list of blocks of characters to the enabled sinks
+     *         succeeded.
+     * \return The first error reported by an enabled sink if writing the list of blocks
+     *         of characters to an enabled sink failed.
+     */
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept
+        -> Result<void> override final
+    {
+        return for_each_enabled_sink( [ begin, end ]( Fault_Reporting_Stream_IO_Driver & sink ) noexcept {
+            return sink.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Flush the enabled sinks.
+     *
+     * \return Nothing if flushing the enabled sinks succeeded.
+     * \return The first error reported by an enabled sink if flushing an enabled sink
+     *         failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        return for_each_enabled_sink(
+            []( Fault_Reporting_Stream_IO_Driver & sink ) noexcept { return sink.flush(); } );
+    }
+
+  private:
+    /**
+     * \brief The sink enable mask with all sinks enabled.
+     */
+    static constexpr auto ALL = static_cast<Mask>( std::uint32_t{ 0xFFFF'FFFF } >> ( 32 - N ) );
+
+    /**
+     * \brief The sinks.
+     */
+    Array<Fault_Reporting_Stream_IO_Driver *, N> m_sinks;
+
+    /**
+     * \brief The sink enable mask.
+     */
+    Mask m_mask{ ALL };
+
+    /**
+     * \brief Call a function on each enabled sink.
+     *
+     * \tparam Function The function type.
+     *
+     * \param[in] function The function to call on each enabled sink.
+     *
+     * \return Nothing if the function succeeded for every enabled sink.
+     * \return The first error reported by the function if the function failed for an
+     *         enabled sink.
+     */
+    template<typename Function>
+    auto for_each_enabled_sink( Function function ) noexcept -> Result<void>
+    {
+        auto result = Result<void>{};
+
+        for ( auto sink = Index{ 0 }; sink < N; ++sink ) {
+            if ( is_enabled( sink ) ) {
+                auto sink_result = function( *m_sinks[ sink ] );
+                if ( sink_result.is_error() and not result.is_error() ) {
+                    result = sink_result;
+                } // if
+            }     // if
+        }         // for
+
+        return result;
+    }
+};
+
+/**
+ * \brief Fault reporting tee stream I/O driver deduction guide.
+ *
+ * \tparam Drivers The sink types.
+ */
+template<typename... Drivers>
+Fault_Reporting_Tee_Stream_IO_Driver( Drivers &... )
+    -> Fault_Reporting_Tee_Stream_IO_Driver<sizeof...( Drivers )>;
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_TEE_STREAM_IO_DRIVER_H
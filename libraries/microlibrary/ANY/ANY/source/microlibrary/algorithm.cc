@@ -21,3 +21,170 @@
  */
 
 #include "microlibrary/algorithm.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace microlibrary::Implementation {
+
+namespace {
+
+#if defined( __GNUC__ )
+/**
+ * \brief A machine word that may alias any other type.
+ */
+using Word = std::uintptr_t __attribute__( ( __may_alias__ ) );
+#else  // defined( __GNUC__ )
+/**
+ * \brief A machine word.
+ */
+using Word = std::uintptr_t;
+#endif // defined( __GNUC__ )
+
+/**
+ * \brief The number of bytes in a word.
+ */
+constexpr auto WORD_SIZE = sizeof( Word );
+
+/**
+ * \brief A word with every byte set to 0x01.
+ */
+constexpr auto LOW_BITS = static_cast<Word>( ~Word{ 0 } / 0xFF );
+
+/**
+ * \brief A word with every byte set to 0x80.
+ */
+constexpr auto HIGH_BITS = static_cast<Word>( LOW_BITS << 7 );
+
+/**
+ * \brief Get a pointer's offset from the previous word boundary.
+ *
+ * \param[in] pointer The pointer whose offset from the previous word boundary is to be
+ *            gotten.
+ *
+ * \return The pointer's offset from the previous word boundary.
+ */
+auto misalignment( void const * pointer ) noexcept -> std::size_t
+{
+    return reinterpret_cast<std::uintptr_t>( pointer ) % WORD_SIZE;
+}
+
+/**
+ * \brief Load a word.
+ *
+ * \param[in] pointer The word aligned location to load the word from.
+ *
+ * \return The loaded word.
+ */
+auto load( unsigned char const * pointer ) noexcept -> Word
+{
+    return *static_cast<Word const *>( static_cast<void const *>( pointer ) );
+}
+
+/**
+ * \brief Store a word.
+ *
+ * \param[in] pointer The word aligned location to store the word to.
+ * \param[in] word The word to store.
+ */
+void store( unsigned char * pointer, Word word ) noexcept
+{
+    *static_cast<Word *>( static_cast<void *>( pointer ) ) = word;
+}
+
+/**
+ * \brief Check if a word contains a zero byte.
+ *
+ * \param[in] word The word to check.
+ *
+ * \return true if the word contains a zero byte.
+ * \return false if the word does not contain a zero byte.
+ */
+auto has_zero_byte( Word word ) noexcept -> bool
+{
+    return ( ( word - LOW_BITS ) & ~word & HIGH_BITS ) != 0;
+}
+
+} // namespace
+
+void fill_words( unsigned char * begin, unsigned char * end, unsigned char value ) noexcept
+{
+    for ( ; begin != end and misalignment( begin ); ++begin ) { *begin = value; } // for
+
+    auto const pattern = static_cast<Word>( LOW_BITS * value );
+    for ( ; static_cast<std::size_t>( end - begin ) >= WORD_SIZE; begin += WORD_SIZE ) {
+        store( begin, pattern );
+    } // for
+
+    for ( ; begin != end; ++begin ) { *begin = value; } // for
+}
+
+auto equal_words( unsigned char const * begin_1, unsigned char const * end_1, unsigned char const * begin_2 ) noexcept
+    -> bool
+{
+    if ( misalignment( begin_1 ) == misalignment( begin_2 ) ) {
+        for ( ; begin_1 != end_1 and misalignment( begin_1 ); ++begin_1, ++begin_2 ) {
+            if ( *begin_1 != *begin_2 ) {
+                return false;
+            } // if
+        }     // for
+
+        for ( ; static_cast<std::size_t>( end_1 - begin_1 ) >= WORD_SIZE;
+              begin_1 += WORD_SIZE, begin_2 += WORD_SIZE ) {
+            if ( load( begin_1 ) != load( begin_2 ) ) {
+                return false;
+            } // if
+        }     // for
+    }         // if
+
+    for ( ; begin_1 != end_1; ++begin_1, ++begin_2 ) {
+        if ( *begin_1 != *begin_2 ) {
+            return false;
+        } // if
+    }     // for
+
+    return true;
+}
+
+void copy_words( unsigned char const * begin, unsigned char const * end, unsigned char * destination ) noexcept
+{
+    if ( misalignment( begin ) == misalignment( destination ) ) {
+        for ( ; begin != end and misalignment( begin ); ++begin, ++destination ) {
+            *destination = *begin;
+        } // for
+
+        for ( ; static_cast<std::size_t>( end - begin ) >= WORD_SIZE;
+              begin += WORD_SIZE, destination += WORD_SIZE ) {
+            store( destination, load( begin ) );
+        } // for
+    }     // if
+
+    for ( ; begin != end; ++begin, ++destination ) { *destination = *begin; } // for
+}
+
+auto find_words( unsigned char const * begin, unsigned char const * end, unsigned char value ) noexcept
+    -> unsigned char const *
+{
+    for ( ; begin != end and misalignment( begin ); ++begin ) {
+        if ( *begin == value ) {
+            return begin;
+        } // if
+    }     // for
+
+    auto const pattern = static_cast<Word>( LOW_BITS * value );
+    for ( ; static_cast<std::size_t>( end - begin ) >= WORD_SIZE; begin += WORD_SIZE ) {
+        if ( has_zero_byte( load( begin ) ^ pattern ) ) {
+            break;
+        } // if
+    }     // for
+
+    for ( ; begin != end; ++begin ) {
+        if ( *begin == value ) {
+            return begin;
+        } // if
+    }     // for
+
+    return end;
+}
+
+} // namespace microlibrary::Implementation
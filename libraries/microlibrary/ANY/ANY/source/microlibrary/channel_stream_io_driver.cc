@@ -0,0 +1,278 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Channel_Stream_IO_Driver and
+ *        microlibrary::Fault_Reporting_Channel_Stream_IO_Driver implementation.
+ */
+
+#include "microlibrary/channel_stream_io_driver.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "microlibrary/array.h"
+#include "microlibrary/result.h"
+#include "microlibrary/rom.h"
+
+namespace microlibrary {
+
+namespace {
+
+/**
+ * \brief The size of the buffer used to copy ROM strings out of ROM.
+ *
+ * \note ROM strings are framed the same way as strings stored in RAM (one header per
+ *       frame of up to microlibrary::Channel_Stream_IO_Driver::MAX_PAYLOAD_SIZE
+ *       characters). Chunking only affects how a frame's payload is handed to the
+ *       underlying driver.
+ */
+constexpr auto ROM_STRING_CHUNK_SIZE = std::size_t{ 16 };
+
+/**
+ * \brief Get the size of the next frame's payload.
+ *
+ * \tparam T The payload element type.
+ *
+ * \param[in] begin The beginning of the remaining payload.
+ * \param[in] end The end of the remaining payload.
+ *
+ * \return The size of the next frame's payload.
+ */
+template<typename T>
+auto frame_size( T const * begin, T const * end ) noexcept -> std::size_t
+{
+    auto const n = static_cast<std::size_t>( end - begin );
+
+    return n < Channel_Stream_IO_Driver::MAX_PAYLOAD_SIZE
+               ? n
+               : Channel_Stream_IO_Driver::MAX_PAYLOAD_SIZE;
+}
+
+} // namespace
+
+void Channel_Stream_IO_Driver::put( char character ) noexcept
+{
+    put( &character, &character + 1 );
+}
+
+void Channel_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+{
+    while ( begin != end ) {
+        auto const n = frame_size( begin, end );
+
+        put_header( n );
+        m_driver->put( begin, begin + n );
+
+        begin += n;
+    } // while
+}
+
+void Channel_Stream_IO_Driver::put( char const * string ) noexcept
+{
+    put( string, string + std::strlen( string ) );
+}
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+void Channel_Stream_IO_Driver::put( ROM::String string ) noexcept
+{
+    auto chunk = Array<char, ROM_STRING_CHUNK_SIZE>{};
+
+    for ( auto remaining = ROM::length( string ); remaining; ) {
+        auto frame = remaining < MAX_PAYLOAD_SIZE ? remaining : MAX_PAYLOAD_SIZE;
+
+        put_header( frame );
+
+        remaining -= frame;
+
+        while ( frame ) {
+            auto const n = frame < chunk.size() ? frame : chunk.size();
+
+            for ( auto i = std::size_t{ 0 }; i < n; ++i, ++string ) { chunk[ i ] = *string; } // for
+
+            m_driver->put( chunk.begin(), chunk.begin() + n );
+
+            frame -= n;
+        } // while
+    }     // for
+}
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+void Channel_Stream_IO_Driver::put( std::uint8_t data ) noexcept
+{
+    put( &data, &data + 1 );
+}
+
+void Channel_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    while ( begin != end ) {
+        auto const n = frame_size( begin, end );
+
+        put_header( n );
+        m_driver->put( begin, begin + n );
+
+        begin += n;
+    } // while
+}
+
+void Channel_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+{
+    for ( ; begin != end; ++begin ) { put( begin->begin, begin->end ); } // for
+}
+
+void Channel_Stream_IO_Driver::flush() noexcept
+{
+    m_driver->flush();
+}
+
+void Channel_Stream_IO_Driver::put_header( std::size_t size ) noexcept
+{
+    std::uint8_t const header[] = { m_channel, static_cast<std::uint8_t>( size ) };
+
+    m_driver->put( header, header + sizeof( header ) );
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( char character ) noexcept -> Result<void>
+{
+    return put( &character, &character + 1 );
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+    -> Result<void>
+{
+    while ( begin != end ) {
+        auto const n = frame_size( begin, end );
+
+        {
+            auto result = put_header( n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        {
+            auto result = m_driver->put( begin, begin + n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        begin += n;
+    } // while
+
+    return {};
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( char const * string ) noexcept -> Result<void>
+{
+    return put( string, string + std::strlen( string ) );
+}
+
+#if MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( ROM::String string ) noexcept -> Result<void>
+{
+    auto chunk = Array<char, ROM_STRING_CHUNK_SIZE>{};
+
+    for ( auto remaining = ROM::length( string ); remaining; ) {
+        auto frame = remaining < MAX_PAYLOAD_SIZE ? remaining : MAX_PAYLOAD_SIZE;
+
+        {
+            auto result = put_header( frame );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        remaining -= frame;
+
+        while ( frame ) {
+            auto const n = frame < chunk.size() ? frame : chunk.size();
+
+            for ( auto i = std::size_t{ 0 }; i < n; ++i, ++string ) { chunk[ i ] = *string; } // for
+
+            auto result = m_driver->put( chunk.begin(), chunk.begin() + n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            frame -= n;
+        } // while
+    }     // for
+
+    return {};
+}
+#endif // MICROLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( std::uint8_t data ) noexcept -> Result<void>
+{
+    return put( &data, &data + 1 );
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<void>
+{
+    while ( begin != end ) {
+        auto const n = frame_size( begin, end );
+
+        {
+            auto result = put_header( n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        {
+            auto result = m_driver->put( begin, begin + n );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        begin += n;
+    } // while
+
+    return {};
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+    -> Result<void>
+{
+    for ( ; begin != end; ++begin ) {
+        auto result = put( begin->begin, begin->end );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // for
+
+    return {};
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::flush() noexcept -> Result<void>
+{
+    return m_driver->flush();
+}
+
+auto Fault_Reporting_Channel_Stream_IO_Driver::put_header( std::size_t size ) noexcept -> Result<void>
+{
+    std::uint8_t const header[] = { m_channel, static_cast<std::uint8_t>( size ) };
+
+    return m_driver->put( header, header + sizeof( header ) );
+}
+
+} // namespace microlibrary
@@ -0,0 +1,306 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Consistent Overhead Byte Stuffing (COBS) framing implementation.
+ */
+
+#include "microlibrary/cobs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+namespace {
+
+/**
+ * \brief Find the next frame delimiter in a block of data.
+ *
+ * \param[in] begin The beginning of the block of data to search.
+ * \param[in] end The end of the block of data to search.
+ *
+ * \return The location of the next frame delimiter if the block of data contains a frame
+ *         delimiter.
+ * \return end if the block of data does not contain a frame delimiter.
+ */
+auto find_delimiter( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint8_t const *
+{
+    auto const delimiter = static_cast<std::uint8_t const *>(
+        std::memchr( begin, COBS_FRAME_DELIMITER, static_cast<std::size_t>( end - begin ) ) );
+
+    return delimiter ? delimiter : end;
+}
+
+} // namespace
+
+void COBS_Stream_IO_Driver::put( char character ) noexcept
+{
+    put( static_cast<std::uint8_t>( character ) );
+}
+
+void COBS_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+{
+    encode(
+        reinterpret_cast<std::uint8_t const *>( begin ),
+        reinterpret_cast<std::uint8_t const *>( end ) );
+}
+
+void COBS_Stream_IO_Driver::put( char const * string ) noexcept
+{
+    put( string, string + std::strlen( string ) );
+}
+
+void COBS_Stream_IO_Driver::put( std::uint8_t data ) noexcept
+{
+    m_frame_in_progress = true;
+
+    if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+        write_block();
+    } // if
+
+    if ( data == COBS_FRAME_DELIMITER ) {
+        write_block();
+
+        return;
+    } // if
+
+    ++m_size;
+    m_block[ m_size ] = data;
+}
+
+void COBS_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    encode( begin, end );
+}
+
+void COBS_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+{
+    for ( ; begin != end; ++begin ) { put( begin->begin, begin->end ); } // for
+}
+
+void COBS_Stream_IO_Driver::flush() noexcept
+{
+    if ( m_frame_in_progress ) {
+        end_frame();
+    } // if
+
+    m_driver->flush();
+}
+
+void COBS_Stream_IO_Driver::end_frame() noexcept
+{
+    write_block( 1 );
+
+    m_frame_in_progress = false;
+}
+
+void COBS_Stream_IO_Driver::encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    if ( begin == end ) {
+        return;
+    } // if
+
+    m_frame_in_progress = true;
+
+    for ( ;; ) {
+        auto const delimiter = find_delimiter( begin, end );
+
+        while ( begin != delimiter ) {
+            if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+                write_block();
+            } // if
+
+            auto const available = static_cast<std::size_t>( COBS_MAX_BLOCK_SIZE - m_size );
+            auto const requested = static_cast<std::size_t>( delimiter - begin );
+            auto const n         = requested < available ? requested : available;
+
+            std::memcpy( m_block.begin() + 1 + m_size, begin, n );
+            m_size += n;
+            begin += n;
+        } // while
+
+        if ( delimiter == end ) {
+            return;
+        } // if
+
+        if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+            write_block();
+        } // if
+
+        write_block();
+
+        ++begin;
+    } // for
+}
+
+void COBS_Stream_IO_Driver::write_block( std::uint_fast8_t delimiter ) noexcept
+{
+    m_block[ 0 ]          = static_cast<std::uint8_t>( m_size + 1 );
+    m_block[ 1 + m_size ] = COBS_FRAME_DELIMITER;
+
+    m_driver->put( m_block.begin(), m_block.begin() + 1 + m_size + delimiter );
+
+    m_size = 0;
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( char character ) noexcept -> Result<void>
+{
+    return put( static_cast<std::uint8_t>( character ) );
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+    -> Result<void>
+{
+    return encode(
+        reinterpret_cast<std::uint8_t const *>( begin ),
+        reinterpret_cast<std::uint8_t const *>( end ) );
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( char const * string ) noexcept -> Result<void>
+{
+    return put( string, string + std::strlen( string ) );
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( std::uint8_t data ) noexcept -> Result<void>
+{
+    m_frame_in_progress = true;
+
+    if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+        auto result = write_block();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // if
+
+    if ( data == COBS_FRAME_DELIMITER ) {
+        return write_block();
+    } // if
+
+    ++m_size;
+    m_block[ m_size ] = data;
+
+    return {};
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<void>
+{
+    return encode( begin, end );
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+    -> Result<void>
+{
+    for ( ; begin != end; ++begin ) {
+        auto result = put( begin->begin, begin->end );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // for
+
+    return {};
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::flush() noexcept -> Result<void>
+{
+    if ( m_frame_in_progress ) {
+        auto result = end_frame();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // if
+
+    return m_driver->flush();
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::end_frame() noexcept -> Result<void>
+{
+    m_frame_in_progress = false;
+
+    return write_block( 1 );
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<void>
+{
+    if ( begin == end ) {
+        return {};
+    } // if
+
+    m_frame_in_progress = true;
+
+    for ( ;; ) {
+        auto const delimiter = find_delimiter( begin, end );
+
+        while ( begin != delimiter ) {
+            if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+                auto result = write_block();
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+
+            auto const available = static_cast<std::size_t>( COBS_MAX_BLOCK_SIZE - m_size );
+            auto const requested = static_cast<std::size_t>( delimiter - begin );
+            auto const n         = requested < available ? requested : available;
+
+            std::memcpy( m_block.begin() + 1 + m_size, begin, n );
+            m_size += n;
+            begin += n;
+        } // while
+
+        if ( delimiter == end ) {
+            return {};
+        } // if
+
+        if ( m_size == COBS_MAX_BLOCK_SIZE ) {
+            auto result = write_block();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        auto result = write_block();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        ++begin;
+    } // for
+}
+
+auto Fault_Reporting_COBS_Stream_IO_Driver::write_block( std::uint_fast8_t delimiter ) noexcept
+    -> Result<void>
+{
+    m_block[ 0 ]          = static_cast<std::uint8_t>( m_size + 1 );
+    m_block[ 1 + m_size ] = COBS_FRAME_DELIMITER;
+
+    auto const size = m_size;
+
+    m_size = 0;
+
+    return m_driver->put( m_block.begin(), m_block.begin() + 1 + size + delimiter );
+}
+
+} // namespace microlibrary
@@ -0,0 +1,278 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Serial Line Internet Protocol (SLIP) framing implementation.
+ */
+
+#include "microlibrary/slip.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+namespace {
+
+/**
+ * \brief Escaped SLIP frame delimiter sequence.
+ */
+constexpr std::uint8_t ESCAPED_END[] = { SLIP_ESC, SLIP_ESC_END };
+
+/**
+ * \brief Escaped SLIP escape sequence.
+ */
+constexpr std::uint8_t ESCAPED_ESC[] = { SLIP_ESC, SLIP_ESC_ESC };
+
+/**
+ * \brief Check if a byte must be escaped.
+ *
+ * \param[in] byte The byte to check.
+ *
+ * \return true if the byte must be escaped.
+ * \return false if the byte does not need to be escaped.
+ */
+constexpr auto must_be_escaped( std::uint8_t byte ) noexcept -> bool
+{
+    return byte == SLIP_END or byte == SLIP_ESC;
+}
+
+/**
+ * \brief Get the escape sequence for a byte that must be escaped.
+ *
+ * \param[in] byte The byte that must be escaped.
+ *
+ * \return The beginning of the escape sequence (escape sequences are two bytes long).
+ */
+constexpr auto escape_sequence( std::uint8_t byte ) noexcept -> std::uint8_t const *
+{
+    return byte == SLIP_END ? ESCAPED_END : ESCAPED_ESC;
+}
+
+/**
+ * \brief Find the next byte that must be escaped in a block of data.
+ *
+ * \param[in] begin The beginning of the block of data to search.
+ * \param[in] end The end of the block of data to search.
+ *
+ * \return The location of the next byte that must be escaped if the block of data
+ *         contains a byte that must be escaped.
+ * \return end if the block of data does not contain a byte that must be escaped.
+ */
+auto find_escapee( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint8_t const *
+{
+    while ( begin != end and not must_be_escaped( *begin ) ) { ++begin; } // while
+
+    return begin;
+}
+
+} // namespace
+
+void SLIP_Stream_IO_Driver::put( char character ) noexcept
+{
+    put( static_cast<std::uint8_t>( character ) );
+}
+
+void SLIP_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+{
+    encode(
+        reinterpret_cast<std::uint8_t const *>( begin ),
+        reinterpret_cast<std::uint8_t const *>( end ) );
+}
+
+void SLIP_Stream_IO_Driver::put( char const * string ) noexcept
+{
+    put( string, string + std::strlen( string ) );
+}
+
+void SLIP_Stream_IO_Driver::put( std::uint8_t data ) noexcept
+{
+    m_frame_in_progress = true;
+
+    if ( must_be_escaped( data ) ) {
+        auto const sequence = escape_sequence( data );
+
+        m_driver->put( sequence, sequence + 2 );
+
+        return;
+    } // if
+
+    m_driver->put( data );
+}
+
+void SLIP_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    encode( begin, end );
+}
+
+void SLIP_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+{
+    for ( ; begin != end; ++begin ) { put( begin->begin, begin->end ); } // for
+}
+
+void SLIP_Stream_IO_Driver::flush() noexcept
+{
+    if ( m_frame_in_progress ) {
+        end_frame();
+    } // if
+
+    m_driver->flush();
+}
+
+void SLIP_Stream_IO_Driver::end_frame() noexcept
+{
+    m_driver->put( SLIP_END );
+
+    m_frame_in_progress = false;
+}
+
+void SLIP_Stream_IO_Driver::encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    if ( begin == end ) {
+        return;
+    } // if
+
+    m_frame_in_progress = true;
+
+    for ( ;; ) {
+        auto const escapee = find_escapee( begin, end );
+
+        if ( escapee != begin ) {
+            m_driver->put( begin, escapee );
+        } // if
+
+        if ( escapee == end ) {
+            return;
+        } // if
+
+        auto const sequence = escape_sequence( *escapee );
+
+        m_driver->put( sequence, sequence + 2 );
+
+        begin = escapee + 1;
+    } // for
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( char character ) noexcept -> Result<void>
+{
+    return put( static_cast<std::uint8_t>( character ) );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+    -> Result<void>
+{
+    return encode(
+        reinterpret_cast<std::uint8_t const *>( begin ),
+        reinterpret_cast<std::uint8_t const *>( end ) );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( char const * string ) noexcept -> Result<void>
+{
+    return put( string, string + std::strlen( string ) );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( std::uint8_t data ) noexcept -> Result<void>
+{
+    m_frame_in_progress = true;
+
+    if ( must_be_escaped( data ) ) {
+        auto const sequence = escape_sequence( data );
+
+        return m_driver->put( sequence, sequence + 2 );
+    } // if
+
+    return m_driver->put( data );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<void>
+{
+    return encode( begin, end );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+    -> Result<void>
+{
+    for ( ; begin != end; ++begin ) {
+        auto result = put( begin->begin, begin->end );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // for
+
+    return {};
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::flush() noexcept -> Result<void>
+{
+    if ( m_frame_in_progress ) {
+        auto result = end_frame();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }     // if
+
+    return m_driver->flush();
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::end_frame() noexcept -> Result<void>
+{
+    m_frame_in_progress = false;
+
+    return m_driver->put( SLIP_END );
+}
+
+auto Fault_Reporting_SLIP_Stream_IO_Driver::encode( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<void>
+{
+    if ( begin == end ) {
+        return {};
+    } // if
+
+    m_frame_in_progress = true;
+
+    for ( ;; ) {
+        auto const escapee = find_escapee( begin, end );
+
+        if ( escapee != begin ) {
+            auto result = m_driver->put( begin, escapee );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        if ( escapee == end ) {
+            return {};
+        } // if
+
+        auto const sequence = escape_sequence( *escapee );
+
+        auto result = m_driver->put( sequence, sequence + 2 );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        begin = escapee + 1;
+    } // for
+}
+
+} // namespace microlibrary
@@ -57,6 +57,36 @@ void Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end
     ::microlibrary::for_each( begin, end, [ this ]( auto data ) noexcept { put( data ); } );
 }
 
+void Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+{
+    ::microlibrary::for_each(
+        begin, end, [ this ]( auto block ) noexcept { put( block.begin, block.end ); } );
+}
+
+auto Stream_IO_Driver::reserve( std::size_t ) noexcept -> char *
+{
+    return nullptr;
+}
+
+void Stream_IO_Driver::commit( std::size_t ) noexcept
+{
+}
+
+auto Stream_IO_Driver::available() noexcept -> std::size_t
+{
+    return 0;
+}
+
+auto Stream_IO_Driver::get( char * begin, char * ) noexcept -> char *
+{
+    return begin;
+}
+
+auto Stream_IO_Driver::get( std::uint8_t * begin, std::uint8_t * ) noexcept -> std::uint8_t *
+{
+    return begin;
+}
+
 auto Fault_Reporting_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
     -> Result<void>
 {
@@ -97,6 +127,39 @@ auto Fault_Reporting_Stream_IO_Driver::put( std::uint8_t const * begin, std::uin
         begin, end, [ this ]( auto data ) noexcept { return put( data ); } );
 }
 
+auto Fault_Reporting_Stream_IO_Driver::put( Character_Block const * begin, Character_Block const * end ) noexcept
+    -> Result<void>
+{
+    return ::microlibrary::for_each<Functor_Reports_Errors_Discard_Functor>(
+        begin, end, [ this ]( auto block ) noexcept { return put( block.begin, block.end ); } );
+}
+
+auto Fault_Reporting_Stream_IO_Driver::reserve( std::size_t ) noexcept -> Result<char *>
+{
+    return static_cast<char *>( nullptr );
+}
+
+auto Fault_Reporting_Stream_IO_Driver::commit( std::size_t ) noexcept -> Result<void>
+{
+    return {};
+}
+
+auto Fault_Reporting_Stream_IO_Driver::available() noexcept -> Result<std::size_t>
+{
+    return std::size_t{ 0 };
+}
+
+auto Fault_Reporting_Stream_IO_Driver::get( char * begin, char * ) noexcept -> Result<char *>
+{
+    return begin;
+}
+
+auto Fault_Reporting_Stream_IO_Driver::get( std::uint8_t * begin, std::uint8_t * ) noexcept
+    -> Result<std::uint8_t *>
+{
+    return begin;
+}
+
 void Output_Stream::put( char character ) noexcept
 {
     MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
@@ -141,6 +204,27 @@ void Output_Stream::put( std::uint8_t const * begin, std::uint8_t const * end )
     driver()->put( begin, end );
 }
 
+void Output_Stream::put( Character_Block const * begin, Character_Block const * end ) noexcept
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    driver()->put( begin, end );
+}
+
+auto Output_Stream::reserve( std::size_t n ) noexcept -> char *
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    return driver()->reserve( n );
+}
+
+void Output_Stream::commit( std::size_t n ) noexcept
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    driver()->commit( n );
+}
+
 void Output_Stream::flush() noexcept
 {
     MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
@@ -236,6 +320,49 @@ auto Fault_Reporting_Output_Stream::put( std::uint8_t const * begin, std::uint8_
     return {};
 }
 
+auto Fault_Reporting_Output_Stream::put( Character_Block const * begin, Character_Block const * end ) noexcept
+    -> Result<void>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    auto result = driver()->put( begin, end );
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    return {};
+}
+
+auto Fault_Reporting_Output_Stream::reserve( std::size_t n ) noexcept -> Result<char *>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    auto result = driver()->reserve( n );
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    return result.value();
+}
+
+auto Fault_Reporting_Output_Stream::commit( std::size_t n ) noexcept -> Result<void>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    auto result = driver()->commit( n );
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    return {};
+}
+
 auto Fault_Reporting_Output_Stream::flush() noexcept -> Result<void>
 {
     MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
@@ -250,6 +377,201 @@ auto Fault_Reporting_Output_Stream::flush() noexcept -> Result<void>
     return {};
 }
 
+auto Input_Stream::available() noexcept -> std::size_t
+{
+    return ( m_lookahead_is_valid ? 1 : 0 ) + driver()->available();
+}
+
+void Input_Stream::peek( char & character ) noexcept
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( not m_lookahead_is_valid ) {
+        if ( driver()->get( &m_lookahead, &m_lookahead + 1 ) == &m_lookahead ) {
+            report_end_of_file_reached();
+
+            return;
+        } // if
+
+        m_lookahead_is_valid = true;
+    } // if
+
+    character = m_lookahead;
+}
+
+void Input_Stream::get( char & character ) noexcept
+{
+    static_cast<void>( get( &character, &character + 1 ) );
+}
+
+auto Input_Stream::get( char * begin, char * end ) noexcept -> char *
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( begin != end and m_lookahead_is_valid ) {
+        *begin = m_lookahead;
+        ++begin;
+
+        m_lookahead_is_valid = false;
+    } // if
+
+    if ( begin == end ) {
+        return end;
+    } // if
+
+    auto const read_end = driver()->get( begin, end );
+    if ( read_end != end ) {
+        report_end_of_file_reached();
+    } // if
+
+    return read_end;
+}
+
+void Input_Stream::get( std::uint8_t & data ) noexcept
+{
+    static_cast<void>( get( &data, &data + 1 ) );
+}
+
+auto Input_Stream::get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t *
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( begin != end and m_lookahead_is_valid ) {
+        *begin = static_cast<std::uint8_t>( m_lookahead );
+        ++begin;
+
+        m_lookahead_is_valid = false;
+    } // if
+
+    if ( begin == end ) {
+        return end;
+    } // if
+
+    auto const read_end = driver()->get( begin, end );
+    if ( read_end != end ) {
+        report_end_of_file_reached();
+    } // if
+
+    return read_end;
+}
+
+auto Fault_Reporting_Input_Stream::available() noexcept -> Result<std::size_t>
+{
+    auto result = driver()->available();
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    return ( m_lookahead_is_valid ? 1 : 0 ) + result.value();
+}
+
+auto Fault_Reporting_Input_Stream::peek( char & character ) noexcept -> Result<void>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( not m_lookahead_is_valid ) {
+        auto result = driver()->get( &m_lookahead, &m_lookahead + 1 );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        if ( result.value() == &m_lookahead ) {
+            report_end_of_file_reached();
+
+            return {};
+        } // if
+
+        m_lookahead_is_valid = true;
+    } // if
+
+    character = m_lookahead;
+
+    return {};
+}
+
+auto Fault_Reporting_Input_Stream::get( char & character ) noexcept -> Result<void>
+{
+    auto result = get( &character, &character + 1 );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return {};
+}
+
+auto Fault_Reporting_Input_Stream::get( char * begin, char * end ) noexcept -> Result<char *>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( begin != end and m_lookahead_is_valid ) {
+        *begin = m_lookahead;
+        ++begin;
+
+        m_lookahead_is_valid = false;
+    } // if
+
+    if ( begin == end ) {
+        return end;
+    } // if
+
+    auto result = driver()->get( begin, end );
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    if ( result.value() != end ) {
+        report_end_of_file_reached();
+    } // if
+
+    return result.value();
+}
+
+auto Fault_Reporting_Input_Stream::get( std::uint8_t & data ) noexcept -> Result<void>
+{
+    auto result = get( &data, &data + 1 );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return {};
+}
+
+auto Fault_Reporting_Input_Stream::get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+    -> Result<std::uint8_t *>
+{
+    MICROLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+    if ( begin != end and m_lookahead_is_valid ) {
+        *begin = static_cast<std::uint8_t>( m_lookahead );
+        ++begin;
+
+        m_lookahead_is_valid = false;
+    } // if
+
+    if ( begin == end ) {
+        return end;
+    } // if
+
+    auto result = driver()->get( begin, end );
+    if ( result.is_error() ) {
+        report_fatal_error();
+
+        return result.error();
+    } // if
+
+    if ( result.value() != end ) {
+        report_end_of_file_reached();
+    } // if
+
+    return result.value();
+}
+
 auto Output_Formatter<char>::print( Output_Stream & stream, char character ) const noexcept -> std::size_t
 {
     stream.put( character );
@@ -324,4 +646,23 @@ auto Output_Formatter<Error_Code>::print( Fault_Reporting_Output_Stream & stream
         error.category().name(), MICROLIBRARY_ROM_STRING( "::" ), error.description() );
 }
 
+auto Input_Formatter<char>::scan( Input_Stream & stream, char & character ) const noexcept
+    -> std::size_t
+{
+    stream.get( character );
+
+    return stream.end_of_file_reached() ? 0 : 1;
+}
+
+auto Input_Formatter<char>::scan( Fault_Reporting_Input_Stream & stream, char & character ) const
+    noexcept -> Result<std::size_t>
+{
+    auto result = stream.get( character );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return std::size_t{ stream.end_of_file_reached() ? 0U : 1U };
+}
+
 } // namespace microlibrary
@@ -0,0 +1,302 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log_Decoder interface.
+ */
+
+#ifndef MICROLIBRARY_LOG_DECODER_H
+#define MICROLIBRARY_LOG_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <type_traits>
+#include <utility>
+
+#include "microlibrary/format.h"
+#include "microlibrary/log.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+/**
+ * \brief Binary log record decoder.
+ *
+ * Reconstructs the text of binary log records written by microlibrary::Log::write() using
+ * the same output formatters that would have been used on the device.
+ *
+ * \attention Each format string must be added (with the same argument types that are used
+ *            on the device) before records that use it can be decoded. To prevent the
+ *            decoder's format strings from drifting from the device's, define each
+ *            message once using microlibrary::Log::Message in a header that is shared by
+ *            the device code and the decoder, and add the messages instead of their
+ *            format strings.
+ */
+class Log_Decoder {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Log_Decoder() = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Log_Decoder( Log_Decoder && source ) = default;
+
+    Log_Decoder( Log_Decoder const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Log_Decoder() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Log_Decoder && expression ) -> Log_Decoder & = default;
+
+    auto operator=( Log_Decoder const & ) = delete;
+
+    /**
+     * \brief Add a format string.
+     *
+     * \tparam Types The argument types.
+     * \tparam N The size of the format string (including the null terminator).
+     *
+     * \param[in] format The format string.
+     *
+     * \return Nothing if the format string was added.
+     * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the format string is not
+     *         valid, does not match the argument types, or has the same format string ID
+     *         as a format string that has already been added.
+     */
+    template<typename... Types, std::size_t N>
+    auto add( char const ( &format )[ N ] ) -> Result<void>
+    {
+        return add_format<N - 1, Types...>( format );
+    }
+
+    /**
+     * \brief Add a message's format string.
+     *
+     * \tparam Source The message.
+     * \tparam Types The message's argument types.
+     *
+     * \return Nothing if the message's format string was added.
+     * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the message's format string
+     *         is not valid, does not match the message's argument types, or has the same
+     *         format string ID as a format string that has already been added.
+     */
+    template<typename Source, typename... Types>
+    auto add( Log::Message<Source, Types...> ) -> Result<void>
+    {
+        return add_format<Format::string_length( Source::string() ), Types...>( Source::string() );
+    }
+
+    /**
+     * \brief Decode a binary log record.
+     *
+     * \param[in] begin The beginning of the binary log data.
+     * \param[in] end The end of the binary log data.
+     * \param[in] stream The stream to write the decoded record's text to.
+     *
+     * \return The end of the decoded binary log record if decoding succeeded.
+     * \return microlibrary::Generic_Error::WOULD_UNDERFLOW if the binary log data does not
+     *         contain a complete record.
+     * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the record's format string
+     *         ID is unknown.
+     */
+    auto decode( std::uint8_t const * begin, std::uint8_t const * end, Output_Stream & stream ) const
+        -> Result<std::uint8_t const *>;
+
+  private:
+    /**
+     * \brief Format string entry.
+     */
+    struct Entry {
+        /**
+         * \brief The size of the record's arguments.
+         */
+        std::size_t size;
+
+        /**
+         * \brief Write the record's text to a stream.
+         */
+        std::function<std::size_t( Output_Stream &, std::uint8_t const * )> print;
+    };
+
+    /**
+     * \brief The format string entries.
+     */
+    std::map<Log::ID, Entry> m_entries{};
+
+    /**
+     * \brief Add a format string.
+     *
+     * \tparam N The length of the format string.
+     * \tparam Types The argument types.
+     *
+     * \param[in] format The null-terminated format string.
+     *
+     * \return Nothing if the format string was added.
+     * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the format string is not
+     *         valid, does not match the argument types, or has the same format string ID
+     *         as a format string that has already been added.
+     */
+    template<std::size_t N, typename... Types>
+    auto add_format( char const * format ) -> Result<void>
+    {
+        auto const parsed = Format::Parsed_String<N>{ format };
+
+        if ( not parsed.is_valid() or parsed.fields() != sizeof...( Types ) ) {
+            return Generic_Error::INVALID_ARGUMENT;
+        } // if
+
+        auto const inserted = m_entries.try_emplace(
+            Log::id<Types...>( format ),
+            Entry{ ( sizeof( Types ) + ... + 0 ),
+                   [ parsed ]( Output_Stream & stream, std::uint8_t const * arguments ) {
+                       return print<Types...>(
+                           stream, parsed, arguments, std::index_sequence_for<Types...>{} );
+                   } } );
+        if ( not inserted.second ) {
+            return Generic_Error::INVALID_ARGUMENT;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Deserialize an integer (little endian).
+     *
+     * \tparam Integer The type of integer to deserialize.
+     *
+     * \param[in] i The position of the serialized integer (updated to the position after
+     *            the serialized integer).
+     *
+     * \return The deserialized integer.
+     */
+    template<typename Integer>
+    static auto deserialize( std::uint8_t const *& i ) noexcept -> Integer
+    {
+        auto unsigned_integer = std::make_unsigned_t<Integer>{ 0 };
+
+        for ( auto byte = std::size_t{ 0 }; byte < sizeof( Integer ); ++byte ) {
+            unsigned_integer |= static_cast<std::make_unsigned_t<Integer>>(
+                static_cast<std::make_unsigned_t<Integer>>( i[ byte ] ) << ( 8 * byte ) );
+        } // for
+
+        i += sizeof( Integer );
+
+        Integer integer;
+        std::memcpy( &integer, &unsigned_integer, sizeof( integer ) );
+        return integer;
+    }
+
+    /**
+     * \brief Write a segment's literal text to a stream.
+     *
+     * \tparam N The length of the format string.
+     *
+     * \param[in] stream The stream to write the literal text to.
+     * \param[in] parsed The parsed format string.
+     * \param[in] position The position of the segment.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<std::size_t N>
+    static auto put_literal( Output_Stream & stream, Format::Parsed_String<N> const & parsed, std::size_t position ) noexcept
+        -> std::size_t
+    {
+        auto const segment = parsed.segment( position );
+
+        if ( segment.end != segment.begin ) {
+            stream.put( parsed.literals() + segment.begin, parsed.literals() + segment.end );
+        } // if
+
+        return segment.end - segment.begin;
+    }
+
+    /**
+     * \brief Write a formatted value to a stream.
+     *
+     * \tparam Type The type of value to format.
+     *
+     * \param[in] stream The stream to write the formatted value to.
+     * \param[in] specifier The replacement field's format specifier.
+     * \param[in] value The value to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<typename Type>
+    static auto print_field( Output_Stream & stream, char specifier, Type value ) noexcept -> std::size_t
+    {
+        switch ( specifier ) {
+            case 'b': return stream.print( Format::Bin{ value } );
+            case 'd': return stream.print( Format::Dec{ value } );
+            case 'x': return stream.print( Format::Hex{ value } );
+            default:
+                if constexpr ( std::is_same_v<Type, char> ) {
+                    return stream.print( value );
+                } else {
+                    return stream.print( Format::Dec{ value } );
+                } // else
+        } // switch
+    }
+
+    /**
+     * \brief Write a record's text to a stream.
+     *
+     * \tparam Types The argument types.
+     * \tparam N The length of the format string.
+     * \tparam I The argument indices.
+     *
+     * \param[in] stream The stream to write the record's text to.
+     * \param[in] parsed The parsed format string.
+     * \param[in] arguments The record's arguments.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<typename... Types, std::size_t N, std::size_t... I>
+    static auto print( Output_Stream & stream, Format::Parsed_String<N> const & parsed, [[maybe_unused]] std::uint8_t const * arguments, std::index_sequence<I...> ) noexcept
+        -> std::size_t
+    {
+        auto n = std::size_t{ 0 };
+
+        ( ( n += put_literal( stream, parsed, I ),
+            n += print_field( stream, parsed.segment( I ).specifier, deserialize<Types>( arguments ) ) ),
+          ... );
+
+        return n + put_literal( stream, parsed, sizeof...( Types ) );
+    }
+};
+
+} // namespace microlibrary
+
+#endif // MICROLIBRARY_LOG_DECODER_H
@@ -23,12 +23,557 @@
 #ifndef MICROLIBRARY_TESTING_AUTOMATED_REGISTER_H
 #define MICROLIBRARY_TESTING_AUTOMATED_REGISTER_H
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "gmock/gmock.h"
 
 namespace microlibrary::Testing::Automated {
 
+/**
+ * \brief Register access type.
+ */
+enum class Register_Access_Type : std::uint_fast8_t {
+    READ,      ///< Read.
+    WRITE,     ///< Write (assignment).
+    WRITE_AND, ///< Bitwise AND assignment (read-modify-write).
+    WRITE_OR,  ///< Bitwise OR assignment (read-modify-write).
+    WRITE_XOR, ///< Bitwise XOR assignment (read-modify-write).
+};
+
+/**
+ * \brief Insertion operator.
+ *
+ * \param[in] stream The stream to write the
+ *            microlibrary::Testing::Automated::Register_Access_Type to.
+ * \param[in] type The microlibrary::Testing::Automated::Register_Access_Type to write to
+ *            the stream.
+ *
+ * \return stream
+ */
+auto operator<<( std::ostream & stream, Register_Access_Type type ) -> std::ostream &;
+
+/**
+ * \brief Register access.
+ */
+struct Register_Access {
+    /**
+     * \brief The access's sequence number.
+     */
+    std::uint64_t sequence;
+
+    /**
+     * \brief The accessed register's address, relative to the tracer's base address.
+     */
+    std::uintptr_t offset;
+
+    /**
+     * \brief The access type.
+     */
+    Register_Access_Type type;
+
+    /**
+     * \brief The value that was read (microlibrary::Testing::Automated::Register_Access_Type::READ),
+     *        written (microlibrary::Testing::Automated::Register_Access_Type::WRITE), or
+     *        the read-modify-write operand (all other access types).
+     */
+    std::uint64_t value;
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+constexpr auto operator==( Register_Access const & lhs, Register_Access const & rhs ) noexcept -> bool
+{
+    return lhs.sequence == rhs.sequence and lhs.offset == rhs.offset
+           and lhs.type == rhs.type and lhs.value == rhs.value;
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+constexpr auto operator!=( Register_Access const & lhs, Register_Access const & rhs ) noexcept -> bool
+{
+    return not( lhs == rhs );
+}
+
+/**
+ * \brief Insertion operator.
+ *
+ * \param[in] stream The stream to write the
+ *            microlibrary::Testing::Automated::Register_Access to.
+ * \param[in] access The microlibrary::Testing::Automated::Register_Access to write to the
+ *            stream.
+ *
+ * \return stream
+ */
+auto operator<<( std::ostream & stream, Register_Access const & access ) -> std::ostream &;
+
+/**
+ * \brief Register tracer.
+ *
+ * Constructing a tracer makes it the active tracer, and destroying a tracer restores the
+ * previously active tracer. Mock registers and tracing registers report every access to
+ * the active tracer.
+ */
+class Register_Tracer {
+  public:
+    Register_Tracer( Register_Tracer && ) = delete;
+
+    Register_Tracer( Register_Tracer const & ) = delete;
+
+    auto operator=( Register_Tracer && ) = delete;
+
+    auto operator=( Register_Tracer const & ) = delete;
+
+    /**
+     * \brief Get the active tracer.
+     *
+     * \return The active tracer if there is an active tracer.
+     * \return nullptr if there is no active tracer.
+     */
+    static auto active() noexcept -> Register_Tracer *;
+
+    /**
+     * \brief Report a register access to the active tracer.
+     *
+     * \param[in] reg The accessed register.
+     * \param[in] type The access type.
+     * \param[in] value The value that was read, written, or the read-modify-write
+     *            operand.
+     *
+     * \return The value the register should report having read if the access is a read
+     *         (value if there is no active tracer).
+     */
+    static auto report( void const * reg, Register_Access_Type type, std::uint64_t value )
+        -> std::uint64_t;
+
+  protected:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] base The base address that register addresses are made relative to.
+     */
+    Register_Tracer( void const * base ) noexcept;
+
+    /**
+     * \brief Destructor.
+     */
+    virtual ~Register_Tracer() noexcept;
+
+    /**
+     * \brief Convert a register address to an offset relative to the tracer's base
+     *        address.
+     *
+     * \param[in] reg The register.
+     *
+     * \return The register's offset relative to the tracer's base address.
+     */
+    auto offset( void const * reg ) const noexcept -> std::uintptr_t;
+
+    /**
+     * \brief Handle a register access.
+     *
+     * \param[in] offset The accessed register's offset relative to the tracer's base
+     *            address.
+     * \param[in] type The access type.
+     * \param[in] value The value that was read, written, or the read-modify-write
+     *            operand.
+     *
+     * \return The value the register should report having read if the access is a read.
+     */
+    virtual auto access( std::uintptr_t offset, Register_Access_Type type, std::uint64_t value )
+        -> std::uint64_t = 0;
+
+  private:
+    /**
+     * \brief The base address that register addresses are made relative to.
+     */
+    std::uintptr_t m_base;
+
+    /**
+     * \brief The previously active tracer.
+     */
+    Register_Tracer * m_previous;
+};
+
+/**
+ * \brief Register access trace.
+ *
+ * Accesses are recorded into a ring buffer (the oldest accesses are dropped once the
+ * ring buffer is full). Per-register access counts include dropped accesses.
+ * Read-modify-write accesses are counted as a read and a write.
+ */
+class Register_Trace final : public Register_Tracer {
+  public:
+    /**
+     * \brief Per-register access counts.
+     */
+    struct Counts {
+        /**
+         * \brief The number of reads.
+         */
+        std::uint64_t reads;
+
+        /**
+         * \brief The number of writes.
+         */
+        std::uint64_t writes;
+    };
+
+    Register_Trace() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] capacity The capacity of the trace's ring buffer.
+     * \param[in] base The base address that register addresses are made relative to
+     *            (e.g. the address of the peripheral instance the traced registers are
+     *            in).
+     */
+    explicit Register_Trace( std::size_t capacity, void const * base = nullptr );
+
+    Register_Trace( Register_Trace && ) = delete;
+
+    Register_Trace( Register_Trace const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Register_Trace() noexcept override final = default;
+
+    auto operator=( Register_Trace && ) = delete;
+
+    auto operator=( Register_Trace const & ) = delete;
+
+    /**
+     * \brief Get the capacity of the trace's ring buffer.
+     *
+     * \return The capacity of the trace's ring buffer.
+     */
+    auto capacity() const noexcept -> std::size_t
+    {
+        return m_accesses.size();
+    }
+
+    /**
+     * \brief Get the recorded accesses.
+     *
+     * \return The recorded accesses (oldest first).
+     */
+    auto accesses() const -> std::vector<Register_Access>;
+
+    /**
+     * \brief Get the number of accesses that have been dropped because the ring buffer
+     *        was full.
+     *
+     * \return The number of accesses that have been dropped.
+     */
+    auto dropped() const noexcept -> std::uint64_t
+    {
+        return m_sequence - m_size;
+    }
+
+    /**
+     * \brief Get the access counts for a register.
+     *
+     * \param[in] reg The register.
+     *
+     * \return The register's access counts.
+     */
+    auto counts( void const * reg ) const -> Counts;
+
+    /**
+     * \brief Get the access counts for all registers.
+     *
+     * \return The access counts for all registers (keyed by register offset relative to
+     *         the trace's base address).
+     */
+    auto counts() const -> std::map<std::uintptr_t, Counts> const &
+    {
+        return m_counts;
+    }
+
+    /**
+     * \brief Clear the trace (recorded accesses, access counts, and the sequence number).
+     */
+    void clear() noexcept;
+
+  private:
+    /**
+     * \brief The ring buffer.
+     */
+    std::vector<Register_Access> m_accesses;
+
+    /**
+     * \brief The number of recorded accesses in the ring buffer.
+     */
+    std::size_t m_size{ 0 };
+
+    /**
+     * \brief The next access's sequence number.
+     */
+    std::uint64_t m_sequence{ 0 };
+
+    /**
+     * \brief The per-register access counts.
+     */
+    std::map<std::uintptr_t, Counts> m_counts{};
+
+    auto access( std::uintptr_t offset, Register_Access_Type type, std::uint64_t value )
+        -> std::uint64_t override final;
+};
+
+/**
+ * \brief Register access trace replay.
+ *
+ * While active, each register access is validated against the next access in a recorded
+ * trace. Register offsets and access types are validated for all accesses, and values are
+ * validated for all accesses other than reads. Reads report the recorded value to
+ * registers that can report it (microlibrary::Testing::Automated::Tracing_Register),
+ * allowing a driver to be replayed against a recorded device state.
+ */
+class Register_Trace_Replay final : public Register_Tracer {
+  public:
+    Register_Trace_Replay() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] trace The recorded trace to validate accesses against.
+     * \param[in] base The base address that register addresses are made relative to (e.g.
+     *            the address of the peripheral instance the replayed registers are in).
+     */
+    Register_Trace_Replay( std::vector<Register_Access> trace, void const * base = nullptr );
+
+    Register_Trace_Replay( Register_Trace_Replay && ) = delete;
+
+    Register_Trace_Replay( Register_Trace_Replay const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Register_Trace_Replay() noexcept override final = default;
+
+    auto operator=( Register_Trace_Replay && ) = delete;
+
+    auto operator=( Register_Trace_Replay const & ) = delete;
+
+    /**
+     * \brief Check if all recorded accesses have been replayed.
+     *
+     * \return true if all recorded accesses have been replayed.
+     * \return false if not all recorded accesses have been replayed.
+     */
+    auto complete() const noexcept -> bool
+    {
+        return m_position >= m_trace.size();
+    }
+
+    /**
+     * \brief Get the mismatches between the recorded trace and the replayed accesses.
+     *
+     * \return Descriptions of the mismatches between the recorded trace and the replayed
+     *         accesses.
+     */
+    auto mismatches() const noexcept -> std::vector<std::string> const &
+    {
+        return m_mismatches;
+    }
+
+    /**
+     * \brief Check if the replayed accesses match the recorded trace.
+     *
+     * \return true if all recorded accesses have been replayed and there are no
+     *         mismatches.
+     * \return false if not all recorded accesses have been replayed, or if there are
+     *         mismatches.
+     */
+    auto matches() const noexcept -> bool
+    {
+        return complete() and m_mismatches.empty();
+    }
+
+  private:
+    /**
+     * \brief The recorded trace.
+     */
+    std::vector<Register_Access> m_trace;
+
+    /**
+     * \brief The position of the next recorded access to validate against.
+     */
+    std::size_t m_position{ 0 };
+
+    /**
+     * \brief The mismatches between the recorded trace and the replayed accesses.
+     */
+    std::vector<std::string> m_mismatches{};
+
+    auto access( std::uintptr_t offset, Register_Access_Type type, std::uint64_t value )
+        -> std::uint64_t override final;
+};
+
+/**
+ * \brief Tracing register.
+ *
+ * A tracing register simulates a register's contents and reports every access to the
+ * active microlibrary::Testing::Automated::Register_Tracer.
+ *
+ * \tparam T The register's underlying integer type.
+ */
+template<typename T>
+class Tracing_Register {
+  public:
+    static_assert( std::is_integral_v<T> );
+
+    /**
+     * \brief The register's underlying integer type.
+     */
+    using Type = T;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] contents The register's initial contents.
+     */
+    constexpr explicit Tracing_Register( Type contents = 0 ) noexcept : m_contents{ contents }
+    {
+    }
+
+    Tracing_Register( Tracing_Register && ) = delete;
+
+    Tracing_Register( Tracing_Register const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tracing_Register() noexcept = default;
+
+    auto operator=( Tracing_Register && ) = delete;
+
+    auto operator=( Tracing_Register const & ) = delete;
+
+    /**
+     * \brief Get the register's contents without tracing the access.
+     *
+     * \return The register's contents.
+     */
+    constexpr auto contents() const noexcept -> Type
+    {
+        return m_contents;
+    }
+
+    /**
+     * \brief Set the register's contents without tracing the access (e.g. to simulate
+     *        hardware updating a status bit).
+     *
+     * \param[in] contents The register's new contents.
+     */
+    constexpr void set_contents( Type contents ) noexcept
+    {
+        m_contents = contents;
+    }
+
+    /**
+     * \brief Read the register.
+     *
+     * \return The register contents.
+     */
+    operator Type() const
+    {
+        return static_cast<Type>( Register_Tracer::report(
+            this, Register_Access_Type::READ, static_cast<std::uint64_t>( m_contents ) ) );
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to assign to the register.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Type expression ) -> Tracing_Register &
+    {
+        m_contents = expression;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE, static_cast<std::uint64_t>( expression ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise AND assignment operator.
+     *
+     * \param[in] expression The expression to bitwise AND into the register.
+     *
+     * \return The assigned to object.
+     */
+    auto operator&=( Type expression ) -> Tracing_Register &
+    {
+        m_contents &= expression;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_AND, static_cast<std::uint64_t>( expression ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise OR assignment operator.
+     *
+     * \param[in] expression The expression to bitwise OR into the register.
+     *
+     * \return The assigned to object.
+     */
+    auto operator|=( Type expression ) -> Tracing_Register &
+    {
+        m_contents |= expression;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_OR, static_cast<std::uint64_t>( expression ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise XOR assignment operator.
+     *
+     * \param[in] expression The expression to bitwise XOR into the register.
+     *
+     * \return The assigned to object.
+     */
+    auto operator^=( Type expression ) -> Tracing_Register &
+    {
+        m_contents ^= expression;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_XOR, static_cast<std::uint64_t>( expression ) );
+
+        return *this;
+    }
+
+  private:
+    /**
+     * \brief The register's contents.
+     */
+    Type m_contents;
+};
+
 /**
  * \brief Mock register.
  *
@@ -60,38 +605,96 @@ class Mock_Register {
     MOCK_METHOD( void, write_or, ( Type ) );
     MOCK_METHOD( void, write_xor, ( Type ) );
 
-    operator Type() const noexcept
+    operator Type() const
     {
-        return read();
+        ++m_reads;
+
+        auto const value = read();
+
+        Register_Tracer::report( this, Register_Access_Type::READ, static_cast<std::uint64_t>( value ) );
+
+        return value;
     }
 
-    auto operator=( Type expression ) noexcept -> Mock_Register &
+    auto operator=( Type expression ) -> Mock_Register &
     {
+        ++m_writes;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE, static_cast<std::uint64_t>( expression ) );
+
         write( expression );
 
         return *this;
     }
 
-    auto operator&=( Type expression ) noexcept -> Mock_Register &
+    auto operator&=( Type expression ) -> Mock_Register &
     {
+        ++m_reads;
+        ++m_writes;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_AND, static_cast<std::uint64_t>( expression ) );
+
         write_and( expression );
 
         return *this;
     }
 
-    auto operator|=( Type expression ) noexcept -> Mock_Register &
+    auto operator|=( Type expression ) -> Mock_Register &
     {
+        ++m_reads;
+        ++m_writes;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_OR, static_cast<std::uint64_t>( expression ) );
+
         write_or( expression );
 
         return *this;
     }
 
-    auto operator^=( Type expression ) noexcept -> Mock_Register &
+    auto operator^=( Type expression ) -> Mock_Register &
     {
+        ++m_reads;
+        ++m_writes;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE_XOR, static_cast<std::uint64_t>( expression ) );
+
         write_xor( expression );
 
         return *this;
     }
+
+    /**
+     * \brief Get the number of times the register has been read.
+     *
+     * \return The number of times the register has been read (bitwise AND, OR, and XOR
+     *         assignments are counted as a read and a write).
+     */
+    auto reads() const noexcept -> std::size_t
+    {
+        return m_reads;
+    }
+
+    /**
+     * \brief Get the number of times the register has been written.
+     *
+     * \return The number of times the register has been written (bitwise AND, OR, and
+     *         XOR assignments are counted as a read and a write).
+     */
+    auto writes() const noexcept -> std::size_t
+    {
+        return m_writes;
+    }
+
+  private:
+    /**
+     * \brief The number of times the register has been read.
+     */
+    mutable std::size_t m_reads{ 0 };
+
+    /**
+     * \brief The number of times the register has been written.
+     */
+    std::size_t m_writes{ 0 };
 };
 
 /**
@@ -120,10 +723,32 @@ class Mock_Read_Only_Register {
 
     MOCK_METHOD( Type, read, (), ( const ) );
 
-    operator Type() const noexcept
+    operator Type() const
+    {
+        ++m_reads;
+
+        auto const value = read();
+
+        Register_Tracer::report( this, Register_Access_Type::READ, static_cast<std::uint64_t>( value ) );
+
+        return value;
+    }
+
+    /**
+     * \brief Get the number of times the register has been read.
+     *
+     * \return The number of times the register has been read.
+     */
+    auto reads() const noexcept -> std::size_t
     {
-        return read();
+        return m_reads;
     }
+
+  private:
+    /**
+     * \brief The number of times the register has been read.
+     */
+    mutable std::size_t m_reads{ 0 };
 };
 
 /**
@@ -152,12 +777,32 @@ class Mock_Write_Only_Register {
 
     MOCK_METHOD( void, write, ( Type ) );
 
-    auto operator=( Type expression ) noexcept -> Mock_Write_Only_Register &
+    auto operator=( Type expression ) -> Mock_Write_Only_Register &
     {
+        ++m_writes;
+
+        Register_Tracer::report( this, Register_Access_Type::WRITE, static_cast<std::uint64_t>( expression ) );
+
         write( expression );
 
         return *this;
     }
+
+    /**
+     * \brief Get the number of times the register has been written.
+     *
+     * \return The number of times the register has been written.
+     */
+    auto writes() const noexcept -> std::size_t
+    {
+        return m_writes;
+    }
+
+  private:
+    /**
+     * \brief The number of times the register has been written.
+     */
+    std::size_t m_writes{ 0 };
 };
 
 } // namespace microlibrary::Testing::Automated
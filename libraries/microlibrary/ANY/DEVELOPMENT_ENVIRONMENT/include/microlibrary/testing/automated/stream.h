@@ -23,8 +23,10 @@
 #ifndef MICROLIBRARY_TESTING_AUTOMATED_STREAM_H
 #define MICROLIBRARY_TESTING_AUTOMATED_STREAM_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -71,7 +73,27 @@ class Mock_Stream_IO_Driver : public Stream_IO_Driver {
         put( std::vector<std::uint8_t>{ begin, end } );
     }
 
+    MOCK_METHOD( void, put, (std::vector<std::string>));
+
+    void put( Character_Block const * begin, Character_Block const * end ) noexcept override
+    {
+        auto blocks = std::vector<std::string>{};
+
+        for ( ; begin != end; ++begin ) { blocks.emplace_back( begin->begin, begin->end ); } // for
+
+        put( std::move( blocks ) );
+    }
+
     MOCK_METHOD( void, flush, (), ( noexcept, override ) );
+
+    MOCK_METHOD( char *, reserve, ( std::size_t ), ( noexcept, override ) );
+    MOCK_METHOD( void, commit, ( std::size_t ), ( noexcept, override ) );
+
+    MOCK_METHOD( std::size_t, available, (), ( noexcept, override ) );
+
+    MOCK_METHOD( char *, get, ( char *, char * ), ( noexcept, override ) );
+
+    MOCK_METHOD( std::uint8_t *, get, ( std::uint8_t *, std::uint8_t * ), ( noexcept, override ) );
 };
 
 /**
@@ -79,7 +101,12 @@ class Mock_Stream_IO_Driver : public Stream_IO_Driver {
  */
 class Mock_Fault_Reporting_Stream_IO_Driver : public Fault_Reporting_Stream_IO_Driver {
   public:
-    Mock_Fault_Reporting_Stream_IO_Driver() = default;
+    Mock_Fault_Reporting_Stream_IO_Driver()
+    {
+        // microlibrary::Result<char *> is not default constructible
+        ON_CALL( *this, reserve( ::testing::_ ) )
+            .WillByDefault( ::testing::Return( Result<char *>{ static_cast<char *>( nullptr ) } ) );
+    }
 
     Mock_Fault_Reporting_Stream_IO_Driver( Mock_Fault_Reporting_Stream_IO_Driver && ) = delete;
 
@@ -112,7 +139,27 @@ class Mock_Fault_Reporting_Stream_IO_Driver : public Fault_Reporting_Stream_IO_D
         return put( std::vector<std::uint8_t>{ begin, end } );
     }
 
+    MOCK_METHOD( Result<void>, put, (std::vector<std::string>));
+
+    auto put( Character_Block const * begin, Character_Block const * end ) noexcept -> Result<void> override
+    {
+        auto blocks = std::vector<std::string>{};
+
+        for ( ; begin != end; ++begin ) { blocks.emplace_back( begin->begin, begin->end ); } // for
+
+        return put( std::move( blocks ) );
+    }
+
     MOCK_METHOD( Result<void>, flush, (), ( noexcept, override ) );
+
+    MOCK_METHOD( Result<char *>, reserve, ( std::size_t ), ( noexcept, override ) );
+    MOCK_METHOD( Result<void>, commit, ( std::size_t ), ( noexcept, override ) );
+
+    MOCK_METHOD( Result<std::size_t>, available, (), ( noexcept, override ) );
+
+    MOCK_METHOD( Result<char *>, get, ( char *, char * ), ( noexcept, override ) );
+
+    MOCK_METHOD( Result<std::uint8_t *>, get, ( std::uint8_t *, std::uint8_t * ), ( noexcept, override ) );
 };
 
 /**
@@ -125,6 +172,15 @@ class String_Stream_IO_Driver final : public Stream_IO_Driver {
      */
     String_Stream_IO_Driver() = default;
 
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] string The string to read from.
+     */
+    String_Stream_IO_Driver( std::string string ) : m_string{ std::move( string ) }
+    {
+    }
+
     String_Stream_IO_Driver( String_Stream_IO_Driver && ) = delete;
 
     String_Stream_IO_Driver( String_Stream_IO_Driver const & ) = delete;
@@ -167,11 +223,44 @@ class String_Stream_IO_Driver final : public Stream_IO_Driver {
      */
     void flush() noexcept override final;
 
+    /**
+     * \brief Get the number of characters that have not been read from the string.
+     *
+     * \return The number of characters that have not been read from the string.
+     */
+    auto available() noexcept -> std::size_t override final;
+
+    /**
+     * \brief Read a block of characters from the string.
+     *
+     * \param[in] begin The beginning of the block of characters to read from the
+     *            string.
+     * \param[in] end The end of the block of characters to read from the string.
+     *
+     * \return The end of the block of characters that were read from the string.
+     */
+    auto get( char * begin, char * end ) noexcept -> char * override final;
+
+    /**
+     * \brief Read a block of data from the string.
+     *
+     * \param[in] begin The beginning of the block of data to read from the string.
+     * \param[in] end The end of the block of data to read from the string.
+     *
+     * \return The end of the block of data that was read from the string.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t * override final;
+
   private:
     /**
      * \brief The string wrapped by the stream I/O driver.
      */
     std::string m_string{};
+
+    /**
+     * \brief The position of the next character to be read from the string.
+     */
+    std::string::size_type m_position{ 0 };
 };
 
 /**
@@ -184,6 +273,16 @@ class Fault_Reporting_String_Stream_IO_Driver final : public Fault_Reporting_Str
      */
     Fault_Reporting_String_Stream_IO_Driver() = default;
 
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] string The string to read from.
+     */
+    Fault_Reporting_String_Stream_IO_Driver( std::string string ) :
+        m_string{ std::move( string ) }
+    {
+    }
+
     Fault_Reporting_String_Stream_IO_Driver( Fault_Reporting_String_Stream_IO_Driver && ) = delete;
 
     Fault_Reporting_String_Stream_IO_Driver( Fault_Reporting_String_Stream_IO_Driver const & ) = delete;
@@ -232,11 +331,45 @@ class Fault_Reporting_String_Stream_IO_Driver final : public Fault_Reporting_Str
      */
     auto flush() noexcept -> Result<void> override final;
 
+    /**
+     * \brief Get the number of characters that have not been read from the string.
+     *
+     * \return The number of characters that have not been read from the string.
+     */
+    auto available() noexcept -> Result<std::size_t> override final;
+
+    /**
+     * \brief Read a block of characters from the string.
+     *
+     * \param[in] begin The beginning of the block of characters to read from the
+     *            string.
+     * \param[in] end The end of the block of characters to read from the string.
+     *
+     * \return The end of the block of characters that were read from the string.
+     */
+    auto get( char * begin, char * end ) noexcept -> Result<char *> override final;
+
+    /**
+     * \brief Read a block of data from the string.
+     *
+     * \param[in] begin The beginning of the block of data to read from the string.
+     * \param[in] end The end of the block of data to read from the string.
+     *
+     * \return The end of the block of data that was read from the string.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+        -> Result<std::uint8_t *> override final;
+
   private:
     /**
      * \brief The string wrapped by the stream I/O driver.
      */
     std::string m_string{};
+
+    /**
+     * \brief The position of the next character to be read from the string.
+     */
+    std::string::size_type m_position{ 0 };
 };
 
 /**
@@ -614,6 +747,129 @@ class Fault_Reporting_Output_Vector_Stream : public Fault_Reporting_Output_Strea
     Fault_Reporting_Vector_Stream_IO_Driver<T> m_driver{};
 };
 
+/**
+ * \brief Mock input stream.
+ */
+class Mock_Input_Stream : public Input_Stream {
+  public:
+    Mock_Input_Stream()
+    {
+        set_driver( &m_driver );
+    }
+
+    Mock_Input_Stream( Mock_Input_Stream && ) = delete;
+
+    Mock_Input_Stream( Mock_Input_Stream const & ) = delete;
+
+    ~Mock_Input_Stream() noexcept = default;
+
+    auto operator=( Mock_Input_Stream && ) = delete;
+
+    auto operator=( Mock_Input_Stream const & ) = delete;
+
+    auto driver() noexcept -> Mock_Stream_IO_Driver &
+    {
+        return m_driver;
+    }
+
+  private:
+    Mock_Stream_IO_Driver m_driver{};
+};
+
+/**
+ * \brief Mock fault reporting input stream.
+ */
+class Mock_Fault_Reporting_Input_Stream : public Fault_Reporting_Input_Stream {
+  public:
+    Mock_Fault_Reporting_Input_Stream()
+    {
+        set_driver( &m_driver );
+    }
+
+    Mock_Fault_Reporting_Input_Stream( Mock_Fault_Reporting_Input_Stream && ) = delete;
+
+    Mock_Fault_Reporting_Input_Stream( Mock_Fault_Reporting_Input_Stream const & ) = delete;
+
+    ~Mock_Fault_Reporting_Input_Stream() noexcept = default;
+
+    auto operator=( Mock_Fault_Reporting_Input_Stream && ) = delete;
+
+    auto operator=( Mock_Fault_Reporting_Input_Stream const & ) = delete;
+
+    auto driver() noexcept -> Mock_Fault_Reporting_Stream_IO_Driver &
+    {
+        return m_driver;
+    }
+
+  private:
+    Mock_Fault_Reporting_Stream_IO_Driver m_driver{};
+};
+
+/**
+ * \brief Input string stream.
+ */
+class Input_String_Stream : public Input_Stream {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] string The string to read from.
+     */
+    Input_String_Stream( std::string string ) : m_driver{ std::move( string ) }
+    {
+        set_driver( &m_driver );
+    }
+
+    Input_String_Stream( Input_String_Stream && ) = delete;
+
+    Input_String_Stream( Input_String_Stream const & ) = delete;
+
+    ~Input_String_Stream() noexcept = default;
+
+    auto operator=( Input_String_Stream && ) = delete;
+
+    auto operator=( Input_String_Stream const & ) = delete;
+
+  private:
+    /**
+     * \brief The stream's I/O driver.
+     */
+    String_Stream_IO_Driver m_driver;
+};
+
+/**
+ * \brief Fault reporting input string stream.
+ */
+class Fault_Reporting_Input_String_Stream : public Fault_Reporting_Input_Stream {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] string The string to read from.
+     */
+    Fault_Reporting_Input_String_Stream( std::string string ) :
+        m_driver{ std::move( string ) }
+    {
+        set_driver( &m_driver );
+    }
+
+    Fault_Reporting_Input_String_Stream( Fault_Reporting_Input_String_Stream && ) = delete;
+
+    Fault_Reporting_Input_String_Stream( Fault_Reporting_Input_String_Stream const & ) = delete;
+
+    ~Fault_Reporting_Input_String_Stream() noexcept = default;
+
+    auto operator=( Fault_Reporting_Input_String_Stream && ) = delete;
+
+    auto operator=( Fault_Reporting_Input_String_Stream const & ) = delete;
+
+  private:
+    /**
+     * \brief The stream's I/O driver.
+     */
+    Fault_Reporting_String_Stream_IO_Driver m_driver;
+};
+
 } // namespace microlibrary::Testing::Automated
 
 #endif // MICROLIBRARY_TESTING_AUTOMATED_STREAM_H
@@ -0,0 +1,423 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Testing::Benchmark interface.
+ */
+
+#ifndef MICROLIBRARY_TESTING_BENCHMARK_H
+#define MICROLIBRARY_TESTING_BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "microlibrary/stream.h"
+
+/**
+ * \brief Benchmarking facilities.
+ */
+namespace microlibrary::Testing::Benchmark {
+
+/**
+ * \brief Prevent the compiler from optimizing away the computation of a value.
+ *
+ * \tparam T The type of the value.
+ *
+ * \param[in] value The value.
+ */
+template<typename T>
+inline void do_not_optimize( T const & value ) noexcept
+{
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+}
+
+/**
+ * \brief Prevent the compiler from optimizing away or reordering memory accesses.
+ */
+inline void clobber_memory() noexcept
+{
+    asm volatile( "" : : : "memory" );
+}
+
+/**
+ * \brief Benchmark run options.
+ */
+struct Options {
+    /**
+     * \brief The minimum amount of time to run a benchmark before sampling it.
+     */
+    std::chrono::nanoseconds warm_up_time{ std::chrono::milliseconds{ 50 } };
+
+    /**
+     * \brief The minimum duration of a sample.
+     */
+    std::chrono::nanoseconds sample_time{ std::chrono::milliseconds{ 10 } };
+
+    /**
+     * \brief The number of samples to collect for each benchmark.
+     */
+    std::size_t repetitions{ 10 };
+
+    /**
+     * \brief Only run benchmarks whose name contains this string.
+     */
+    std::string filter{};
+};
+
+/**
+ * \brief Sample statistics.
+ */
+struct Statistics {
+    /**
+     * \brief The smallest sample.
+     */
+    double minimum;
+
+    /**
+     * \brief The largest sample.
+     */
+    double maximum;
+
+    /**
+     * \brief The mean of the samples.
+     */
+    double mean;
+
+    /**
+     * \brief The median of the samples.
+     */
+    double median;
+
+    /**
+     * \brief The sample standard deviation of the samples.
+     */
+    double standard_deviation;
+};
+
+/**
+ * \brief Summarize a set of samples.
+ *
+ * \param[in] samples The samples to summarize.
+ *
+ * \return The summary of the samples. If there are no samples, all statistics are 0.
+ */
+auto summarize( std::vector<double> samples ) -> Statistics;
+
+/**
+ * \brief Benchmark measurement.
+ */
+struct Measurement {
+    /**
+     * \brief The benchmark's name.
+     */
+    std::string name;
+
+    /**
+     * \brief The number of bytes processed by each operation (0 if not applicable).
+     */
+    std::size_t bytes_per_operation;
+
+    /**
+     * \brief The number of operations performed in each sample.
+     */
+    std::uint64_t iterations;
+
+    /**
+     * \brief The per-operation time, in nanoseconds, statistics.
+     */
+    Statistics nanoseconds_per_operation;
+
+    /**
+     * \brief User defined per-operation counters (e.g. downstream calls per operation).
+     */
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+/**
+ * \brief Write benchmark measurements to a stream as JSON.
+ *
+ * \param[in] stream The stream to write the benchmark measurements to.
+ * \param[in] suite The name of the benchmark suite.
+ * \param[in] options The options the benchmarks were run with.
+ * \param[in] measurements The benchmark measurements.
+ */
+void write_json(
+    std::ostream &                   stream,
+    std::string const &              suite,
+    Options const &                  options,
+    std::vector<Measurement> const & measurements );
+
+/**
+ * \brief Benchmark suite.
+ */
+class Suite {
+  public:
+    /**
+     * \brief Benchmark body.
+     *
+     * The body performs the benchmarked operation the requested number of times.
+     */
+    using Body = std::function<void( std::uint64_t iterations )>;
+
+    /**
+     * \brief Benchmark counter.
+     *
+     * The counter returns the current value of a monotonically increasing count (e.g. the
+     * number of calls made to a stream I/O driver). The counter is read before and after
+     * an additional run of the benchmark, and the change per operation is reported.
+     */
+    using Counter = std::function<std::uint64_t()>;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] name The suite's name.
+     */
+    explicit Suite( std::string name );
+
+    Suite( Suite && ) = delete;
+
+    Suite( Suite const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Suite() noexcept = default;
+
+    auto operator=( Suite && ) = delete;
+
+    auto operator=( Suite const & ) = delete;
+
+    /**
+     * \brief Add a benchmark to the suite.
+     *
+     * \param[in] name The benchmark's name.
+     * \param[in] body The benchmark's body.
+     */
+    void add( std::string name, Body body );
+
+    /**
+     * \brief Add a benchmark that processes bytes to the suite.
+     *
+     * \param[in] name The benchmark's name.
+     * \param[in] bytes_per_operation The number of bytes processed by each operation.
+     * \param[in] body The benchmark's body.
+     */
+    void add( std::string name, std::size_t bytes_per_operation, Body body );
+
+    /**
+     * \brief Add a user defined counter to the most recently added benchmark.
+     *
+     * \param[in] name The counter's name.
+     * \param[in] counter The counter.
+     */
+    void count( std::string name, Counter counter );
+
+    /**
+     * \brief Run the suite's benchmarks.
+     *
+     * \param[in] options The options to run the benchmarks with.
+     *
+     * \return The benchmark measurements.
+     */
+    auto run( Options const & options ) const -> std::vector<Measurement>;
+
+    /**
+     * \brief Run the suite's benchmarks using options parsed from the command line, and
+     *        write the measurements to the standard output stream (or the file specified
+     *        using --output) as JSON.
+     *
+     * \param[in] argc The number of command line arguments.
+     * \param[in] argv The command line arguments.
+     *
+     * \return EXIT_SUCCESS if the benchmarks were run.
+     * \return EXIT_FAILURE if the command line arguments are invalid or the measurements
+     *         could not be written.
+     */
+    auto main( int argc, char const * const * argv ) const -> int;
+
+  private:
+    /**
+     * \brief Benchmark.
+     */
+    struct Benchmark {
+        /**
+         * \brief The benchmark's name.
+         */
+        std::string name;
+
+        /**
+         * \brief The number of bytes processed by each operation (0 if not applicable).
+         */
+        std::size_t bytes_per_operation;
+
+        /**
+         * \brief The benchmark's body.
+         */
+        Body body;
+
+        /**
+         * \brief The benchmark's user defined counters.
+         */
+        std::vector<std::pair<std::string, Counter>> counters;
+    };
+
+    /**
+     * \brief The suite's name.
+     */
+    std::string m_name;
+
+    /**
+     * \brief The suite's benchmarks.
+     */
+    std::vector<Benchmark> m_benchmarks{};
+};
+
+/**
+ * \brief Null stream I/O driver.
+ *
+ * All data written to the driver is discarded. The number of calls made to the driver is
+ * recorded so that the number of driver calls per operation can be reported.
+ */
+class Null_Stream_IO_Driver final : public Stream_IO_Driver {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] supports_reserve true if the driver supports writing directly to its
+     *            write buffer.
+     */
+    explicit Null_Stream_IO_Driver( bool supports_reserve = false ) noexcept :
+        m_supports_reserve{ supports_reserve }
+    {
+    }
+
+    Null_Stream_IO_Driver( Null_Stream_IO_Driver && ) = delete;
+
+    Null_Stream_IO_Driver( Null_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Null_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Null_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Null_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Get the number of calls that have been made to the driver.
+     *
+     * \return The number of calls that have been made to the driver.
+     */
+    auto calls() const noexcept -> std::uint64_t
+    {
+        return m_calls;
+    }
+
+    /**
+     * \brief Get the number of bytes that have been written to the driver.
+     *
+     * \return The number of bytes that have been written to the driver.
+     */
+    auto bytes() const noexcept -> std::uint64_t
+    {
+        return m_bytes;
+    }
+
+    void put( char character ) noexcept override final;
+
+    void put( char const * begin, char const * end ) noexcept override final;
+
+    void put( char const * string ) noexcept override final;
+
+    void put( std::uint8_t data ) noexcept override final;
+
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final;
+
+    void flush() noexcept override final;
+
+    auto reserve( std::size_t n ) noexcept -> char * override final;
+
+    void commit( std::size_t n ) noexcept override final;
+
+  private:
+    /**
+     * \brief The size of the write buffer.
+     */
+    static constexpr auto WRITE_BUFFER_SIZE = std::size_t{ 128 };
+
+    /**
+     * \brief The driver supports writing directly to its write buffer.
+     */
+    bool m_supports_reserve;
+
+    /**
+     * \brief The number of calls that have been made to the driver.
+     */
+    std::uint64_t m_calls{ 0 };
+
+    /**
+     * \brief The number of bytes that have been written to the driver.
+     */
+    std::uint64_t m_bytes{ 0 };
+
+    /**
+     * \brief The write buffer.
+     */
+    char m_write_buffer[ WRITE_BUFFER_SIZE ]{};
+};
+
+/**
+ * \brief Null output stream.
+ */
+class Null_Output_Stream : public Output_Stream {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream's I/O driver.
+     */
+    explicit Null_Output_Stream( Stream_IO_Driver & driver ) noexcept
+    {
+        set_driver( &driver );
+    }
+
+    Null_Output_Stream( Null_Output_Stream && ) = delete;
+
+    Null_Output_Stream( Null_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Null_Output_Stream() noexcept = default;
+
+    auto operator=( Null_Output_Stream && ) = delete;
+
+    auto operator=( Null_Output_Stream const & ) = delete;
+};
+
+} // namespace microlibrary::Testing::Benchmark
+
+#endif // MICROLIBRARY_TESTING_BENCHMARK_H
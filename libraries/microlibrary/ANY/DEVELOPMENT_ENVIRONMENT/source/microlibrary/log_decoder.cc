@@ -0,0 +1,57 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log_Decoder implementation.
+ */
+
+#include "microlibrary/log_decoder.h"
+
+#include <cstdint>
+
+#include "microlibrary/error.h"
+#include "microlibrary/log.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary {
+
+auto Log_Decoder::decode( std::uint8_t const * begin, std::uint8_t const * end, Output_Stream & stream ) const
+    -> Result<std::uint8_t const *>
+{
+    if ( static_cast<std::size_t>( end - begin ) < sizeof( Log::ID ) ) {
+        return Generic_Error::WOULD_UNDERFLOW;
+    } // if
+
+    auto const format_string_id = deserialize<Log::ID>( begin );
+
+    auto const entry = m_entries.find( format_string_id );
+    if ( entry == m_entries.end() ) {
+        return Generic_Error::INVALID_ARGUMENT;
+    } // if
+
+    if ( static_cast<std::size_t>( end - begin ) < entry->second.size ) {
+        return Generic_Error::WOULD_UNDERFLOW;
+    } // if
+
+    entry->second.print( stream, begin );
+
+    return begin + entry->second.size;
+}
+
+} // namespace microlibrary
@@ -55,6 +55,8 @@ auto operator<<( std::ostream & stream, Generic_Error generic_error ) -> std::os
         case Generic_Error::OUT_OF_RANGE: return stream << "::microlibrary::Generic_Error::OUT_OF_RANGE";
         case Generic_Error::RUNTIME_ERROR: return stream << "::microlibrary::Generic_Error::RUNTIME_ERROR";
         case Generic_Error::IO_STREAM_DEGRADED: return stream << "::microlibrary::Generic_Error::IO_STREAM_DEGRADED";
+        case Generic_Error::WOULD_OVERFLOW: return stream << "::microlibrary::Generic_Error::WOULD_OVERFLOW";
+        case Generic_Error::WOULD_UNDERFLOW: return stream << "::microlibrary::Generic_Error::WOULD_UNDERFLOW";
 
             // clang-format on
     } // switch
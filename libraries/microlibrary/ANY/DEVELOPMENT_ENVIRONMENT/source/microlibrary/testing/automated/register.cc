@@ -21,3 +21,191 @@
  */
 
 #include "microlibrary/testing/automated/register.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace microlibrary::Testing::Automated {
+
+namespace {
+
+/**
+ * \brief The active tracer.
+ */
+Register_Tracer * active_tracer = nullptr;
+
+} // namespace
+
+auto operator<<( std::ostream & stream, Register_Access_Type type ) -> std::ostream &
+{
+    switch ( type ) {
+            // clang-format off
+
+        case Register_Access_Type::READ: return stream << "::microlibrary::Testing::Automated::Register_Access_Type::READ";
+        case Register_Access_Type::WRITE: return stream << "::microlibrary::Testing::Automated::Register_Access_Type::WRITE";
+        case Register_Access_Type::WRITE_AND: return stream << "::microlibrary::Testing::Automated::Register_Access_Type::WRITE_AND";
+        case Register_Access_Type::WRITE_OR: return stream << "::microlibrary::Testing::Automated::Register_Access_Type::WRITE_OR";
+        case Register_Access_Type::WRITE_XOR: return stream << "::microlibrary::Testing::Automated::Register_Access_Type::WRITE_XOR";
+
+            // clang-format on
+    } // switch
+
+    throw std::invalid_argument{
+        "type is not a valid ::microlibrary::Testing::Automated::Register_Access_Type"
+    };
+}
+
+auto operator<<( std::ostream & stream, Register_Access const & access ) -> std::ostream &
+{
+    return stream << '#' << std::dec << access.sequence << " +0x" << std::hex
+                  << access.offset << ' ' << access.type << " 0x" << access.value
+                  << std::dec;
+}
+
+auto Register_Tracer::active() noexcept -> Register_Tracer *
+{
+    return active_tracer;
+}
+
+auto Register_Tracer::report( void const * reg, Register_Access_Type type, std::uint64_t value )
+    -> std::uint64_t
+{
+    if ( not active_tracer ) {
+        return value;
+    } // if
+
+    return active_tracer->access( active_tracer->offset( reg ), type, value );
+}
+
+Register_Tracer::Register_Tracer( void const * base ) noexcept :
+    m_base{ reinterpret_cast<std::uintptr_t>( base ) },
+    m_previous{ active_tracer }
+{
+    active_tracer = this;
+}
+
+Register_Tracer::~Register_Tracer() noexcept
+{
+    active_tracer = m_previous;
+}
+
+auto Register_Tracer::offset( void const * reg ) const noexcept -> std::uintptr_t
+{
+    return reinterpret_cast<std::uintptr_t>( reg ) - m_base;
+}
+
+Register_Trace::Register_Trace( std::size_t capacity, void const * base ) :
+    Register_Tracer{ base },
+    m_accesses( capacity )
+{
+    if ( not capacity ) {
+        throw std::invalid_argument{ "capacity must be greater than zero" };
+    } // if
+}
+
+auto Register_Trace::accesses() const -> std::vector<Register_Access>
+{
+    auto accesses = std::vector<Register_Access>{};
+    accesses.reserve( m_size );
+
+    auto const first = static_cast<std::size_t>( ( m_sequence - m_size ) % m_accesses.size() );
+
+    for ( auto i = std::size_t{ 0 }; i < m_size; ++i ) {
+        accesses.push_back( m_accesses[ ( first + i ) % m_accesses.size() ] );
+    } // for
+
+    return accesses;
+}
+
+auto Register_Trace::counts( void const * reg ) const -> Counts
+{
+    auto const counts = m_counts.find( offset( reg ) );
+
+    if ( counts == m_counts.end() ) {
+        return Counts{ 0, 0 };
+    } // if
+
+    return counts->second;
+}
+
+void Register_Trace::clear() noexcept
+{
+    m_size     = 0;
+    m_sequence = 0;
+    m_counts.clear();
+}
+
+auto Register_Trace::access( std::uintptr_t offset, Register_Access_Type type, std::uint64_t value )
+    -> std::uint64_t
+{
+    m_accesses[ static_cast<std::size_t>( m_sequence % m_accesses.size() ) ] = Register_Access{
+        m_sequence, offset, type, value
+    };
+
+    ++m_sequence;
+
+    if ( m_size < m_accesses.size() ) {
+        ++m_size;
+    } // if
+
+    auto & counts = m_counts[ offset ];
+
+    switch ( type ) {
+        case Register_Access_Type::READ: ++counts.reads; break;
+        case Register_Access_Type::WRITE: ++counts.writes; break;
+        case Register_Access_Type::WRITE_AND:
+        case Register_Access_Type::WRITE_OR:
+        case Register_Access_Type::WRITE_XOR:
+            ++counts.reads;
+            ++counts.writes;
+            break;
+    } // switch
+
+    return value;
+}
+
+Register_Trace_Replay::Register_Trace_Replay( std::vector<Register_Access> trace, void const * base ) :
+    Register_Tracer{ base },
+    m_trace{ std::move( trace ) }
+{
+}
+
+auto Register_Trace_Replay::access( std::uintptr_t offset, Register_Access_Type type, std::uint64_t value )
+    -> std::uint64_t
+{
+    auto const replayed = Register_Access{ m_position, offset, type, value };
+
+    if ( complete() ) {
+        auto stream = std::ostringstream{};
+        stream << "unexpected access " << replayed << " (trace has " << m_trace.size()
+               << " accesses)";
+        m_mismatches.push_back( stream.str() );
+
+        return value;
+    } // if
+
+    auto const & recorded = m_trace[ m_position ];
+
+    ++m_position;
+
+    if ( offset != recorded.offset or type != recorded.type
+         or ( type != Register_Access_Type::READ and value != recorded.value ) ) {
+        auto stream = std::ostringstream{};
+        stream << "access " << replayed << " does not match recorded access " << recorded;
+        m_mismatches.push_back( stream.str() );
+
+        return value;
+    } // if
+
+    return type == Register_Access_Type::READ ? recorded.value : value;
+}
+
+} // namespace microlibrary::Testing::Automated
@@ -22,6 +22,8 @@
 
 #include "microlibrary/testing/automated/stream.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 
 #include "microlibrary/result.h"
@@ -42,6 +44,34 @@ void String_Stream_IO_Driver::flush() noexcept
 {
 }
 
+auto String_Stream_IO_Driver::available() noexcept -> std::size_t
+{
+    return m_string.size() - m_position;
+}
+
+auto String_Stream_IO_Driver::get( char * begin, char * end ) noexcept -> char *
+{
+    auto const n = std::min<std::size_t>( end - begin, m_string.size() - m_position );
+
+    auto const read_end = std::copy_n( m_string.begin() + m_position, n, begin );
+
+    m_position += n;
+
+    return read_end;
+}
+
+auto String_Stream_IO_Driver::get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+    -> std::uint8_t *
+{
+    auto const n = std::min<std::size_t>( end - begin, m_string.size() - m_position );
+
+    auto const read_end = std::copy_n( m_string.begin() + m_position, n, begin );
+
+    m_position += n;
+
+    return read_end;
+}
+
 auto Fault_Reporting_String_Stream_IO_Driver::put( char character ) noexcept -> Result<void>
 {
     m_string.push_back( character );
@@ -61,4 +91,33 @@ auto Fault_Reporting_String_Stream_IO_Driver::flush() noexcept -> Result<void>
     return {};
 }
 
+auto Fault_Reporting_String_Stream_IO_Driver::available() noexcept -> Result<std::size_t>
+{
+    return m_string.size() - m_position;
+}
+
+auto Fault_Reporting_String_Stream_IO_Driver::get( char * begin, char * end ) noexcept
+    -> Result<char *>
+{
+    auto const n = std::min<std::size_t>( end - begin, m_string.size() - m_position );
+
+    auto const read_end = std::copy_n( m_string.begin() + m_position, n, begin );
+
+    m_position += n;
+
+    return read_end;
+}
+
+auto Fault_Reporting_String_Stream_IO_Driver::get( std::uint8_t * begin, std::uint8_t * end ) noexcept
+    -> Result<std::uint8_t *>
+{
+    auto const n = std::min<std::size_t>( end - begin, m_string.size() - m_position );
+
+    auto const read_end = std::copy_n( m_string.begin() + m_position, n, begin );
+
+    m_position += n;
+
+    return read_end;
+}
+
 } // namespace microlibrary::Testing::Automated
@@ -0,0 +1,464 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Testing::Benchmark implementation.
+ */
+
+#include "microlibrary/testing/benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <ios>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace microlibrary::Testing::Benchmark {
+
+namespace {
+
+/**
+ * \brief The clock used to time benchmarks.
+ */
+using Clock = std::chrono::steady_clock;
+
+/**
+ * \brief Time a benchmark.
+ *
+ * \param[in] body The benchmark's body.
+ * \param[in] iterations The number of operations to perform.
+ *
+ * \return The amount of time it took to perform the operations.
+ */
+auto time( Suite::Body const & body, std::uint64_t iterations ) -> std::chrono::nanoseconds
+{
+    auto const start = Clock::now();
+
+    body( iterations );
+    clobber_memory();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>( Clock::now() - start );
+}
+
+/**
+ * \brief Warm up a benchmark.
+ *
+ * \param[in] body The benchmark's body.
+ * \param[in] warm_up_time The minimum amount of time to run the benchmark.
+ */
+void warm_up( Suite::Body const & body, std::chrono::nanoseconds warm_up_time )
+{
+    auto elapsed = std::chrono::nanoseconds{ 0 };
+    for ( auto iterations = std::uint64_t{ 1 }; elapsed < warm_up_time; iterations *= 2 ) {
+        elapsed += time( body, iterations );
+    } // for
+}
+
+/**
+ * \brief Determine the number of operations a benchmark must perform to produce a sample
+ *        of a minimum duration.
+ *
+ * \param[in] body The benchmark's body.
+ * \param[in] sample_time The minimum duration of a sample.
+ *
+ * \return The number of operations the benchmark must perform to produce a sample of the
+ *         minimum duration.
+ */
+auto calibrate( Suite::Body const & body, std::chrono::nanoseconds sample_time ) -> std::uint64_t
+{
+    auto iterations = std::uint64_t{ 1 };
+
+    for ( ;; ) {
+        auto const elapsed = time( body, iterations );
+        if ( elapsed >= sample_time ) {
+            return iterations;
+        } // if
+
+        auto const scale = elapsed.count() > 0
+                               ? std::min( 1.4 * sample_time.count() / elapsed.count(), 10.0 )
+                               : 10.0;
+
+        iterations = std::max( iterations + 1, static_cast<std::uint64_t>( iterations * scale ) );
+    } // for
+}
+
+/**
+ * \brief Write a JSON string.
+ *
+ * \param[in] stream The stream to write the JSON string to.
+ * \param[in] string The string to write.
+ */
+void write_json_string( std::ostream & stream, std::string_view string )
+{
+    stream << '"';
+
+    for ( auto const character : string ) {
+        switch ( character ) {
+            case '"': stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n"; break;
+            case '\t': stream << "\\t"; break;
+            default: stream << character; break;
+        } // switch
+    }     // for
+
+    stream << '"';
+}
+
+/**
+ * \brief Write JSON statistics.
+ *
+ * \param[in] stream The stream to write the JSON statistics to.
+ * \param[in] statistics The statistics to write.
+ */
+void write_json_statistics( std::ostream & stream, Statistics const & statistics )
+{
+    stream << "{ "
+           << "\"minimum\": " << statistics.minimum << ", "
+           << "\"maximum\": " << statistics.maximum << ", "
+           << "\"mean\": " << statistics.mean << ", "
+           << "\"median\": " << statistics.median << ", "
+           << "\"standard_deviation\": " << statistics.standard_deviation << " }";
+}
+
+/**
+ * \brief Parse a command line argument value.
+ *
+ * \param[in] argument The command line argument value to parse.
+ * \param[out] value The parsed value.
+ *
+ * \return true if parsing succeeded.
+ * \return false if parsing failed.
+ */
+auto parse( char const * argument, std::uint64_t & value ) -> bool
+{
+    char * end = nullptr;
+
+    auto const parsed_value = std::strtoull( argument, &end, 10 );
+    if ( *argument == '\0' or *end != '\0' ) {
+        return false;
+    } // if
+
+    value = parsed_value;
+
+    return true;
+}
+
+/**
+ * \brief Write usage information.
+ *
+ * \param[in] stream The stream to write the usage information to.
+ * \param[in] name The name the program was invoked with.
+ */
+void write_usage( std::ostream & stream, char const * name )
+{
+    stream << "usage: " << name << " [options]\n"
+           << "    --filter <string>         Only run benchmarks whose name contains <string>.\n"
+           << "    --repetitions <n>         Collect <n> samples per benchmark (default: 10).\n"
+           << "    --warm-up-time <ms>       Run each benchmark for <ms> ms before sampling it (default: 50).\n"
+           << "    --sample-time <ms>        Make each sample last at least <ms> ms (default: 10).\n"
+           << "    --output <path>           Write the measurements to <path> instead of the standard output stream.\n"
+           << "    --help                    Display this help text.\n";
+}
+
+} // namespace
+
+auto summarize( std::vector<double> samples ) -> Statistics
+{
+    if ( samples.empty() ) {
+        return {};
+    } // if
+
+    std::sort( samples.begin(), samples.end() );
+
+    auto const n = samples.size();
+
+    auto sum = 0.0;
+    for ( auto const sample : samples ) { sum += sample; } // for
+    auto const mean = sum / n;
+
+    auto sum_of_squares = 0.0;
+    for ( auto const sample : samples ) {
+        sum_of_squares += ( sample - mean ) * ( sample - mean );
+    } // for
+
+    return {
+        samples.front(),
+        samples.back(),
+        mean,
+        n % 2 ? samples[ n / 2 ] : ( samples[ n / 2 - 1 ] + samples[ n / 2 ] ) / 2,
+        n > 1 ? std::sqrt( sum_of_squares / ( n - 1 ) ) : 0.0,
+    };
+}
+
+void write_json(
+    std::ostream &                   stream,
+    std::string const &              suite,
+    Options const &                  options,
+    std::vector<Measurement> const & measurements )
+{
+    auto const flags     = stream.flags();
+    auto const precision = stream.precision();
+
+    stream << std::fixed << std::setprecision( 3 );
+
+    stream << "{\n";
+
+    stream << "  \"suite\": ";
+    write_json_string( stream, suite );
+    stream << ",\n";
+
+    stream << "  \"options\": { "
+           << "\"warm_up_time_ns\": " << options.warm_up_time.count() << ", "
+           << "\"sample_time_ns\": " << options.sample_time.count() << ", "
+           << "\"repetitions\": " << options.repetitions << " },\n";
+
+    stream << "  \"benchmarks\": [";
+
+    for ( auto i = std::size_t{ 0 }; i < measurements.size(); ++i ) {
+        auto const & measurement = measurements[ i ];
+
+        stream << ( i ? "," : "" ) << "\n    {\n";
+
+        stream << "      \"name\": ";
+        write_json_string( stream, measurement.name );
+        stream << ",\n";
+
+        stream << "      \"iterations\": " << measurement.iterations << ",\n";
+
+        stream << "      \"ns_per_operation\": ";
+        write_json_statistics( stream, measurement.nanoseconds_per_operation );
+
+        if ( measurement.bytes_per_operation ) {
+            auto const median = measurement.nanoseconds_per_operation.median;
+
+            stream << ",\n      \"bytes_per_operation\": " << measurement.bytes_per_operation
+                   << ",\n      \"ns_per_byte\": " << median / measurement.bytes_per_operation
+                   << ",\n      \"bytes_per_second\": "
+                   << ( median > 0.0 ? measurement.bytes_per_operation * 1e9 / median : 0.0 );
+        } // if
+
+        if ( not measurement.counters.empty() ) {
+            stream << ",\n      \"counters\": {";
+            for ( auto j = std::size_t{ 0 }; j < measurement.counters.size(); ++j ) {
+                stream << ( j ? ", " : " " );
+                write_json_string( stream, measurement.counters[ j ].first );
+                stream << ": " << measurement.counters[ j ].second;
+            } // for
+            stream << " }";
+        } // if
+
+        stream << "\n    }";
+    } // for
+
+    stream << ( measurements.empty() ? "" : "\n  " ) << "]\n";
+
+    stream << "}\n";
+
+    stream.flags( flags );
+    stream.precision( precision );
+}
+
+Suite::Suite( std::string name ) :
+    m_name{ std::move( name ) }
+{
+}
+
+void Suite::add( std::string name, Body body )
+{
+    add( std::move( name ), 0, std::move( body ) );
+}
+
+void Suite::add( std::string name, std::size_t bytes_per_operation, Body body )
+{
+    m_benchmarks.push_back( { std::move( name ), bytes_per_operation, std::move( body ), {} } );
+}
+
+void Suite::count( std::string name, Counter counter )
+{
+    m_benchmarks.back().counters.emplace_back( std::move( name ), std::move( counter ) );
+}
+
+auto Suite::run( Options const & options ) const -> std::vector<Measurement>
+{
+    auto measurements = std::vector<Measurement>{};
+
+    for ( auto const & benchmark : m_benchmarks ) {
+        if ( benchmark.name.find( options.filter ) == std::string::npos ) {
+            continue;
+        } // if
+
+        warm_up( benchmark.body, options.warm_up_time );
+
+        auto const iterations = calibrate( benchmark.body, options.sample_time );
+
+        auto samples = std::vector<double>{};
+        samples.reserve( options.repetitions );
+        for ( auto repetition = std::size_t{ 0 }; repetition < options.repetitions; ++repetition ) {
+            samples.push_back(
+                static_cast<double>( time( benchmark.body, iterations ).count() ) / iterations );
+        } // for
+
+        auto counters = std::vector<std::pair<std::string, double>>{};
+        if ( not benchmark.counters.empty() ) {
+            auto initial_values = std::vector<std::uint64_t>{};
+            for ( auto const & counter : benchmark.counters ) {
+                initial_values.push_back( counter.second() );
+            } // for
+
+            benchmark.body( iterations );
+
+            for ( auto i = std::size_t{ 0 }; i < benchmark.counters.size(); ++i ) {
+                counters.emplace_back(
+                    benchmark.counters[ i ].first,
+                    static_cast<double>( benchmark.counters[ i ].second() - initial_values[ i ] )
+                        / iterations );
+            } // for
+        }     // if
+
+        measurements.push_back( { benchmark.name,
+                                  benchmark.bytes_per_operation,
+                                  iterations,
+                                  summarize( std::move( samples ) ),
+                                  std::move( counters ) } );
+    } // for
+
+    return measurements;
+}
+
+auto Suite::main( int argc, char const * const * argv ) const -> int
+{
+    auto options = Options{};
+    auto output  = std::string{};
+
+    for ( auto i = 1; i < argc; ++i ) {
+        auto const argument = std::string_view{ argv[ i ] };
+
+        if ( argument == "--help" ) {
+            write_usage( std::cout, argv[ 0 ] );
+
+            return EXIT_SUCCESS;
+        } // if
+
+        auto value = std::uint64_t{};
+
+        if ( i + 1 >= argc ) {
+            write_usage( std::cerr, argv[ 0 ] );
+
+            return EXIT_FAILURE;
+        } // if
+
+        if ( argument == "--filter" ) {
+            options.filter = argv[ ++i ];
+        } else if ( argument == "--output" ) {
+            output = argv[ ++i ];
+        } else if ( argument == "--repetitions" and parse( argv[ i + 1 ], value ) and value > 0 ) {
+            options.repetitions = value;
+            ++i;
+        } else if ( argument == "--warm-up-time" and parse( argv[ i + 1 ], value ) ) {
+            options.warm_up_time = std::chrono::milliseconds{ value };
+            ++i;
+        } else if ( argument == "--sample-time" and parse( argv[ i + 1 ], value ) and value > 0 ) {
+            options.sample_time = std::chrono::milliseconds{ value };
+            ++i;
+        } else {
+            write_usage( std::cerr, argv[ 0 ] );
+
+            return EXIT_FAILURE;
+        } // else
+    }     // for
+
+    if ( output.empty() ) {
+        write_json( std::cout, m_name, options, run( options ) );
+
+        return EXIT_SUCCESS;
+    } // if
+
+    auto stream = std::ofstream{ output };
+    if ( not stream ) {
+        std::cerr << argv[ 0 ] << ": unable to open '" << output << "'\n";
+
+        return EXIT_FAILURE;
+    } // if
+
+    write_json( stream, m_name, options, run( options ) );
+
+    return stream ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void Null_Stream_IO_Driver::put( char ) noexcept
+{
+    ++m_calls;
+    ++m_bytes;
+}
+
+void Null_Stream_IO_Driver::put( char const * begin, char const * end ) noexcept
+{
+    ++m_calls;
+    m_bytes += end - begin;
+}
+
+void Null_Stream_IO_Driver::put( char const * string ) noexcept
+{
+    ++m_calls;
+    m_bytes += std::strlen( string );
+}
+
+void Null_Stream_IO_Driver::put( std::uint8_t ) noexcept
+{
+    ++m_calls;
+    ++m_bytes;
+}
+
+void Null_Stream_IO_Driver::put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    ++m_calls;
+    m_bytes += end - begin;
+}
+
+void Null_Stream_IO_Driver::flush() noexcept
+{
+    ++m_calls;
+}
+
+auto Null_Stream_IO_Driver::reserve( std::size_t n ) noexcept -> char *
+{
+    ++m_calls;
+
+    return m_supports_reserve and n <= WRITE_BUFFER_SIZE ? m_write_buffer : nullptr;
+}
+
+void Null_Stream_IO_Driver::commit( std::size_t n ) noexcept
+{
+    ++m_calls;
+    m_bytes += n;
+}
+
+} // namespace microlibrary::Testing::Benchmark
@@ -385,6 +385,13 @@ constexpr auto operator-( String lhs, String rhs ) noexcept -> std::ptrdiff_t
 #define MICROLIBRARY_ROM_STRING( string ) \
     ( ::microlibrary::ROM::String{ PSTR( string ) } )
 
+/**
+ * \brief Store a constexpr object with static storage duration in ROM.
+ *
+ * The object's bytes must only be accessed through microlibrary::ROM::String.
+ */
+#define MICROLIBRARY_ROM_STORAGE PROGMEM
+
 } // namespace microlibrary::ROM
 
 #endif // MICROLIBRARY_HIL_ROM_H
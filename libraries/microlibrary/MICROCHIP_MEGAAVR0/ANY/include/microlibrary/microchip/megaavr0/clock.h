@@ -30,6 +30,7 @@
 #include "microlibrary/microchip/megaavr0/peripheral/clkctrl.h"
 #include "microlibrary/pointer.h"
 #include "microlibrary/precondition.h"
+#include "microlibrary/register.h"
 
 namespace microlibrary::Microchip::megaAVR0 {
 
@@ -169,8 +170,9 @@ class Clock_Controller {
      */
     void set_clock_source( Clock_Source source ) noexcept
     {
-        m_clkctrl->mclkctrla = ( m_clkctrl->mclkctrla & ~Peripheral::CLKCTRL::MCLKCTRLA::Mask::CLKSEL )
-                               | to_underlying( source );
+        set( m_clkctrl->mclkctrla,
+             Peripheral::CLKCTRL::MCLKCTRLA::Field::CLKSEL
+             = static_cast<Peripheral::CLKCTRL::MCLKCTRLA::CLKSEL>( to_underlying( source ) ) );
     }
 
     /**
@@ -241,7 +243,10 @@ class Clock_Controller {
      */
     void configure_clock_prescaler( Clock_Prescaler_Value value, Clock_Prescaler configuration ) noexcept
     {
-        m_clkctrl->mclkctrlb = to_underlying( value ) | to_underlying( configuration );
+        write( m_clkctrl->mclkctrlb,
+               Peripheral::CLKCTRL::MCLKCTRLB::Field::PDIV
+               = static_cast<Peripheral::CLKCTRL::MCLKCTRLB::PDIV>( to_underlying( value ) ),
+               Peripheral::CLKCTRL::MCLKCTRLB::Field::PEN = configuration == Clock_Prescaler::ENABLED );
     }
 
     /**
@@ -439,8 +444,13 @@ class Clock_Controller {
         External_32_768_kHz_Crystal_Oscillator_Start_Up_Time start_up_time,
         External_32_768_kHz_Crystal_Oscillator_Mode          mode ) noexcept
     {
-        m_clkctrl->xosc32kctrla = to_underlying( source ) | to_underlying( start_up_time )
-                                  | to_underlying( mode );
+        write( m_clkctrl->xosc32kctrla,
+               Peripheral::CLKCTRL::XOSC32KCTRLA::Field::SEL
+               = source == External_32_768_kHz_Crystal_Oscillator_Source::CLOCK,
+               Peripheral::CLKCTRL::XOSC32KCTRLA::Field::CSUT
+               = static_cast<Peripheral::CLKCTRL::XOSC32KCTRLA::CSUT>( to_underlying( start_up_time ) ),
+               Peripheral::CLKCTRL::XOSC32KCTRLA::Field::RUNSTDBY
+               = mode == External_32_768_kHz_Crystal_Oscillator_Mode::FORCED_ON );
     }
 
     /**
@@ -450,9 +460,9 @@ class Clock_Controller {
      */
     void set_external_32_768_kHz_crystal_oscillator_mode( External_32_768_kHz_Crystal_Oscillator_Mode mode ) noexcept
     {
-        m_clkctrl->xosc32kctrla = ( m_clkctrl->xosc32kctrla
-                                    & ~Peripheral::CLKCTRL::XOSC32KCTRLA::Mask::RUNSTDBY )
-                                  | to_underlying( mode );
+        set( m_clkctrl->xosc32kctrla,
+             Peripheral::CLKCTRL::XOSC32KCTRLA::Field::RUNSTDBY
+             = mode == External_32_768_kHz_Crystal_Oscillator_Mode::FORCED_ON );
     }
 
     /**
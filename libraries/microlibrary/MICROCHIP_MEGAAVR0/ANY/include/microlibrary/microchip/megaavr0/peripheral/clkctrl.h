@@ -79,6 +79,14 @@ struct CLKCTRL {
             CLKSEL_XOSC32K = 0x2 << Bit::CLKSEL, ///< 32.768 kHz external crystal oscillator.
             CLKSEL_EXTCLK = 0x3 << Bit::CLKSEL, ///< External clock.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto CLKSEL = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::CLKSEL, Size::CLKSEL, MCLKCTRLA::CLKSEL>{}; ///< CLKSEL.
+            static constexpr auto CLKOUT = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::CLKOUT, Size::CLKOUT, bool>{}; ///< CLKOUT.
+        };
     };
 
     /**
@@ -132,6 +140,14 @@ struct CLKCTRL {
             PDIV_DIV24 = 0xB << Bit::PDIV, ///< CLK_MAIN divided by 24.
             PDIV_DIV48 = 0xC << Bit::PDIV, ///< CLK_MAIN divided by 48.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto PEN = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::PEN, Size::PEN, bool>{}; ///< PEN.
+            static constexpr auto PDIV = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::PDIV, Size::PDIV, MCLKCTRLB::PDIV>{}; ///< PDIV.
+        };
     };
 
     /**
@@ -164,6 +180,13 @@ struct CLKCTRL {
             static constexpr auto LOCKEN = mask<std::uint8_t>( Size::LOCKEN, Bit::LOCKEN ); ///< LOCKEN.
             static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto LOCKEN = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::LOCKEN, Size::LOCKEN, bool>{}; ///< LOCKEN.
+        };
     };
 
     /**
@@ -212,6 +235,17 @@ struct CLKCTRL {
             static constexpr auto XOSC32KS = mask<std::uint8_t>( Size::XOSC32KS, Bit::XOSC32KS ); ///< XOSC32KS.
             static constexpr auto EXTS = mask<std::uint8_t>( Size::EXTS, Bit::EXTS ); ///< EXTS.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto SOSC = ::microlibrary::Field<Read_Only_Register<std::uint8_t>, Bit::SOSC, Size::SOSC, bool>{}; ///< SOSC.
+            static constexpr auto OSC20MS = ::microlibrary::Field<Read_Only_Register<std::uint8_t>, Bit::OSC20MS, Size::OSC20MS, bool>{}; ///< OSC20MS.
+            static constexpr auto OSC32KS = ::microlibrary::Field<Read_Only_Register<std::uint8_t>, Bit::OSC32KS, Size::OSC32KS, bool>{}; ///< OSC32KS.
+            static constexpr auto XOSC32KS = ::microlibrary::Field<Read_Only_Register<std::uint8_t>, Bit::XOSC32KS, Size::XOSC32KS, bool>{}; ///< XOSC32KS.
+            static constexpr auto EXTS = ::microlibrary::Field<Read_Only_Register<std::uint8_t>, Bit::EXTS, Size::EXTS, bool>{}; ///< EXTS.
+        };
     };
 
     /**
@@ -247,6 +281,13 @@ struct CLKCTRL {
             static constexpr auto RUNSTDBY = mask<std::uint8_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
             static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto RUNSTDBY = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::RUNSTDBY, Size::RUNSTDBY, bool>{}; ///< RUNSTDBY.
+        };
     };
 
     /**
@@ -279,6 +320,13 @@ struct CLKCTRL {
             static constexpr auto CAL20M = mask<std::uint8_t>( Size::CAL20M, Bit::CAL20M ); ///< CAL20M.
             static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto CAL20M = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::CAL20M, Size::CAL20M, std::uint8_t>{}; ///< CAL20M.
+        };
     };
 
     /**
@@ -315,6 +363,14 @@ struct CLKCTRL {
             static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
             static constexpr auto LOCK = mask<std::uint8_t>( Size::LOCK, Bit::LOCK ); ///< LOCK.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto TEMPCAL20M = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::TEMPCAL20M, Size::TEMPCAL20M, std::uint8_t>{}; ///< TEMPCAL20M.
+            static constexpr auto LOCK = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::LOCK, Size::LOCK, bool>{}; ///< LOCK.
+        };
     };
 
     /**
@@ -350,6 +406,13 @@ struct CLKCTRL {
             static constexpr auto RUNSTDBY = mask<std::uint8_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
             static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto RUNSTDBY = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::RUNSTDBY, Size::RUNSTDBY, bool>{}; ///< RUNSTDBY.
+        };
     };
 
     /**
@@ -407,6 +470,16 @@ struct CLKCTRL {
             CSUT_32K = 0x2 << Bit::CSUT, ///< 32k cycles.
             CSUT_64K = 0x3 << Bit::CSUT, ///< 64k cycles.
         };
+
+        /**
+         * \brief Field descriptors.
+         */
+        struct Field {
+            static constexpr auto ENABLE = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::ENABLE, Size::ENABLE, bool>{}; ///< ENABLE.
+            static constexpr auto RUNSTDBY = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::RUNSTDBY, Size::RUNSTDBY, bool>{}; ///< RUNSTDBY.
+            static constexpr auto SEL = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::SEL, Size::SEL, bool>{}; ///< SEL.
+            static constexpr auto CSUT = ::microlibrary::Field<Protected_Register<std::uint8_t, CPU_CCP_Key::IOREG>, Bit::CSUT, Size::CSUT, XOSC32KCTRLA::CSUT>{}; ///< CSUT.
+        };
     };
 
     /**
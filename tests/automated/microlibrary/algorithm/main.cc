@@ -20,10 +20,16 @@
  * \brief microlibrary algorithms automated tests.
  */
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <ios>
+#include <iterator>
+#include <list>
+#include <memory>
 #include <ostream>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <vector>
@@ -631,3 +637,308 @@ TEST_P( equal4IteratorsPredicate, worksProperly )
 }
 
 INSTANTIATE_TEST_SUITE_P(, equal4IteratorsPredicate, ValuesIn( equal4Iterators_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::fill() works properly when filling a misaligned range of
+ *        bytes.
+ */
+TEST( fillMisalignedRange, worksProperly )
+{
+    auto const value = std::uint8_t{ 0xCB };
+
+    for ( auto offset = std::size_t{ 0 }; offset < 16; ++offset ) {
+        for ( auto size = std::size_t{ 0 }; size <= 48; ++size ) {
+            auto buffer   = std::vector<std::uint8_t>( 80, 0x00 );
+            auto expected = buffer;
+            std::fill_n( expected.begin() + offset, size, value );
+
+            ::microlibrary::fill( buffer.data() + offset, buffer.data() + offset + size, value );
+
+            EXPECT_EQ( buffer, expected ) << "offset: " << offset << ", size: " << size;
+        } // for
+    }     // for
+}
+
+/**
+ * \brief Verify microlibrary::equal( Iterator_1, Iterator_1, Iterator_2 ) works properly
+ *        when comparing misaligned ranges of bytes.
+ */
+TEST( equalMisalignedRanges, worksProperly )
+{
+    auto range_1 = std::vector<char>( 64 );
+    auto range_2 = std::vector<char>( 64 );
+    for ( auto i = std::size_t{ 0 }; i < range_1.size(); ++i ) {
+        range_1[ i ] = static_cast<char>( 'A' + i % 26 );
+    } // for
+
+    for ( auto offset_1 = std::size_t{ 0 }; offset_1 < 8; ++offset_1 ) {
+        for ( auto offset_2 = std::size_t{ 0 }; offset_2 < 8; ++offset_2 ) {
+            for ( auto size = std::size_t{ 0 }; size <= 40; ++size ) {
+                auto const begin_1 = range_1.data() + offset_1;
+                auto const begin_2 = range_2.data() + offset_2;
+
+                std::copy_n( begin_1, size, begin_2 );
+
+                EXPECT_TRUE( ::microlibrary::equal( begin_1, begin_1 + size, begin_2 ) )
+                    << "offset_1: " << offset_1 << ", offset_2: " << offset_2
+                    << ", size: " << size;
+
+                for ( auto mismatch = std::size_t{ 0 }; mismatch < size; ++mismatch ) {
+                    begin_2[ mismatch ] = '_';
+
+                    EXPECT_FALSE( ::microlibrary::equal( begin_1, begin_1 + size, begin_2 ) )
+                        << "offset_1: " << offset_1 << ", offset_2: " << offset_2
+                        << ", size: " << size << ", mismatch: " << mismatch;
+
+                    begin_2[ mismatch ] = begin_1[ mismatch ];
+                } // for
+            }     // for
+        }         // for
+    }             // for
+}
+
+/**
+ * \brief Verify microlibrary::copy() works properly when copying misaligned ranges of
+ *        bytes.
+ */
+TEST( copyMisalignedRange, worksProperly )
+{
+    auto source = std::vector<std::uint8_t>( 64 );
+    for ( auto i = std::size_t{ 0 }; i < source.size(); ++i ) {
+        source[ i ] = static_cast<std::uint8_t>( 0x80 + i );
+    } // for
+
+    for ( auto source_offset = std::size_t{ 0 }; source_offset < 8; ++source_offset ) {
+        for ( auto destination_offset = std::size_t{ 0 }; destination_offset < 8; ++destination_offset ) {
+            for ( auto size = std::size_t{ 0 }; size <= 40; ++size ) {
+                auto destination = std::vector<std::uint8_t>( 64, 0x00 );
+                auto expected    = destination;
+                std::copy_n(
+                    source.begin() + source_offset, size, expected.begin() + destination_offset );
+
+                auto const begin = source.data() + source_offset;
+
+                EXPECT_EQ(
+                    ::microlibrary::copy( begin, begin + size, destination.data() + destination_offset ),
+                    destination.data() + destination_offset + size );
+
+                EXPECT_EQ( destination, expected )
+                    << "source_offset: " << source_offset
+                    << ", destination_offset: " << destination_offset << ", size: " << size;
+            } // for
+        }     // for
+    }         // for
+}
+
+/**
+ * \brief Verify microlibrary::copy() works properly when copying a contiguous range of
+ *        trivially copyable values that are larger than a byte.
+ */
+TEST( copyTriviallyCopyable, worksProperly )
+{
+    auto const source = std::vector<std::uint32_t>{ 0xFD2E3A14, 0x58A2196D, 0x7C2F1E90 };
+    auto destination  = std::vector<std::uint32_t>( source.size() );
+
+    EXPECT_EQ(
+        ::microlibrary::copy( source.data(), source.data() + source.size(), destination.data() ),
+        destination.data() + destination.size() );
+
+    EXPECT_EQ( destination, source );
+}
+
+/**
+ * \brief Verify microlibrary::copy() works properly when copying a non-contiguous range.
+ */
+TEST( copyNonContiguous, worksProperly )
+{
+    auto const source = std::list<std::string>{ "7Ks", "jf8Xy", "", "Pq" };
+    auto destination  = std::vector<std::string>( source.size() );
+
+    EXPECT_EQ( ::microlibrary::copy( source.begin(), source.end(), destination.begin() ), destination.end() );
+
+    EXPECT_TRUE( std::equal( source.begin(), source.end(), destination.begin(), destination.end() ) );
+}
+
+/**
+ * \brief Verify microlibrary::copy_n() works properly.
+ */
+TEST( copyN, worksProperly )
+{
+    auto const source = std::vector<std::uint8_t>{ 0x1C, 0x0C, 0xE6, 0xEC, 0x99, 0x4F, 0x27 };
+
+    {
+        auto destination = std::vector<std::uint8_t>( source.size(), 0x00 );
+
+        EXPECT_EQ( ::microlibrary::copy_n( source.data(), 5, destination.data() ), destination.data() + 5 );
+
+        EXPECT_EQ( destination, ( std::vector<std::uint8_t>{ 0x1C, 0x0C, 0xE6, 0xEC, 0x99, 0x00, 0x00 } ) );
+    }
+
+    {
+        auto destination = std::vector<std::uint8_t>( source.size(), 0x00 );
+
+        EXPECT_EQ( ::microlibrary::copy_n( source.begin(), 3, destination.begin() ), destination.begin() + 3 );
+
+        EXPECT_EQ( destination, ( std::vector<std::uint8_t>{ 0x1C, 0x0C, 0xE6, 0x00, 0x00, 0x00, 0x00 } ) );
+    }
+}
+
+/**
+ * \brief Verify microlibrary::move() works properly when moving a range of trivially
+ *        copyable values.
+ */
+TEST( moveTriviallyCopyable, worksProperly )
+{
+    auto const source = std::vector<std::uint16_t>{ 0x1C0C, 0xE6EC, 0x994F, 0x27A1, 0x58D3 };
+    auto destination  = std::vector<std::uint16_t>( source.size() );
+
+    EXPECT_EQ(
+        ::microlibrary::move( source.data(), source.data() + source.size(), destination.data() ),
+        destination.data() + destination.size() );
+
+    EXPECT_EQ( destination, source );
+}
+
+/**
+ * \brief Verify microlibrary::move() works properly when moving a range of move-only
+ *        values.
+ */
+TEST( moveMoveOnly, worksProperly )
+{
+    auto source = std::vector<std::unique_ptr<int>>{};
+    source.emplace_back( std::make_unique<int>( 4 ) );
+    source.emplace_back( std::make_unique<int>( -91 ) );
+    auto destination = std::vector<std::unique_ptr<int>>( source.size() );
+
+    EXPECT_EQ( ::microlibrary::move( source.begin(), source.end(), destination.begin() ), destination.end() );
+
+    EXPECT_EQ( source[ 0 ], nullptr );
+    EXPECT_EQ( source[ 1 ], nullptr );
+    ASSERT_NE( destination[ 0 ], nullptr );
+    ASSERT_NE( destination[ 1 ], nullptr );
+    EXPECT_EQ( *destination[ 0 ], 4 );
+    EXPECT_EQ( *destination[ 1 ], -91 );
+}
+
+/**
+ * \brief Verify microlibrary::find() works properly when searching a misaligned range of
+ *        bytes.
+ */
+TEST( findMisalignedRange, worksProperly )
+{
+    auto const value = std::uint8_t{ 0x80 };
+
+    for ( auto offset = std::size_t{ 0 }; offset < 8; ++offset ) {
+        for ( auto size = std::size_t{ 0 }; size <= 40; ++size ) {
+            auto       buffer = std::vector<std::uint8_t>( 64, 0x7F );
+            auto const begin  = buffer.data() + offset;
+            auto const end    = begin + size;
+
+            EXPECT_EQ( ::microlibrary::find( begin, end, value ), end )
+                << "offset: " << offset << ", size: " << size;
+
+            buffer.back() = value;
+
+            EXPECT_EQ( ::microlibrary::find( begin, end, value ), end )
+                << "offset: " << offset << ", size: " << size;
+
+            for ( auto position = std::size_t{ 0 }; position < size; ++position ) {
+                begin[ position ] = value;
+                if ( position + 1 < size ) {
+                    begin[ position + 1 ] = value;
+                } // if
+
+                EXPECT_EQ( ::microlibrary::find( begin, end, value ), begin + position )
+                    << "offset: " << offset << ", size: " << size << ", position: " << position;
+
+                begin[ position ] = 0x7F;
+                if ( position + 1 < size ) {
+                    begin[ position + 1 ] = 0x7F;
+                } // if
+            } // for
+        }     // for
+    }         // for
+}
+
+/**
+ * \brief Verify microlibrary::find() works properly when searching a range of bytes for a
+ *        value that cannot be represented by a byte.
+ */
+TEST( findUnrepresentableValue, worksProperly )
+{
+    auto const values = std::vector<std::uint8_t>{ 0x1C, 0x0C, 0xE6, 0xEC, 0x99 };
+
+    EXPECT_EQ( ::microlibrary::find( values.data(), values.data() + values.size(), 0x1E6 ), values.data() + values.size() );
+}
+
+/**
+ * \brief Verify microlibrary::find() works properly when searching a range of values that
+ *        are not bytes.
+ */
+TEST( findNonByte, worksProperly )
+{
+    auto const values = std::list<std::string_view>{ "7Ks", "jf8Xy", "", "Pq" };
+
+    EXPECT_EQ( ::microlibrary::find( values.begin(), values.end(), "" ), std::next( values.begin(), 2 ) );
+    EXPECT_EQ( ::microlibrary::find( values.begin(), values.end(), "xX" ), values.end() );
+}
+
+/**
+ * \brief Verify microlibrary::fill(), microlibrary::equal(), microlibrary::copy(),
+ *        microlibrary::move(), and microlibrary::find() work properly when processing
+ *        ranges of volatile bytes.
+ */
+TEST( algorithmVolatileRanges, worksProperly )
+{
+    std::uint8_t volatile buffer[ 20 ]{};
+    std::uint8_t volatile destination[ 20 ]{};
+
+    ::microlibrary::fill( buffer, buffer + 20, 0x5A );
+    buffer[ 13 ] = 0xA5;
+
+    EXPECT_EQ( ::microlibrary::find( buffer, buffer + 20, 0xA5 ), buffer + 13 );
+
+    EXPECT_EQ( ::microlibrary::copy( buffer, buffer + 20, destination ), destination + 20 );
+
+    EXPECT_TRUE( ::microlibrary::equal(
+        static_cast<std::uint8_t volatile const *>( buffer ),
+        static_cast<std::uint8_t volatile const *>( buffer + 20 ),
+        static_cast<std::uint8_t volatile const *>( destination ) ) );
+
+    destination[ 2 ] = 0x00;
+
+    EXPECT_FALSE( ::microlibrary::equal( buffer, buffer + 20, destination ) );
+
+    EXPECT_EQ( ::microlibrary::move( buffer, buffer + 20, destination ), destination + 20 );
+
+    EXPECT_TRUE( ::microlibrary::equal( buffer, buffer + 20, destination ) );
+
+    auto const source = std::vector<std::uint8_t>{ 0x1C, 0x0C, 0xE6, 0xEC, 0x99 };
+
+    EXPECT_EQ( ::microlibrary::copy( source.data(), source.data() + source.size(), destination ), destination + source.size() );
+
+    EXPECT_TRUE( ::microlibrary::equal( source.data(), source.data() + source.size(), destination ) );
+}
+
+/**
+ * \brief Verify microlibrary::fill(), microlibrary::equal(), microlibrary::copy(), and
+ *        microlibrary::find() work properly when constant evaluated.
+ */
+TEST( algorithmConstantEvaluation, worksProperly )
+{
+    constexpr auto buffer = [] {
+        char source[ 11 ]{};
+        ::microlibrary::fill( source, source + 10, 'x' );
+        source[ 7 ] = 'y';
+
+        auto destination = std::array<char, 11>{};
+        ::microlibrary::copy_n( source, 10, destination.data() );
+
+        return destination;
+    }();
+
+    static_assert( ::microlibrary::equal( buffer.data(), buffer.data() + 10, "xxxxxxxyxx" ) );
+    static_assert( ::microlibrary::find( buffer.data(), buffer.data() + 10, 'y' ) == buffer.data() + 7 );
+
+    EXPECT_EQ( std::string_view{ buffer.data() }, "xxxxxxxyxx" );
+}
@@ -0,0 +1,259 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Async_Stream_IO_Driver automated tests.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "microlibrary/async_stream_io_driver.h"
+
+namespace {
+
+using ::microlibrary::Async_Stream_IO_Driver;
+using ::microlibrary::Block_On_Back_Pressure;
+using ::microlibrary::Drop_Newest_On_Back_Pressure;
+using ::microlibrary::Drop_Oldest_On_Back_Pressure;
+
+/**
+ * \brief Simulated asynchronous stream I/O driver.
+ *
+ * Transmit ready interrupts are simulated by calling
+ * Simulated_Async_Stream_IO_Driver::tick(), which transmits a single character if the
+ * transmit ready interrupt is enabled.
+ *
+ * \tparam Back_Pressure_Policy The policy used when a write does not fit in the transmit
+ *         queue.
+ */
+template<typename Back_Pressure_Policy>
+class Simulated_Async_Stream_IO_Driver final :
+    public Async_Stream_IO_Driver<8, Back_Pressure_Policy> {
+  public:
+    Simulated_Async_Stream_IO_Driver() = default;
+
+    Simulated_Async_Stream_IO_Driver( Simulated_Async_Stream_IO_Driver && ) = delete;
+
+    Simulated_Async_Stream_IO_Driver( Simulated_Async_Stream_IO_Driver const & ) = delete;
+
+    ~Simulated_Async_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Simulated_Async_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Simulated_Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if the transmit ready interrupt is enabled.
+     *
+     * \return true if the transmit ready interrupt is enabled.
+     * \return false if the transmit ready interrupt is not enabled.
+     */
+    auto transmit_ready_interrupt_enabled() const noexcept -> bool
+    {
+        return m_transmit_ready_interrupt_enabled;
+    }
+
+    /**
+     * \brief Simulate a transmit ready interrupt.
+     *
+     * \return true if a character was transmitted.
+     * \return false if a character was not transmitted.
+     */
+    auto tick() -> bool
+    {
+        if ( not m_transmit_ready_interrupt_enabled ) {
+            return false;
+        } // if
+
+        auto const result = this->handle_transmit_ready();
+        if ( result.is_error() ) {
+            return false;
+        } // if
+
+        m_transmitted.push_back( static_cast<char>( result.value() ) );
+
+        return true;
+    }
+
+    /**
+     * \brief Simulate transmit ready interrupts until the transmit queue is empty.
+     */
+    void drain()
+    {
+        while ( tick() ) {} // while
+    }
+
+    /**
+     * \brief Get the characters that have been transmitted.
+     *
+     * \return The characters that have been transmitted.
+     */
+    auto transmitted() const noexcept -> std::string const &
+    {
+        return m_transmitted;
+    }
+
+  private:
+    /**
+     * \brief The transmit ready interrupt enable state.
+     */
+    std::atomic<bool> m_transmit_ready_interrupt_enabled{ false };
+
+    /**
+     * \brief The characters that have been transmitted.
+     */
+    std::string m_transmitted{};
+
+    /**
+     * \brief Enable the simulated transmit ready interrupt.
+     */
+    void enable_transmit_ready_interrupt() noexcept override
+    {
+        m_transmit_ready_interrupt_enabled = true;
+    }
+
+    /**
+     * \brief Disable the simulated transmit ready interrupt.
+     */
+    void disable_transmit_ready_interrupt() noexcept override
+    {
+        m_transmit_ready_interrupt_enabled = false;
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Async_Stream_IO_Driver::handle_transmit_ready() properly
+ *        handles an empty transmit queue.
+ */
+TEST( handleTransmitReady, emptyQueue )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver<Block_On_Back_Pressure>{};
+
+    driver.put( 'k' );
+
+    EXPECT_TRUE( driver.transmit_ready_interrupt_enabled() );
+    EXPECT_TRUE( driver.tick() );
+    EXPECT_TRUE( driver.transmit_ready_interrupt_enabled() );
+    EXPECT_FALSE( driver.tick() );
+    EXPECT_FALSE( driver.transmit_ready_interrupt_enabled() );
+
+    EXPECT_EQ( driver.transmitted(), "k" );
+}
+
+/**
+ * \brief Verify microlibrary::Async_Stream_IO_Driver::put() works properly.
+ */
+TEST( put, worksProperly )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver<Block_On_Back_Pressure>{};
+
+    auto const string = std::string_view{ "Ge3" };
+
+    driver.put( string.begin(), string.end() );
+    driver.put( std::uint8_t{ '7' } );
+    driver.put( 'x' );
+    driver.put( "Lq" );
+
+    EXPECT_EQ( driver.size(), 7 );
+    EXPECT_TRUE( driver.transmitted().empty() );
+
+    driver.drain();
+
+    EXPECT_EQ( driver.size(), 0 );
+    EXPECT_EQ( driver.transmitted(), "Ge37xLq" );
+}
+
+/**
+ * \brief Verify microlibrary::Async_Stream_IO_Driver::put() works properly when using the
+ *        microlibrary::Block_On_Back_Pressure back-pressure policy.
+ */
+TEST( putBackPressure, block )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver<Block_On_Back_Pressure>{};
+
+    auto done = std::atomic<bool>{ false };
+
+    auto transmitter = std::thread{ [ &driver, &done ]() {
+        while ( not done or driver.size() ) {
+            if ( not driver.tick() ) {
+                std::this_thread::yield();
+            } // if
+        }     // while
+    } };
+
+    auto const string = std::string_view{ "a5LpTq0WcXzR2mNvB8yHsK1eJdFg" };
+
+    driver.put( string.begin(), string.end() );
+    driver.put( "9" );
+    driver.flush();
+
+    done = true;
+    transmitter.join();
+
+    EXPECT_EQ( driver.transmitted(), "a5LpTq0WcXzR2mNvB8yHsK1eJdFg9" );
+}
+
+/**
+ * \brief Verify microlibrary::Async_Stream_IO_Driver::put() works properly when using the
+ *        microlibrary::Drop_Newest_On_Back_Pressure back-pressure policy.
+ */
+TEST( putBackPressure, dropNewest )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver<Drop_Newest_On_Back_Pressure>{};
+
+    driver.put( "P4nD" );
+    driver.put( "w0KeYh" );
+    driver.put( 'c' );
+
+    EXPECT_EQ( driver.size(), 8 );
+
+    driver.tick();
+    driver.put( "Ujm" );
+    driver.drain();
+
+    EXPECT_EQ( driver.transmitted(), "P4nDw0KeU" );
+}
+
+/**
+ * \brief Verify microlibrary::Async_Stream_IO_Driver::put() works properly when using the
+ *        microlibrary::Drop_Oldest_On_Back_Pressure back-pressure policy.
+ */
+TEST( putBackPressure, dropOldest )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver<Drop_Oldest_On_Back_Pressure>{};
+
+    driver.put( "P4nD" );
+    driver.put( "w0KeYh" );
+
+    EXPECT_EQ( driver.size(), 8 );
+    EXPECT_TRUE( driver.transmit_ready_interrupt_enabled() );
+
+    driver.tick();
+    driver.put( 'c' );
+    driver.put( "ZsV7iGx1oQ" );
+    driver.drain();
+
+    EXPECT_EQ( driver.transmitted(), "nV7iGx1oQ" );
+}
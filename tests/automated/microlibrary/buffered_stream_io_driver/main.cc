@@ -0,0 +1,412 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Buffered_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/buffered_stream_io_driver.h"
+#include "microlibrary/format.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Buffered_Stream_IO_Driver;
+using ::microlibrary::Character_Block;
+using ::microlibrary::Output_Stream;
+using ::microlibrary::Format::Dec;
+using ::microlibrary::Format::Hex;
+using ::microlibrary::Format::Hex_Dump;
+using ::microlibrary::Testing::Automated::Mock_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::InSequence;
+
+/**
+ * \brief Buffered output stream.
+ *
+ * \tparam N The capacity of the stream's write buffer.
+ */
+template<std::size_t N>
+class Buffered_Output_Stream : public Output_Stream {
+  public:
+    Buffered_Output_Stream() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] driver The stream I/O driver to write buffered data to.
+     */
+    Buffered_Output_Stream( Mock_Stream_IO_Driver & driver ) : m_driver{ driver }
+    {
+        set_driver( &m_driver );
+    }
+
+    Buffered_Output_Stream( Buffered_Output_Stream && ) = delete;
+
+    Buffered_Output_Stream( Buffered_Output_Stream const & ) = delete;
+
+    ~Buffered_Output_Stream() noexcept = default;
+
+    auto operator=( Buffered_Output_Stream && ) = delete;
+
+    auto operator=( Buffered_Output_Stream const & ) = delete;
+
+  private:
+    /**
+     * \brief The stream's I/O driver.
+     */
+    Buffered_Stream_IO_Driver<N> m_driver;
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put( char ) works properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<4>{ driver };
+
+    EXPECT_CALL( driver, put( A<char>() ) ).Times( 0 );
+    EXPECT_CALL( driver, put( std::string{ "xVBw" } ) );
+    EXPECT_CALL( driver, put( std::string{ "h" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    for ( auto const character : std::string_view{ "xVBwh" } ) {
+        buffered_driver.put( character );
+    } // for
+
+    EXPECT_EQ( buffered_driver.size(), 1 );
+
+    buffered_driver.flush();
+
+    EXPECT_EQ( buffered_driver.size(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put( char const *, char const *
+ *        ) works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "7nRa" } ) );
+    EXPECT_CALL( driver, put( std::string{ "KbX0yW2oTq" } ) );
+    EXPECT_CALL( driver, put( std::string{ "LkZ1dj" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    auto const a = std::string_view{ "7nRa" };
+    auto const b = std::string_view{ "KbX0yW2oTq" };
+    auto const c = std::string_view{ "LkZ1" };
+    auto const d = std::string_view{ "dj" };
+
+    buffered_driver.put( a.begin(), a.end() );
+    buffered_driver.put( b.begin(), b.end() );
+    buffered_driver.put( c.begin(), c.end() );
+    buffered_driver.put( d.begin(), d.end() );
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put( char const * ) works
+ *        properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<16>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "JmcrL0yqS4T" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( "JmcrL0" );
+    buffered_driver.put( "yqS4T" );
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put( std::uint8_t ) works
+ *        properly.
+ */
+TEST( putData, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<4>{ driver };
+
+    EXPECT_CALL( driver, put( A<std::uint8_t>() ) ).Times( 0 );
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0x2D, 0xE8, 0x95 } ) );
+    EXPECT_CALL( driver, flush() );
+
+    for ( auto const data : std::vector<std::uint8_t>{ 0x2D, 0xE8, 0x95 } ) {
+        buffered_driver.put( data );
+    } // for
+
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put( std::uint8_t const *,
+ *        std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<4>{ driver };
+
+    auto const a = std::vector<std::uint8_t>{ 0x4A, 0x07 };
+    auto const b = std::vector<std::uint8_t>{ 0xC1, 0x5F, 0x9E, 0x30, 0xB2 };
+
+    EXPECT_CALL( driver, put( a ) );
+    EXPECT_CALL( driver, put( b ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( &*a.begin(), &*a.begin() + a.size() );
+    buffered_driver.put( &*b.begin(), &*b.begin() + b.size() );
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    auto const a = std::string_view{ "Gd" };
+    auto const b = std::string_view{ "u01" };
+    auto const c = std::string_view{ "xTk4" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+        { c.begin(), c.end() },
+    };
+
+    EXPECT_CALL( driver, put( A<std::vector<std::string>>() ) ).Times( 0 );
+    EXPECT_CALL( driver, put( std::string{ "Gdu01" } ) );
+    EXPECT_CALL( driver, put( std::string{ "xTk4" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_EQ( buffered_driver.size(), 4 );
+
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver properly handles switching
+ *        between writing characters and writing data.
+ */
+TEST( contentSwitch, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<16>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "Ys0" } ) );
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0x61, 0xF3 } ) );
+    EXPECT_CALL( driver, put( std::string{ "e" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( "Ys0" );
+    buffered_driver.put( std::uint8_t{ 0x61 } );
+    buffered_driver.put( std::uint8_t{ 0xF3 } );
+    buffered_driver.put( 'e' );
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::flush() works properly when
+ *        nothing has been buffered.
+ */
+TEST( flush, nothingBuffered )
+{
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( A<std::string>() ) ).Times( 0 );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver coalesces a formatted line into a
+ *        single downstream block write.
+ */
+TEST( formattedLine, coalesced )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto stream = Buffered_Output_Stream<64>{ driver };
+
+    EXPECT_CALL( driver, put( A<char>() ) ).Times( 0 );
+    EXPECT_CALL( driver, put( std::string{ "sample 1795: 0x00B4 -42\n" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    stream.print(
+        "sample ", Dec{ 1795U }, ": ", Hex{ std::uint16_t{ 0xB4 } }, ' ', Dec{ -42 }, '\n' );
+    stream.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::reserve() and
+ *        microlibrary::Buffered_Stream_IO_Driver::commit() work properly.
+ */
+TEST( reserveCommit, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "4Lq" } ) );
+    EXPECT_CALL( driver, put( std::string{ "uZbT0" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( '4' );
+
+    auto const first = buffered_driver.reserve( 5 );
+    ASSERT_NE( first, nullptr );
+    first[ 0 ] = 'L';
+    first[ 1 ] = 'q';
+    buffered_driver.commit( 2 );
+
+    EXPECT_EQ( buffered_driver.size(), 3 );
+
+    auto second = buffered_driver.reserve( 6 );
+    ASSERT_NE( second, nullptr );
+    for ( auto const character : std::string_view{ "uZbT0" } ) {
+        *second = character;
+        ++second;
+    } // for
+    buffered_driver.commit( 5 );
+
+    EXPECT_EQ( buffered_driver.size(), 5 );
+
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::reserve() properly handles a
+ *        reservation that exceeds the capacity of the write buffer.
+ */
+TEST( reserve, exceedsCapacity )
+{
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( A<std::string>() ) ).Times( 0 );
+
+    buffered_driver.put( 'j' );
+
+    EXPECT_EQ( buffered_driver.reserve( 9 ), nullptr );
+    EXPECT_EQ( buffered_driver.size(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::Buffered_Stream_IO_Driver::reserve() properly handles
+ *        buffered data.
+ */
+TEST( reserve, dataBuffered )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto buffered_driver = Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0xC4 } ) );
+    EXPECT_CALL( driver, put( std::string{ "r" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    buffered_driver.put( std::uint8_t{ 0xC4 } );
+
+    auto const reservation = buffered_driver.reserve( 1 );
+    ASSERT_NE( reservation, nullptr );
+    *reservation = 'r';
+    buffered_driver.commit( 1 );
+
+    buffered_driver.flush();
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Hex_Dump> generates
+ *        rows directly in the write buffer.
+ */
+TEST( hexDump, generatedInWriteBuffer )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto stream = Buffered_Output_Stream<160>{ driver };
+
+    auto const data = std::string_view{ "{yZZk7V!/{>fm[lxV!$e|:" };
+
+    EXPECT_CALL( driver, put( A<char>() ) ).Times( 0 );
+    EXPECT_CALL(
+        driver,
+        put( std::string{ "95A1  7B 79 5A 5A 6B 37 56 21 2F 7B 3E 66 6D 5B 6C 78  |{yZZk7V!/{>fm[lx|\n"
+                          "95B1  56 21 24 65 7C 3A                                |V!$e|:|          \n" } ) );
+    EXPECT_CALL( driver, flush() );
+
+    EXPECT_EQ( stream.print( Hex_Dump{ std::uint16_t{ 0x95A1 }, data.begin(), data.end() } ), 148 );
+    stream.flush();
+}
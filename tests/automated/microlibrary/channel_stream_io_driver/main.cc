@@ -0,0 +1,202 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Channel_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/channel_stream_io_driver.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Channel_Stream_IO_Driver;
+using ::microlibrary::Character_Block;
+using ::microlibrary::Testing::Automated::Mock_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::InSequence;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( char ) works properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x3A };
+
+    EXPECT_EQ( driver.channel(), 0x3A );
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x3A, 1 } ) );
+    EXPECT_CALL( link, put( std::string{ "c" } ) );
+
+    driver.put( 'c' );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( char const *, char const * )
+ *        works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x07 };
+
+    auto const string = std::string( 300, 'k' );
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x07, 255 } ) );
+    EXPECT_CALL( link, put( std::string( 255, 'k' ) ) );
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x07, 45 } ) );
+    EXPECT_CALL( link, put( std::string( 45, 'k' ) ) );
+
+    driver.put( &*string.begin(), &*string.begin() + string.size() );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( char const *, char const * )
+ *        discards empty blocks.
+ */
+TEST( putCharBlock, discardsEmptyBlocks )
+{
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x07 };
+
+    EXPECT_CALL( link, put( A<std::vector<std::uint8_t>>() ) ).Times( 0 );
+    EXPECT_CALL( link, put( A<std::string>() ) ).Times( 0 );
+
+    auto const string = std::string_view{ "" };
+
+    driver.put( string.begin(), string.end() );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( char const * ) works
+ *        properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0xE1 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0xE1, 5 } ) );
+    EXPECT_CALL( link, put( std::string{ "Hn2wZ" } ) );
+
+    driver.put( "Hn2wZ" );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( std::uint8_t ) works
+ *        properly.
+ */
+TEST( putData, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x12 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x12, 1 } ) );
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0xF4 } ) );
+
+    driver.put( std::uint8_t{ 0xF4 } );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( std::uint8_t const *,
+ *        std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x12 };
+
+    auto const data = std::vector<std::uint8_t>{ 0x6D, 0x00, 0xB9 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x12, 3 } ) );
+    EXPECT_CALL( link, put( data ) );
+
+    driver.put( &*data.begin(), &*data.begin() + data.size() );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::put( Character_Block const *,
+ *        Character_Block const * ) works properly.
+ */
+TEST( putCharacterBlocks, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x55 };
+
+    auto const a = std::string_view{ "fT8" };
+    auto const b = std::string_view{ "" };
+    auto const c = std::string_view{ "Lq" };
+
+    Character_Block const blocks[] = {
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+        { c.begin(), c.end() },
+    };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x55, 3 } ) );
+    EXPECT_CALL( link, put( std::string{ a } ) );
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x55, 2 } ) );
+    EXPECT_CALL( link, put( std::string{ c } ) );
+
+    driver.put( std::begin( blocks ), std::end( blocks ) );
+}
+
+/**
+ * \brief Verify microlibrary::Channel_Stream_IO_Driver::flush() works properly.
+ */
+TEST( flush, worksProperly )
+{
+    auto link = Mock_Stream_IO_Driver{};
+
+    auto driver = Channel_Stream_IO_Driver{ link, 0x01 };
+
+    EXPECT_CALL( link, flush() );
+
+    driver.flush();
+}
@@ -0,0 +1,418 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Consistent Overhead Byte Stuffing (COBS) framing automated tests.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/cobs.h"
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::COBS_Decoder;
+using ::microlibrary::COBS_Stream_IO_Driver;
+using ::microlibrary::Fault_Reporting_COBS_Stream_IO_Driver;
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Vector_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Vector_Stream_IO_Driver;
+using ::testing::Return;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+/**
+ * \brief Generate an incrementing sequence of bytes.
+ *
+ * \param[in] first The first byte in the sequence.
+ * \param[in] last The last byte in the sequence.
+ *
+ * \return The generated sequence of bytes.
+ */
+auto sequence( std::uint8_t first, std::uint8_t last ) -> std::vector<std::uint8_t>
+{
+    auto bytes = std::vector<std::uint8_t>{};
+
+    for ( auto byte = unsigned{ first }; byte <= last; ++byte ) {
+        bytes.push_back( static_cast<std::uint8_t>( byte ) );
+    } // for
+
+    return bytes;
+}
+
+/**
+ * \brief Concatenate sequences of bytes.
+ *
+ * \param[in] sequences The sequences of bytes to concatenate.
+ *
+ * \return The concatenated sequence of bytes.
+ */
+auto concatenate( std::initializer_list<std::vector<std::uint8_t>> sequences )
+    -> std::vector<std::uint8_t>
+{
+    auto bytes = std::vector<std::uint8_t>{};
+
+    for ( auto const & sequence : sequences ) {
+        bytes.insert( bytes.end(), sequence.begin(), sequence.end() );
+    } // for
+
+    return bytes;
+}
+
+} // namespace
+
+/**
+ * \brief COBS test case.
+ */
+struct COBS_Test_Case {
+    /**
+     * \brief The frame.
+     */
+    std::vector<std::uint8_t> frame;
+
+    /**
+     * \brief The encoded frame.
+     */
+    std::vector<std::uint8_t> encoded_frame;
+};
+
+auto operator<<( std::ostream & stream, COBS_Test_Case const & test_case ) -> std::ostream &
+{
+    return stream << "{ .frame.size() = " << test_case.frame.size()
+                  << ", .encoded_frame.size() = " << test_case.encoded_frame.size() << " }";
+}
+
+/**
+ * \brief COBS test cases.
+ */
+COBS_Test_Case const COBS_TEST_CASES[]{
+    // clang-format off
+
+    { {},                         { 0x01, 0x00 } },
+    { { 0x00 },                   { 0x01, 0x01, 0x00 } },
+    { { 0x00, 0x00 },             { 0x01, 0x01, 0x01, 0x00 } },
+    { { 0x00, 0x11, 0x00 },       { 0x01, 0x02, 0x11, 0x01, 0x00 } },
+    { { 0x11, 0x22, 0x00, 0x33 }, { 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 } },
+    { { 0x11, 0x22, 0x33, 0x44 }, { 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 } },
+    { { 0x11, 0x00, 0x00, 0x00 }, { 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 } },
+
+    { sequence( 0x01, 0xFE ),                                  concatenate( { { 0xFF }, sequence( 0x01, 0xFE ), { 0x00 } } ) },
+    { concatenate( { { 0x00 }, sequence( 0x01, 0xFE ) } ),     concatenate( { { 0x01, 0xFF }, sequence( 0x01, 0xFE ), { 0x00 } } ) },
+    { sequence( 0x01, 0xFF ),                                  concatenate( { { 0xFF }, sequence( 0x01, 0xFE ), { 0x02, 0xFF, 0x00 } } ) },
+    { concatenate( { sequence( 0x02, 0xFF ), { 0x00 } } ),     concatenate( { { 0xFF }, sequence( 0x02, 0xFF ), { 0x01, 0x01, 0x00 } } ) },
+    { concatenate( { sequence( 0x03, 0xFF ), { 0x00, 0x01 } } ), concatenate( { { 0xFE }, sequence( 0x03, 0xFF ), { 0x02, 0x01, 0x00 } } ) },
+
+    // clang-format on
+};
+
+/**
+ * \brief microlibrary::COBS_Stream_IO_Driver test fixture.
+ */
+class cobsStreamIODriver : public TestWithParam<COBS_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::COBS_Stream_IO_Driver::put( std::uint8_t const *,
+ *        std::uint8_t const * ) and microlibrary::COBS_Stream_IO_Driver::end_frame() work
+ *        properly.
+ */
+TEST_P( cobsStreamIODriver, worksProperlyBlock )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto cobs_driver = COBS_Stream_IO_Driver{ driver };
+
+    cobs_driver.put( test_case.frame.data(), test_case.frame.data() + test_case.frame.size() );
+    cobs_driver.end_frame();
+
+    EXPECT_FALSE( cobs_driver.frame_in_progress() );
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+/**
+ * \brief Verify microlibrary::COBS_Stream_IO_Driver::put( std::uint8_t ) and
+ *        microlibrary::COBS_Stream_IO_Driver::end_frame() work properly.
+ */
+TEST_P( cobsStreamIODriver, worksProperlyByte )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto cobs_driver = COBS_Stream_IO_Driver{ driver };
+
+    for ( auto const byte : test_case.frame ) { cobs_driver.put( byte ); } // for
+    cobs_driver.end_frame();
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+INSTANTIATE_TEST_SUITE_P(, cobsStreamIODriver, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::COBS_Stream_IO_Driver::flush() works properly.
+ */
+TEST( cobsStreamIODriverFlush, worksProperly )
+{
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto cobs_driver = COBS_Stream_IO_Driver{ driver };
+
+    cobs_driver.flush();
+
+    EXPECT_TRUE( driver.vector().empty() );
+
+    auto const string = std::string_view{ "A\0B", 3 };
+
+    cobs_driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( cobs_driver.frame_in_progress() );
+
+    cobs_driver.flush();
+    cobs_driver.flush();
+
+    EXPECT_FALSE( cobs_driver.frame_in_progress() );
+    EXPECT_EQ( driver.vector(), ( std::vector<std::uint8_t>{ 0x02, 'A', 0x02, 'B', 0x00 } ) );
+}
+
+/**
+ * \brief microlibrary::Fault_Reporting_COBS_Stream_IO_Driver test fixture.
+ */
+class faultReportingCOBSStreamIODriver : public TestWithParam<COBS_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) and
+ *        microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::end_frame() work properly.
+ */
+TEST_P( faultReportingCOBSStreamIODriver, worksProperlyBlock )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Fault_Reporting_Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto cobs_driver = Fault_Reporting_COBS_Stream_IO_Driver{ driver };
+
+    EXPECT_FALSE( cobs_driver.put( test_case.frame.data(), test_case.frame.data() + test_case.frame.size() ).is_error() );
+    EXPECT_FALSE( cobs_driver.end_frame().is_error() );
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::put( std::uint8_t )
+ *        and microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::end_frame() work
+ *        properly.
+ */
+TEST_P( faultReportingCOBSStreamIODriver, worksProperlyByte )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Fault_Reporting_Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto cobs_driver = Fault_Reporting_COBS_Stream_IO_Driver{ driver };
+
+    for ( auto const byte : test_case.frame ) {
+        EXPECT_FALSE( cobs_driver.put( byte ).is_error() );
+    } // for
+    EXPECT_FALSE( cobs_driver.end_frame().is_error() );
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+INSTANTIATE_TEST_SUITE_P(, faultReportingCOBSStreamIODriver, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) properly handles a put error.
+ */
+TEST( faultReportingCOBSStreamIODriverPutDataBlockErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto cobs_driver = Fault_Reporting_COBS_Stream_IO_Driver{ driver };
+
+    auto const error = Mock_Error{ 27 };
+
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0x02, 0x11 } ) ).WillOnce( Return( error ) );
+
+    auto const data = std::vector<std::uint8_t>{ 0x11, 0x00, 0x22 };
+
+    auto const result = cobs_driver.put( data.data(), data.data() + data.size() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::flush() properly
+ *        handles a put error.
+ */
+TEST( faultReportingCOBSStreamIODriverFlushErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto cobs_driver = Fault_Reporting_COBS_Stream_IO_Driver{ driver };
+
+    auto const error = Mock_Error{ 150 };
+
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0x02, 0x5A, 0x00 } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( driver, flush() ).Times( 0 );
+
+    EXPECT_FALSE( cobs_driver.put( std::uint8_t{ 0x5A } ).is_error() );
+
+    auto const result = cobs_driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_COBS_Stream_IO_Driver::flush() properly
+ *        handles a flush error.
+ */
+TEST( faultReportingCOBSStreamIODriverFlushErrorHandling, flushError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto cobs_driver = Fault_Reporting_COBS_Stream_IO_Driver{ driver };
+
+    auto const error = Mock_Error{ 3 };
+
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( error ) );
+
+    auto const result = cobs_driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief microlibrary::COBS_Decoder::decode() test fixture.
+ */
+class cobsDecoderDecode : public TestWithParam<COBS_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::COBS_Decoder::decode() works properly.
+ */
+TEST_P( cobsDecoderDecode, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto decoder = COBS_Decoder<512>{};
+
+    for ( auto repetition = 0; repetition < 2; ++repetition ) {
+        for ( auto byte = test_case.encoded_frame.begin(); byte != test_case.encoded_frame.end(); ++byte ) {
+            auto const result = decoder.decode( *byte );
+
+            ASSERT_FALSE( result.is_error() );
+            EXPECT_EQ( result.value(), byte + 1 == test_case.encoded_frame.end() );
+        } // for
+
+        EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), test_case.frame );
+    } // for
+}
+
+INSTANTIATE_TEST_SUITE_P(, cobsDecoderDecode, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::COBS_Decoder::decode() ignores frame delimiters that are
+ *        not preceded by encoded data.
+ */
+TEST( cobsDecoderDecodeIdleDelimiters, ignored )
+{
+    auto decoder = COBS_Decoder<8>{};
+
+    for ( auto const byte : std::vector<std::uint8_t>{ 0x00, 0x00, 0x03, 0x11, 0x22 } ) {
+        auto const result = decoder.decode( byte );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_FALSE( result.value() );
+    } // for
+
+    auto const result = decoder.decode( 0x00 );
+
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_TRUE( result.value() );
+    EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), ( std::vector<std::uint8_t>{ 0x11, 0x22 } ) );
+}
+
+/**
+ * \brief Verify microlibrary::COBS_Decoder::decode() properly handles a frame that does
+ *        not fit in the frame buffer.
+ */
+TEST( cobsDecoderDecodeErrorHandling, frameTooLarge )
+{
+    auto decoder = COBS_Decoder<2>{};
+
+    EXPECT_FALSE( decoder.decode( 0x04 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x11 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x22 ).is_error() );
+
+    auto const result = decoder.decode( 0x33 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_FALSE( decoder.decode( 0x02 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x00 ).value() );
+
+    EXPECT_FALSE( decoder.decode( 0x02 ).value() );
+    EXPECT_FALSE( decoder.decode( 0x44 ).value() );
+    EXPECT_TRUE( decoder.decode( 0x00 ).value() );
+    EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), ( std::vector<std::uint8_t>{ 0x44 } ) );
+}
+
+/**
+ * \brief Verify microlibrary::COBS_Decoder::decode() properly handles a truncated frame.
+ */
+TEST( cobsDecoderDecodeErrorHandling, truncatedFrame )
+{
+    auto decoder = COBS_Decoder<8>{};
+
+    EXPECT_FALSE( decoder.decode( 0x04 ).value() );
+    EXPECT_FALSE( decoder.decode( 0x11 ).value() );
+
+    auto const result = decoder.decode( 0x00 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    EXPECT_EQ( decoder.size(), 0 );
+
+    EXPECT_FALSE( decoder.decode( 0x01 ).value() );
+    EXPECT_TRUE( decoder.decode( 0x00 ).value() );
+    EXPECT_EQ( decoder.size(), 0 );
+}
@@ -0,0 +1,287 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Cyclic Redundancy Check (CRC) automated tests.
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/crc.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Character_Block;
+using ::microlibrary::CRC;
+using ::microlibrary::CRC_16_IBM_3740;
+using ::microlibrary::CRC_32_ISO_HDLC;
+using ::microlibrary::CRC_Kernel;
+using ::microlibrary::CRC_Stream_IO_Driver;
+using ::microlibrary::Fault_Reporting_CRC_Stream_IO_Driver;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Fault_Reporting_String_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::String_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Vector_Stream_IO_Driver;
+using ::testing::_;
+using ::testing::A;
+using ::testing::Return;
+
+/**
+ * \brief The CRC catalogue check input.
+ */
+constexpr auto CHECK_INPUT = std::string_view{ "123456789" };
+
+static_assert( CRC_16_IBM_3740<>::calculate( CHECK_INPUT.begin(), CHECK_INPUT.end() ) == 0x29B1 );
+static_assert(
+    CRC_32_ISO_HDLC<CRC_Kernel::BYTE_TABLE>::calculate( CHECK_INPUT.begin(), CHECK_INPUT.end() )
+    == 0xCBF4'3926 );
+
+/**
+ * \brief Verify a CRC engine kernel produces the expected check value.
+ *
+ * \tparam CRC_Engine The CRC engine to verify.
+ *
+ * \param[in] check The expected check value.
+ */
+template<typename CRC_Engine>
+void verify_kernel( std::uint64_t check )
+{
+    EXPECT_EQ( CRC_Engine::calculate( CHECK_INPUT.begin(), CHECK_INPUT.end() ), check );
+
+    auto const data = std::vector<std::uint8_t>{ CHECK_INPUT.begin(), CHECK_INPUT.end() };
+
+    EXPECT_EQ( CRC_Engine::calculate( &*data.begin(), &*data.begin() + data.size() ), check );
+
+    auto crc = CRC_Engine{};
+
+    crc.update( CHECK_INPUT.begin(), CHECK_INPUT.begin() + 4 );
+    for ( auto character : CHECK_INPUT.substr( 4 ) ) {
+        crc.update( static_cast<std::uint8_t>( character ) );
+    } // for
+
+    EXPECT_EQ( crc.value(), check );
+
+    crc.reset();
+    crc.update( CHECK_INPUT.begin(), CHECK_INPUT.end() );
+
+    EXPECT_EQ( crc.value(), check );
+}
+
+/**
+ * \brief Verify all kernels of a CRC engine produce the expected check value.
+ *
+ * \tparam WIDTH The width of the CRC in bits.
+ * \tparam POLYNOMIAL The CRC polynomial.
+ * \tparam INIT The initial value of the CRC register.
+ * \tparam REFLECT_IN true if input bytes are processed least significant bit first.
+ * \tparam REFLECT_OUT true if the CRC register is reflected before the output XOR value is
+ *         applied.
+ * \tparam XOR_OUT The value that is XORed with the CRC register to produce the CRC.
+ *
+ * \param[in] check The expected check value.
+ */
+template<std::uint_fast8_t WIDTH, std::uint64_t POLYNOMIAL, std::uint64_t INIT, bool REFLECT_IN, bool REFLECT_OUT, std::uint64_t XOR_OUT>
+void verify( std::uint64_t check )
+{
+    {
+        SCOPED_TRACE( "bitwise" );
+        verify_kernel<CRC<WIDTH, POLYNOMIAL, INIT, REFLECT_IN, REFLECT_OUT, XOR_OUT, CRC_Kernel::BITWISE>>(
+            check );
+    }
+    {
+        SCOPED_TRACE( "nibble table" );
+        verify_kernel<CRC<WIDTH, POLYNOMIAL, INIT, REFLECT_IN, REFLECT_OUT, XOR_OUT, CRC_Kernel::NIBBLE_TABLE>>(
+            check );
+    }
+    {
+        SCOPED_TRACE( "byte table" );
+        verify_kernel<CRC<WIDTH, POLYNOMIAL, INIT, REFLECT_IN, REFLECT_OUT, XOR_OUT, CRC_Kernel::BYTE_TABLE>>(
+            check );
+    }
+}
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::CRC produces the CRC catalogue check values.
+ */
+TEST( crc, catalogueCheckValues )
+{
+    // clang-format off
+
+    { SCOPED_TRACE( "CRC-3/GSM" );          verify<  3,                0x3,                0x0, false, false,                0x7 >(                0x4 ); }
+    { SCOPED_TRACE( "CRC-3/ROHC" );         verify<  3,                0x3,                0x7,  true,  true,                0x0 >(                0x6 ); }
+    { SCOPED_TRACE( "CRC-4/G-704" );        verify<  4,                0x3,                0x0,  true,  true,                0x0 >(                0x7 ); }
+    { SCOPED_TRACE( "CRC-5/USB" );          verify<  5,               0x05,               0x1F,  true,  true,               0x1F >(               0x19 ); }
+    { SCOPED_TRACE( "CRC-6/CDMA2000-A" );   verify<  6,               0x27,               0x3F, false, false,               0x00 >(               0x0D ); }
+    { SCOPED_TRACE( "CRC-7/MMC" );          verify<  7,               0x09,               0x00, false, false,               0x00 >(               0x75 ); }
+    { SCOPED_TRACE( "CRC-8/SMBUS" );        verify<  8,               0x07,               0x00, false, false,               0x00 >(               0xF4 ); }
+    { SCOPED_TRACE( "CRC-8/MAXIM-DOW" );    verify<  8,               0x31,               0x00,  true,  true,               0x00 >(               0xA1 ); }
+    { SCOPED_TRACE( "CRC-10/ATM" );         verify< 10,              0x233,              0x000, false, false,              0x000 >(              0x199 ); }
+    { SCOPED_TRACE( "CRC-12/UMTS" );        verify< 12,              0x80F,              0x000, false,  true,              0x000 >(              0xDAF ); }
+    { SCOPED_TRACE( "CRC-16/ARC" );         verify< 16,             0x8005,             0x0000,  true,  true,             0x0000 >(             0xBB3D ); }
+    { SCOPED_TRACE( "CRC-16/GENIBUS" );     verify< 16,             0x1021,             0xFFFF, false, false,             0xFFFF >(             0xD64E ); }
+    { SCOPED_TRACE( "CRC-16/IBM-3740" );    verify< 16,             0x1021,             0xFFFF, false, false,             0x0000 >(             0x29B1 ); }
+    { SCOPED_TRACE( "CRC-16/IBM-SDLC" );    verify< 16,             0x1021,             0xFFFF,  true,  true,             0xFFFF >(             0x906E ); }
+    { SCOPED_TRACE( "CRC-16/KERMIT" );      verify< 16,             0x1021,             0x0000,  true,  true,             0x0000 >(             0x2189 ); }
+    { SCOPED_TRACE( "CRC-16/MODBUS" );      verify< 16,             0x8005,             0xFFFF,  true,  true,             0x0000 >(             0x4B37 ); }
+    { SCOPED_TRACE( "CRC-16/XMODEM" );      verify< 16,             0x1021,             0x0000, false, false,             0x0000 >(             0x31C3 ); }
+    { SCOPED_TRACE( "CRC-24/OPENPGP" );     verify< 24,           0x864CFB,           0xB704CE, false, false,           0x000000 >(           0x21CF02 ); }
+    { SCOPED_TRACE( "CRC-32/BZIP2" );       verify< 32,         0x04C11DB7,         0xFFFFFFFF, false, false,         0xFFFFFFFF >(         0xFC891918 ); }
+    { SCOPED_TRACE( "CRC-32/ISCSI" );       verify< 32,         0x1EDC6F41,         0xFFFFFFFF,  true,  true,         0xFFFFFFFF >(         0xE3069283 ); }
+    { SCOPED_TRACE( "CRC-32/ISO-HDLC" );    verify< 32,         0x04C11DB7,         0xFFFFFFFF,  true,  true,         0xFFFFFFFF >(         0xCBF43926 ); }
+    { SCOPED_TRACE( "CRC-32/MPEG-2" );      verify< 32,         0x04C11DB7,         0xFFFFFFFF, false, false,         0x00000000 >(         0x0376E6E7 ); }
+    { SCOPED_TRACE( "CRC-40/GSM" );         verify< 40,       0x0004820009,       0x0000000000, false, false,       0xFFFFFFFFFF >(       0xD4164FC646 ); }
+    { SCOPED_TRACE( "CRC-64/ECMA-182" );    verify< 64, 0x42F0E1EBA9EA3693, 0x0000000000000000, false, false, 0x0000000000000000 >( 0x6C40DF5F0B497347 ); }
+    { SCOPED_TRACE( "CRC-64/XZ" );          verify< 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF,  true,  true, 0xFFFFFFFFFFFFFFFF >( 0x995DC9BBDF1939FA ); }
+
+    // clang-format on
+}
+
+/**
+ * \brief Verify microlibrary::CRC::calculate() properly handles an empty block.
+ */
+TEST( calculate, emptyBlock )
+{
+    auto const data = std::uint8_t{};
+
+    EXPECT_EQ( CRC_32_ISO_HDLC<>::calculate( &data, &data ), 0x0000'0000 );
+    EXPECT_EQ( CRC_16_IBM_3740<>::calculate( &data, &data ), 0xFFFF );
+}
+
+/**
+ * \brief Verify microlibrary::CRC_Stream_IO_Driver forwards writes and updates the CRC.
+ */
+TEST( crcStreamIODriver, put )
+{
+    auto sink   = Vector_Stream_IO_Driver<std::uint8_t>{};
+    auto driver = CRC_Stream_IO_Driver<CRC_32_ISO_HDLC<CRC_Kernel::NIBBLE_TABLE>>{ sink };
+
+    auto const data = std::vector<std::uint8_t>{ '5', '6' };
+    auto const blocks = std::vector<Character_Block>{ { "7", "7" + 1 }, { "89", "89" + 2 } };
+
+    driver.put( '1' );
+    driver.put( "2" );
+    driver.put( CHECK_INPUT.begin() + 2, CHECK_INPUT.begin() + 4 );
+    driver.put( &*data.begin(), &*data.begin() + data.size() );
+    driver.put( &*blocks.begin(), &*blocks.begin() + blocks.size() );
+
+    EXPECT_EQ( sink.vector(), ( std::vector<std::uint8_t>{ CHECK_INPUT.begin(), CHECK_INPUT.end() } ) );
+    EXPECT_EQ( driver.crc().value(), 0xCBF4'3926 );
+
+    driver.crc().reset();
+    driver.put( std::uint8_t{ '1' } );
+
+    EXPECT_EQ( driver.crc().value(), CRC_32_ISO_HDLC<>::calculate( CHECK_INPUT.begin(), CHECK_INPUT.begin() + 1 ) );
+}
+
+/**
+ * \brief Verify microlibrary::CRC_Stream_IO_Driver forwards reads and updates the CRC.
+ */
+TEST( crcStreamIODriver, get )
+{
+    auto source = String_Stream_IO_Driver{ std::string{ CHECK_INPUT } };
+    auto driver = CRC_Stream_IO_Driver<CRC_16_IBM_3740<CRC_Kernel::BYTE_TABLE>>{ source };
+
+    EXPECT_EQ( driver.available(), CHECK_INPUT.size() );
+
+    auto characters = std::string( 4, '\0' );
+    auto data       = std::vector<std::uint8_t>( 8 );
+
+    EXPECT_EQ( driver.get( &*characters.begin(), &*characters.begin() + characters.size() ), &*characters.begin() + 4 );
+    EXPECT_EQ( driver.get( &*data.begin(), &*data.begin() + data.size() ), &*data.begin() + 5 );
+
+    EXPECT_EQ( driver.crc().value(), 0x29B1 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_CRC_Stream_IO_Driver forwards writes and
+ *        updates the CRC.
+ */
+TEST( faultReportingCRCStreamIODriver, put )
+{
+    auto sink   = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto driver = Fault_Reporting_CRC_Stream_IO_Driver<CRC_16_IBM_3740<>>{ sink };
+
+    auto const error = Mock_Error{ 137 };
+
+    EXPECT_CALL( sink, put( std::string{ CHECK_INPUT.substr( 0, 4 ) } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink, put( std::string{ CHECK_INPUT.substr( 4 ) } ) ).WillOnce( Return( error ) );
+
+    EXPECT_FALSE( driver.put( CHECK_INPUT.begin(), CHECK_INPUT.begin() + 4 ).is_error() );
+
+    auto const result = driver.put( CHECK_INPUT.begin() + 4, CHECK_INPUT.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( driver.crc().value(), 0x29B1 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_CRC_Stream_IO_Driver forwards reads and
+ *        updates the CRC.
+ */
+TEST( faultReportingCRCStreamIODriver, get )
+{
+    auto source = Fault_Reporting_String_Stream_IO_Driver{ std::string{ CHECK_INPUT } };
+    auto driver = Fault_Reporting_CRC_Stream_IO_Driver<CRC_16_IBM_3740<>>{ source };
+
+    auto data = std::vector<std::uint8_t>( 16 );
+
+    auto const result = driver.get( &*data.begin(), &*data.begin() + data.size() );
+
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), &*data.begin() + CHECK_INPUT.size() );
+
+    EXPECT_EQ( driver.crc().value(), 0x29B1 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_CRC_Stream_IO_Driver does not update the CRC
+ *        if a read fails.
+ */
+TEST( faultReportingCRCStreamIODriver, getError )
+{
+    auto source = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto driver = Fault_Reporting_CRC_Stream_IO_Driver<CRC_16_IBM_3740<>>{ source };
+
+    auto const error = Mock_Error{ 45 };
+
+    EXPECT_CALL( source, get( A<char *>(), _ ) ).WillOnce( Return( error ) );
+
+    auto characters = std::string( 4, '\0' );
+
+    auto const result = driver.get( &*characters.begin(), &*characters.begin() + characters.size() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( driver.crc().value(), CRC_16_IBM_3740<>{}.value() );
+}
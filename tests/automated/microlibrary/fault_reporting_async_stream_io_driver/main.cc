@@ -0,0 +1,254 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Fault_Reporting_Async_Stream_IO_Driver automated tests.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "microlibrary/async_stream_io_driver.h"
+#include "microlibrary/error.h"
+
+namespace {
+
+using ::microlibrary::Character_Block;
+using ::microlibrary::Fault_Reporting_Async_Stream_IO_Driver;
+using ::microlibrary::Generic_Error;
+
+/**
+ * \brief Simulated fault reporting asynchronous stream I/O driver.
+ *
+ * Transmit ready interrupts are simulated by calling
+ * Simulated_Async_Stream_IO_Driver::tick(), which transmits a single character if the
+ * transmit ready interrupt is enabled.
+ */
+class Simulated_Async_Stream_IO_Driver final : public Fault_Reporting_Async_Stream_IO_Driver<8> {
+  public:
+    Simulated_Async_Stream_IO_Driver() = default;
+
+    Simulated_Async_Stream_IO_Driver( Simulated_Async_Stream_IO_Driver && ) = delete;
+
+    Simulated_Async_Stream_IO_Driver( Simulated_Async_Stream_IO_Driver const & ) = delete;
+
+    ~Simulated_Async_Stream_IO_Driver() noexcept = default;
+
+    auto operator=( Simulated_Async_Stream_IO_Driver && ) = delete;
+
+    auto operator=( Simulated_Async_Stream_IO_Driver const & ) = delete;
+
+    /**
+     * \brief Check if the transmit ready interrupt is enabled.
+     *
+     * \return true if the transmit ready interrupt is enabled.
+     * \return false if the transmit ready interrupt is not enabled.
+     */
+    auto transmit_ready_interrupt_enabled() const noexcept -> bool
+    {
+        return m_transmit_ready_interrupt_enabled;
+    }
+
+    /**
+     * \brief Simulate a transmit ready interrupt.
+     *
+     * \return true if a character was transmitted.
+     * \return false if a character was not transmitted.
+     */
+    auto tick() -> bool
+    {
+        if ( not m_transmit_ready_interrupt_enabled ) {
+            return false;
+        } // if
+
+        auto const result = this->handle_transmit_ready();
+        if ( result.is_error() ) {
+            return false;
+        } // if
+
+        m_transmitted.push_back( static_cast<char>( result.value() ) );
+
+        return true;
+    }
+
+    /**
+     * \brief Simulate transmit ready interrupts until the transmit queue is empty.
+     */
+    void drain()
+    {
+        while ( tick() ) {} // while
+    }
+
+    /**
+     * \brief Get the characters that have been transmitted.
+     *
+     * \return The characters that have been transmitted.
+     */
+    auto transmitted() const noexcept -> std::string const &
+    {
+        return m_transmitted;
+    }
+
+  private:
+    /**
+     * \brief The transmit ready interrupt enable state.
+     */
+    std::atomic<bool> m_transmit_ready_interrupt_enabled{ false };
+
+    /**
+     * \brief The characters that have been transmitted.
+     */
+    std::string m_transmitted{};
+
+    /**
+     * \brief Enable the simulated transmit ready interrupt.
+     */
+    void enable_transmit_ready_interrupt() noexcept override
+    {
+        m_transmit_ready_interrupt_enabled = true;
+    }
+
+    /**
+     * \brief Disable the simulated transmit ready interrupt.
+     */
+    void disable_transmit_ready_interrupt() noexcept override
+    {
+        m_transmit_ready_interrupt_enabled = false;
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Async_Stream_IO_Driver::put() properly
+ *        handles a full transmit queue.
+ */
+TEST( putErrorHandling, wouldOverflow )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver{};
+
+    EXPECT_FALSE( driver.put( "M2bQ9" ).is_error() );
+
+    auto const string = std::string_view{ "tRk1" };
+
+    auto const result = driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( driver.size(), 5 );
+
+    EXPECT_FALSE( driver.put( std::uint8_t{ 'f' } ).is_error() );
+    EXPECT_FALSE( driver.put( 'V' ).is_error() );
+    EXPECT_FALSE( driver.put( 'j' ).is_error() );
+    EXPECT_EQ( driver.put( 'o' ).error(), Generic_Error::WOULD_OVERFLOW );
+
+    driver.drain();
+
+    EXPECT_EQ( driver.transmitted(), "M2bQ9fVj" );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Async_Stream_IO_Driver::put() works
+ *        properly.
+ */
+TEST( put, worksProperly )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver{};
+
+    auto const string = std::string_view{ "h8D" };
+
+    EXPECT_FALSE( driver.put( string.begin(), string.end() ).is_error() );
+    EXPECT_FALSE( driver.put( "sY" ).is_error() );
+
+    EXPECT_TRUE( driver.tick() );
+    EXPECT_TRUE( driver.tick() );
+
+    EXPECT_FALSE( driver.put( "3uWaC" ).is_error() );
+
+    driver.drain();
+
+    EXPECT_FALSE( driver.transmit_ready_interrupt_enabled() );
+    EXPECT_FALSE( driver.flush().is_error() );
+
+    EXPECT_EQ( driver.transmitted(), "h8DsY3uWaC" );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Async_Stream_IO_Driver::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        properly handles a full transmit queue.
+ */
+TEST( putCharBlockListErrorHandling, wouldOverflow )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver{};
+
+    EXPECT_FALSE( driver.put( "Wq" ).is_error() );
+
+    auto const a = std::string_view{ "7e" };
+    auto const b = std::string_view{ "Ln3r0" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    auto const result = driver.put( std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( driver.size(), 2 );
+
+    driver.drain();
+
+    EXPECT_EQ( driver.transmitted(), "Wq" );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Async_Stream_IO_Driver::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto driver = Simulated_Async_Stream_IO_Driver{};
+
+    auto const a = std::string_view{ "7e" };
+    auto const b = std::string_view{ "" };
+    auto const c = std::string_view{ "Ln3r0" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+        { c.begin(), c.end() },
+    };
+
+    EXPECT_FALSE( driver.put( std::begin( blocks ), std::end( blocks ) ).is_error() );
+
+    EXPECT_TRUE( driver.transmit_ready_interrupt_enabled() );
+    EXPECT_EQ( driver.size(), 7 );
+
+    driver.drain();
+
+    EXPECT_EQ( driver.transmitted(), "7eLn3r0" );
+}
@@ -0,0 +1,344 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/buffered_stream_io_driver.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put( char )
+ *        properly handles a put error.
+ */
+TEST( putCharErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<4>{ driver };
+
+    auto const error = Mock_Error{ 73 };
+
+    EXPECT_CALL( driver, put( std::string{ "uG4p" } ) ).WillOnce( Return( error ) );
+
+    for ( auto const character : std::string_view{ "uG4p" } ) {
+        EXPECT_FALSE( buffered_driver.put( character ).is_error() );
+    } // for
+
+    auto const result = buffered_driver.put( 'Q' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( buffered_driver.size(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put( char )
+ *        works properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<4>{ driver };
+
+    EXPECT_CALL( driver, put( A<char>() ) ).Times( 0 );
+    EXPECT_CALL( driver, put( std::string{ "Fq8j" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ "N" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    for ( auto const character : std::string_view{ "Fq8jN" } ) {
+        EXPECT_FALSE( buffered_driver.put( character ).is_error() );
+    } // for
+
+    EXPECT_FALSE( buffered_driver.flush().is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put( char const
+ *        *, char const * ) properly handles a put error.
+ */
+TEST( putCharBlockErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<4>{ driver };
+
+    auto const error = Mock_Error{ 192 };
+
+    EXPECT_CALL( driver, put( std::string{ "Hc2bW9xT" } ) ).WillOnce( Return( error ) );
+
+    auto const string = std::string_view{ "Hc2bW9xT" };
+
+    auto const result = buffered_driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put( char const
+ *        *, char const * ) works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "s0Pe" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ "a1GmZr7hKv" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ "Yt" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    auto const a = std::string_view{ "s0Pe" };
+    auto const b = std::string_view{ "a1GmZr7hKv" };
+    auto const c = std::string_view{ "Yt" };
+
+    EXPECT_FALSE( buffered_driver.put( a.begin(), a.end() ).is_error() );
+    EXPECT_FALSE( buffered_driver.put( b.begin(), b.end() ).is_error() );
+    EXPECT_FALSE( buffered_driver.put( c.begin(), c.end() ).is_error() );
+    EXPECT_FALSE( buffered_driver.flush().is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put( char const
+ *        * ) works properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<16>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "dUi3Ko9" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffered_driver.put( "dUi3" ).is_error() );
+    EXPECT_FALSE( buffered_driver.put( "Ko9" ).is_error() );
+    EXPECT_FALSE( buffered_driver.flush().is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put(
+ *        std::uint8_t ) properly handles a put error.
+ */
+TEST( putDataErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    auto const error = Mock_Error{ 5 };
+
+    EXPECT_CALL( driver, put( std::string{ "c" } ) ).WillOnce( Return( error ) );
+
+    EXPECT_FALSE( buffered_driver.put( 'c' ).is_error() );
+
+    auto const result = buffered_driver.put( std::uint8_t{ 0x9B } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::put(
+ *        std::uint8_t const *, std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<4>{ driver };
+
+    auto const a = std::vector<std::uint8_t>{ 0xE0, 0x15, 0x7C };
+    auto const b = std::vector<std::uint8_t>{ 0x2A, 0x88 };
+
+    EXPECT_CALL( driver, put( a ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( b ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffered_driver.put( &*a.begin(), &*a.begin() + a.size() ).is_error() );
+    EXPECT_FALSE( buffered_driver.put( &*b.begin(), &*b.begin() + b.size() ).is_error() );
+    EXPECT_FALSE( buffered_driver.flush().is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::flush() properly
+ *        handles a put error.
+ */
+TEST( flushErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    auto const error = Mock_Error{ 158 };
+
+    EXPECT_CALL( driver, put( std::string{ "Rw" } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( driver, flush() ).Times( 0 );
+
+    EXPECT_FALSE( buffered_driver.put( "Rw" ).is_error() );
+
+    auto const result = buffered_driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( buffered_driver.size(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::flush() properly
+ *        handles a flush error.
+ */
+TEST( flushErrorHandling, flushError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    auto const error = Mock_Error{ 41 };
+
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( error ) );
+
+    auto const result = buffered_driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::reserve()
+ *        properly handles a put error.
+ */
+TEST( reserveErrorHandling, putError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    auto const error = Mock_Error{ 226 };
+
+    EXPECT_CALL( driver, put( std::string{ "k3Wd1" } ) ).WillOnce( Return( error ) );
+
+    EXPECT_FALSE( buffered_driver.put( "k3Wd1" ).is_error() );
+
+    auto const result = buffered_driver.reserve( 4 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( buffered_driver.size(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::reserve()
+ *        properly handles a reservation that exceeds the capacity of the write buffer.
+ */
+TEST( reserve, exceedsCapacity )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( A<std::string>() ) ).Times( 0 );
+
+    EXPECT_FALSE( buffered_driver.put( 'e' ).is_error() );
+
+    auto const result = buffered_driver.reserve( 9 );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), nullptr );
+
+    EXPECT_EQ( buffered_driver.size(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::reserve() and
+ *        microlibrary::Fault_Reporting_Buffered_Stream_IO_Driver::commit() work properly.
+ */
+TEST( reserveCommit, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto buffered_driver = Fault_Reporting_Buffered_Stream_IO_Driver<8>{ driver };
+
+    EXPECT_CALL( driver, put( std::string{ "P7mY" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ "s0aVx" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffered_driver.put( 'P' ).is_error() );
+
+    auto const first = buffered_driver.reserve( 6 );
+    ASSERT_FALSE( first.is_error() );
+    ASSERT_NE( first.value(), nullptr );
+    first.value()[ 0 ] = '7';
+    first.value()[ 1 ] = 'm';
+    first.value()[ 2 ] = 'Y';
+    EXPECT_FALSE( buffered_driver.commit( 3 ).is_error() );
+
+    EXPECT_EQ( buffered_driver.size(), 4 );
+
+    auto const second = buffered_driver.reserve( 5 );
+    ASSERT_FALSE( second.is_error() );
+    ASSERT_NE( second.value(), nullptr );
+    auto location = second.value();
+    for ( auto const character : std::string_view{ "s0aVx" } ) {
+        *location = character;
+        ++location;
+    } // for
+    EXPECT_FALSE( buffered_driver.commit( 5 ).is_error() );
+
+    EXPECT_EQ( buffered_driver.size(), 5 );
+
+    EXPECT_FALSE( buffered_driver.flush().is_error() );
+}
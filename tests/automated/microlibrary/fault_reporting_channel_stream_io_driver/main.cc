@@ -0,0 +1,272 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Fault_Reporting_Channel_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/channel_stream_io_driver.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Character_Block;
+using ::microlibrary::Fault_Reporting_Channel_Stream_IO_Driver;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( char const
+ *        *, char const * ) properly handles a header put error.
+ */
+TEST( putCharBlockErrorHandling, headerPutError )
+{
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x2F };
+
+    auto const error = Mock_Error{ 61 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x2F, 4 } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( link, put( A<std::string>() ) ).Times( 0 );
+
+    auto const string = std::string_view{ "u0Bq" };
+
+    auto const result = driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( char const
+ *        *, char const * ) properly handles a payload put error.
+ */
+TEST( putCharBlockErrorHandling, payloadPutError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x2F };
+
+    auto const string = std::string( 300, 'v' );
+    auto const error  = Mock_Error{ 142 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x2F, 255 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string( 255, 'v' ) ) ).WillOnce( Return( error ) );
+
+    auto const result = driver.put( &*string.begin(), &*string.begin() + string.size() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( char const
+ *        *, char const * ) works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x2F };
+
+    EXPECT_EQ( driver.channel(), 0x2F );
+
+    auto const string = std::string( 300, 'v' );
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x2F, 255 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string( 255, 'v' ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x2F, 45 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string( 45, 'v' ) ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( &*string.begin(), &*string.begin() + string.size() ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( char ) works
+ *        properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x80 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x80, 1 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string{ "J" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( 'J' ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) properly handles a header put error.
+ */
+TEST( putDataBlockErrorHandling, headerPutError )
+{
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x04 };
+
+    auto const data  = std::vector<std::uint8_t>{ 0x91, 0x3C };
+    auto const error = Mock_Error{ 230 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x04, 2 } ) ).WillOnce( Return( error ) );
+
+    auto const result = driver.put( &*data.begin(), &*data.begin() + data.size() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x04 };
+
+    auto const data = std::vector<std::uint8_t>{ 0x91, 0x3C };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x04, 2 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( data ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( &*data.begin(), &*data.begin() + data.size() ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put(
+ *        Character_Block const *, Character_Block const * ) properly handles a put error.
+ */
+TEST( putCharacterBlocksErrorHandling, putError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x66 };
+
+    auto const a = std::string_view{ "Pw" };
+    auto const b = std::string_view{ "s1" };
+
+    Character_Block const blocks[] = {
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    auto const error = Mock_Error{ 17 };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x66, 2 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string{ a } ) ).WillOnce( Return( error ) );
+
+    auto const result = driver.put( std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::put(
+ *        Character_Block const *, Character_Block const * ) works properly.
+ */
+TEST( putCharacterBlocks, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x66 };
+
+    auto const a = std::string_view{ "Pw" };
+    auto const b = std::string_view{ "s1y" };
+
+    Character_Block const blocks[] = {
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x66, 2 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string{ a } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::vector<std::uint8_t>{ 0x66, 3 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( link, put( std::string{ b } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( std::begin( blocks ), std::end( blocks ) ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::flush() properly
+ *        handles a flush error.
+ */
+TEST( flushErrorHandling, flushError )
+{
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x01 };
+
+    auto const error = Mock_Error{ 88 };
+
+    EXPECT_CALL( link, flush() ).WillOnce( Return( error ) );
+
+    auto const result = driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Channel_Stream_IO_Driver::flush() works
+ *        properly.
+ */
+TEST( flush, worksProperly )
+{
+    auto link = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Channel_Stream_IO_Driver{ link, 0x01 };
+
+    EXPECT_CALL( link, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.flush().is_error() );
+}
@@ -0,0 +1,395 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Fault_Reporting_Input_Stream automated tests.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Fault_Reporting_Input_Stream;
+using ::microlibrary::Input_Formatter;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Input_String_Stream;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Input_Stream;
+using ::testing::_;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Ref;
+using ::testing::Return;
+
+enum class Foo {};
+
+class Mock_Input_Formatter {
+  public:
+    Mock_Input_Formatter() = default;
+
+    Mock_Input_Formatter( Mock_Input_Formatter && ) = delete;
+
+    Mock_Input_Formatter( Mock_Input_Formatter const & ) = delete;
+
+    ~Mock_Input_Formatter() noexcept = default;
+
+    auto operator=( Mock_Input_Formatter && ) = delete;
+
+    auto operator=( Mock_Input_Formatter const & ) = delete;
+
+    MOCK_METHOD( Result<std::size_t>, scan, (Fault_Reporting_Input_Stream &, Foo &), ( const ) );
+};
+
+} // namespace
+
+template<>
+class microlibrary::Input_Formatter<::Foo> {
+  public:
+    Input_Formatter() = delete;
+
+    Input_Formatter( ::Mock_Input_Formatter const & mock_input_formatter ) noexcept :
+        m_mock_input_formatter{ &mock_input_formatter }
+    {
+    }
+
+    Input_Formatter( Input_Formatter && source ) noexcept = default;
+
+    Input_Formatter( Input_Formatter const & original ) noexcept = default;
+
+    ~Input_Formatter() noexcept = default;
+
+    auto operator=( Input_Formatter && expression ) noexcept -> Input_Formatter & = default;
+
+    auto operator=( Input_Formatter const & expression ) noexcept -> Input_Formatter & = default;
+
+    auto scan( Fault_Reporting_Input_Stream & stream, ::Foo & foo ) const noexcept
+        -> Result<std::size_t>
+    {
+        return m_mock_input_formatter->scan( stream, foo );
+    }
+
+  private:
+    ::Mock_Input_Formatter const * m_mock_input_formatter{};
+};
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::available() properly handles
+ *        an available error.
+ */
+TEST( availableErrorHandling, availableError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 14 };
+
+    EXPECT_CALL( stream.driver(), available() ).WillOnce( Return( error ) );
+
+    auto const result = stream.available();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::available() works properly.
+ */
+TEST( available, worksProperly )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "vK3" };
+
+    {
+        auto const result = stream.available();
+
+        EXPECT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), 3 );
+    }
+
+    auto character = char{};
+    EXPECT_FALSE( stream.peek( character ).is_error() );
+
+    {
+        auto const result = stream.available();
+
+        EXPECT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), 3 );
+    }
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::peek() properly handles a get
+ *        error.
+ */
+TEST( peekErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 201 };
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( Return( error ) );
+
+    auto       character = char{};
+    auto const result    = stream.peek( character );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::peek() properly handles
+ *        end-of-file being reached.
+ */
+TEST( peekErrorHandling, endOfFileReached )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "" };
+
+    auto       character = char{};
+    auto const result    = stream.peek( character );
+
+    EXPECT_FALSE( result.is_error() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::peek() works properly.
+ */
+TEST( peek, worksProperly )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "h7" };
+
+    auto character = char{};
+
+    EXPECT_FALSE( stream.peek( character ).is_error() );
+    EXPECT_EQ( character, 'h' );
+
+    EXPECT_FALSE( stream.peek( character ).is_error() );
+    EXPECT_EQ( character, 'h' );
+
+    EXPECT_FALSE( stream.get( character ).is_error() );
+    EXPECT_EQ( character, 'h' );
+
+    EXPECT_FALSE( stream.peek( character ).is_error() );
+    EXPECT_EQ( character, '7' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::get( char ) properly handles
+ *        a get error.
+ */
+TEST( getCharErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 89 };
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( Return( error ) );
+
+    auto       character = char{};
+    auto const result    = stream.get( character );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::get( char * , char * )
+ *        properly handles end-of-file being reached.
+ */
+TEST( getCharBlockErrorHandling, endOfFileReached )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "0t" };
+
+    auto string = std::string( 4, '\0' );
+
+    auto const result = stream.get( string.data(), string.data() + string.size() );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), string.data() + 2 );
+    EXPECT_EQ( string.substr( 0, 2 ), "0t" );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::get( char *, char * ) works
+ *        properly.
+ */
+TEST( getCharBlock, worksProperly )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "Rr9fPq" };
+
+    auto character = char{};
+    EXPECT_FALSE( stream.peek( character ).is_error() );
+
+    auto string = std::string( 6, '\0' );
+
+    auto const result = stream.get( string.data(), string.data() + string.size() );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), string.data() + string.size() );
+    EXPECT_EQ( string, "Rr9fPq" );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::get( std::uint8_t *,
+ *        std::uint8_t * ) properly handles a get error.
+ */
+TEST( getDataBlockErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 172 };
+
+    EXPECT_CALL( stream.driver(), get( A<std::uint8_t *>(), A<std::uint8_t *>() ) )
+        .WillOnce( Return( error ) );
+
+    std::uint8_t data[ 2 ]{};
+
+    auto const result = stream.get( data, data + 2 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::get( std::uint8_t *,
+ *        std::uint8_t * ) works properly.
+ */
+TEST( getDataBlock, worksProperly )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "\x02\xFB" };
+
+    std::uint8_t data[ 2 ]{};
+
+    auto const result = stream.get( data, data + 2 );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), data + 2 );
+    EXPECT_EQ( data[ 0 ], 0x02 );
+    EXPECT_EQ( data[ 1 ], 0xFB );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::scan() properly handles a
+ *        scan error.
+ */
+TEST( scanErrorHandling, scanError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto       foo_a           = Foo{ 201 };
+    auto const foo_a_formatter = Mock_Input_Formatter{};
+    auto       foo_b           = Foo{ 141 };
+    auto const foo_b_formatter = Mock_Input_Formatter{};
+
+    auto const error = Mock_Error{ 37 };
+
+    EXPECT_CALL( foo_a_formatter, scan( Ref( stream ), Ref( foo_a ) ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( foo_b_formatter, scan( _, _ ) ).Times( 0 );
+
+    auto const result = stream.scan(
+        foo_a, Input_Formatter<Foo>{ foo_a_formatter }, foo_b, Input_Formatter<Foo>{ foo_b_formatter } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Input_Stream::scan() works properly when
+ *        there are multiple values to parse.
+ */
+TEST( scan, worksProperlyMultipleValues )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto       foo_a           = Foo{ 201 };
+    auto const foo_a_formatter = Mock_Input_Formatter{};
+    auto const foo_a_size      = std::size_t{ 47 };
+    auto       foo_b           = Foo{ 141 };
+    auto const foo_b_formatter = Mock_Input_Formatter{};
+    auto const foo_b_size      = std::size_t{ 253 };
+
+    EXPECT_CALL( foo_a_formatter, scan( Ref( stream ), Ref( foo_a ) ) ).WillOnce( Return( foo_a_size ) );
+    EXPECT_CALL( foo_b_formatter, scan( Ref( stream ), Ref( foo_b ) ) ).WillOnce( Return( foo_b_size ) );
+
+    auto const result = stream.scan(
+        foo_a, Input_Formatter<Foo>{ foo_a_formatter }, foo_b, Input_Formatter<Foo>{ foo_b_formatter } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), foo_a_size + foo_b_size );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Formatter<char>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, char & ) works properly.
+ */
+TEST( inputFormatterCharScanFaultReportingInputStream, worksProperly )
+{
+    auto stream = Fault_Reporting_Input_String_Stream{ "E" };
+
+    auto character = char{};
+
+    auto const result = stream.scan( character );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 1 );
+    EXPECT_EQ( character, 'E' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
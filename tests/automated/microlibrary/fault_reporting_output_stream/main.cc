@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -37,6 +38,7 @@
 
 namespace {
 
+using ::microlibrary::Character_Block;
 using ::microlibrary::Error_Code;
 using ::microlibrary::Fault_Reporting_Output_Stream;
 using ::microlibrary::Output_Formatter;
@@ -305,6 +307,60 @@ TEST( putDataBlock, worksProperly )
     EXPECT_TRUE( stream.is_nominal() );
 }
 
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        properly handles a put error.
+ */
+TEST( putCharBlockListErrorHandling, putError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 58 };
+
+    EXPECT_CALL( stream.driver(), put( A<std::vector<std::string>>() ) ).WillOnce( Return( error ) );
+
+    auto const a = std::string_view{ "Jw1" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+    };
+
+    auto const result = stream.put( std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const a = std::string_view{ "tW" };
+    auto const b = std::string_view{ "8Hc0q" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    EXPECT_CALL( stream.driver(), put( std::vector<std::string>{ "tW", "8Hc0q" } ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.put( std::begin( blocks ), std::end( blocks ) ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Verify microlibrary::Fault_Reporting_Output_Stream::print() properly handles a
  *        microlibrary::Output_Formatter::print() error.
@@ -381,6 +437,83 @@ TEST( print, worksProperlyMultipleValues )
     EXPECT_TRUE( stream.is_nominal() );
 }
 
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::reserve() properly handles a
+ *        reserve error.
+ */
+TEST( reserveErrorHandling, reserveError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 118 };
+
+    EXPECT_CALL( stream.driver(), reserve( 7 ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.reserve( 7 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::reserve() works properly.
+ */
+TEST( reserve, worksProperly )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 7, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 7 ) ).WillOnce( Return( buffer.data() ) );
+
+    auto const result = stream.reserve( 7 );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), buffer.data() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::commit() properly handles a
+ *        commit error.
+ */
+TEST( commitErrorHandling, commitError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 52 };
+
+    EXPECT_CALL( stream.driver(), commit( 3 ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.commit( 3 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Output_Stream::commit() works properly.
+ */
+TEST( commit, worksProperly )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    EXPECT_CALL( stream.driver(), commit( 3 ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.commit( 3 ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Verify microlibrary::Fault_Reporting_Output_Stream::flush() properly handles a
  *        flush error.
@@ -21,6 +21,8 @@
  */
 
 #include <cstdint>
+#include <iterator>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -33,6 +35,7 @@
 
 namespace {
 
+using ::microlibrary::Character_Block;
 using ::microlibrary::Result;
 using ::microlibrary::Testing::Automated::Mock_Error;
 using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
@@ -165,3 +168,63 @@ TEST( putDataBlock, worksProperly )
     EXPECT_FALSE(
         driver.Fault_Reporting_Stream_IO_Driver::put( &*values.begin(), &*values.end() ).is_error() );
 }
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Stream_IO_Driver::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        properly handles a put error.
+ */
+TEST( putCharBlockListErrorHandling, putError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto const a = std::string_view{ "e2Lw" };
+    auto const b = std::string_view{ "Qa" };
+    auto const c = std::string_view{ "7z" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+        { c.begin(), c.end() },
+    };
+
+    auto const error = Mock_Error{ 37 };
+
+    EXPECT_CALL( driver, put( std::string{ a } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ b } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( driver, put( std::string{ c } ) ).Times( 0 );
+
+    auto const result = driver.Fault_Reporting_Stream_IO_Driver::put(
+        std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Stream_IO_Driver::put(
+ *        microlibrary::Character_Block const *, microlibrary::Character_Block const * )
+ *        works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto const a = std::string_view{ "Xh0" };
+    auto const b = std::string_view{ "p4GyM" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    EXPECT_CALL( driver, put( std::string{ a } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::string{ b } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.Fault_Reporting_Stream_IO_Driver::put( std::begin( blocks ), std::end( blocks ) )
+                      .is_error() );
+}
@@ -0,0 +1,291 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Fault_Reporting_Tee_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/result.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/tee_stream_io_driver.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Character_Block;
+using ::microlibrary::Fault_Reporting_Tee_Stream_IO_Driver;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::Return;
+using ::testing::TypedEq;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver sink enable mask
+ *        management works properly.
+ */
+TEST( mask, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    static_assert( decltype( driver )::sinks() == 2 );
+
+    EXPECT_EQ( driver.mask(), 0b11 );
+
+    driver.disable( 0 );
+
+    EXPECT_EQ( driver.mask(), 0b10 );
+    EXPECT_FALSE( driver.is_enabled( 0 ) );
+    EXPECT_TRUE( driver.is_enabled( 1 ) );
+
+    driver.enable( 0 );
+
+    EXPECT_EQ( driver.mask(), 0b11 );
+
+    driver.set_mask( 0b101 );
+
+    EXPECT_EQ( driver.mask(), 0b01 );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( char )
+ *        properly handles a put error.
+ */
+TEST( putCharErrorHandling, putError )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_c = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b, sink_c };
+
+    auto const character = 'h';
+    auto const error     = Mock_Error{ 44 };
+
+    EXPECT_CALL( sink_a, put( TypedEq<char>( character ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( TypedEq<char>( character ) ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( sink_c, put( TypedEq<char>( character ) ) ).WillOnce( Return( Mock_Error{ 203 } ) );
+
+    auto const result = driver.put( character );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( char ) works
+ *        properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_c = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b, sink_c };
+
+    driver.disable( 2 );
+
+    auto const character = 'S';
+
+    EXPECT_CALL( sink_a, put( TypedEq<char>( character ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( TypedEq<char>( character ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_c, put( A<char>() ) ).Times( 0 );
+
+    EXPECT_FALSE( driver.put( character ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( char const *,
+ *        char const * ) properly handles a put error.
+ */
+TEST( putCharBlockErrorHandling, putError )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const string = std::string_view{ "e4KpX" };
+    auto const error  = Mock_Error{ 118 };
+
+    EXPECT_CALL( sink_a, put( std::string{ string } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( sink_b, put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( char const *,
+ *        char const * ) works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const string = std::string_view{ "Gv9tA2m" };
+
+    EXPECT_CALL( sink_a, put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( string.begin(), string.end() ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( char const * )
+ *        works properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const string = "0nWy";
+
+    EXPECT_CALL( sink_a, put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( string ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( std::uint8_t )
+ *        works properly.
+ */
+TEST( putData, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const data = std::uint8_t{ 0x3B };
+
+    EXPECT_CALL( sink_a, put( TypedEq<std::uint8_t>( data ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( TypedEq<std::uint8_t>( data ) ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( data ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const data = std::vector<std::uint8_t>{ 0xA0, 0x17, 0x5E };
+
+    EXPECT_CALL( sink_a, put( data ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( data ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( &*data.begin(), &*data.begin() + data.size() ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::put( Character_Block
+ *        const *, Character_Block const * ) works properly.
+ */
+TEST( putCharacterBlocks, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const a = std::string_view{ "pQ" };
+    auto const b = std::string_view{ "7zR3" };
+
+    Character_Block const blocks[] = {
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    auto const expected = std::vector<std::string>{ std::string{ a }, std::string{ b } };
+
+    EXPECT_CALL( sink_a, put( expected ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( expected ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.put( std::begin( blocks ), std::end( blocks ) ).is_error() );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::flush() properly
+ *        handles a flush error.
+ */
+TEST( flushErrorHandling, flushError )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const error = Mock_Error{ 9 };
+
+    EXPECT_CALL( sink_a, flush() ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, flush() ).WillOnce( Return( error ) );
+
+    auto const result = driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_Tee_Stream_IO_Driver::flush() works
+ *        properly.
+ */
+TEST( flush, worksProperly )
+{
+    auto sink_a = Mock_Fault_Reporting_Stream_IO_Driver{};
+    auto sink_b = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto driver = Fault_Reporting_Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    EXPECT_CALL( sink_a, flush() ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( driver.flush().is_error() );
+}
@@ -0,0 +1,198 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Field automated tests.
+ */
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/register.h"
+
+namespace {
+
+using ::microlibrary::Field;
+using ::microlibrary::Register;
+using ::microlibrary::Register_Transaction;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+
+/**
+ * \brief Test register.
+ */
+using Test_Register = Register<std::uint8_t>;
+
+/**
+ * \brief Test field enum (values are shifted into position).
+ */
+enum class Mode : std::uint8_t {
+    A = 0b00 << 4, ///< A.
+    B = 0b01 << 4, ///< B.
+    C = 0b10 << 4, ///< C.
+    D = 0b11 << 4, ///< D.
+};
+
+/**
+ * \brief Test fields.
+ */
+struct Test_Field {
+    static constexpr auto ENABLE = Field<Test_Register, 0, 1, bool>{};         ///< ENABLE.
+    static constexpr auto COUNT  = Field<Test_Register, 1, 3, std::uint8_t>{}; ///< COUNT.
+    static constexpr auto MODE   = Field<Test_Register, 4, 2, Mode>{};         ///< MODE.
+    static constexpr auto FLAG   = Field<Test_Register, 7, 1, bool>{};         ///< FLAG.
+};
+
+static_assert( Test_Field::ENABLE.MASK == 0b0000'0001 );
+static_assert( Test_Field::COUNT.MASK == 0b0000'1110 );
+static_assert( Test_Field::MODE.MASK == 0b0011'0000 );
+static_assert( Test_Field::FLAG.MASK == 0b1000'0000 );
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Field::encode() and microlibrary::Field::decode() work
+ *        properly.
+ */
+TEST( encodeDecode, worksProperly )
+{
+    EXPECT_EQ( Test_Field::ENABLE.encode( true ), 0b0000'0001 );
+    EXPECT_EQ( Test_Field::COUNT.encode( 0b101 ), 0b0000'1010 );
+    EXPECT_EQ( Test_Field::COUNT.encode( 0b1111'1101 ), 0b0000'1010 );
+    EXPECT_EQ( Test_Field::MODE.encode( Mode::C ), 0b0010'0000 );
+    EXPECT_EQ( Test_Field::FLAG.encode( true ), 0b1000'0000 );
+
+    EXPECT_TRUE( Test_Field::ENABLE.decode( 0b1111'0001 ) );
+    EXPECT_FALSE( Test_Field::ENABLE.decode( 0b1111'1110 ) );
+    EXPECT_EQ( Test_Field::COUNT.decode( 0b1111'0111 ), 0b011 );
+    EXPECT_EQ( Test_Field::MODE.decode( 0b1101'1111 ), Mode::B );
+    EXPECT_TRUE( Test_Field::FLAG.decode( 0b1000'0000 ) );
+}
+
+/**
+ * \brief Verify microlibrary::Field::read() works properly.
+ */
+TEST( read, worksProperly )
+{
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).WillOnce( Return( 0b0111'1010 ) );
+
+    EXPECT_EQ( Test_Field::MODE.read( reg ), Mode::D );
+
+    EXPECT_EQ( reg.reads(), 1 );
+    EXPECT_EQ( reg.writes(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Field::write() works properly.
+ */
+TEST( write, worksProperly )
+{
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).Times( 0 );
+    EXPECT_CALL( reg, write( 0b0000'1100 ) );
+
+    Test_Field::COUNT.write( reg, 0b110 );
+
+    EXPECT_EQ( reg.reads(), 0 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::Field::modify() works properly.
+ */
+TEST( modify, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).WillOnce( Return( 0b1111'1111 ) );
+    EXPECT_CALL( reg, write( 0b1101'1111 ) );
+
+    Test_Field::MODE.modify( reg, Mode::B );
+
+    EXPECT_EQ( reg.reads(), 1 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::set() updates multiple fields with a single register read
+ *        and a single register write.
+ */
+TEST( set, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).WillOnce( Return( 0b1100'0001 ) );
+    EXPECT_CALL( reg, write( 0b1110'0100 ) );
+    EXPECT_CALL( reg, write_and( _ ) ).Times( 0 );
+    EXPECT_CALL( reg, write_or( _ ) ).Times( 0 );
+    EXPECT_CALL( reg, write_xor( _ ) ).Times( 0 );
+
+    set( reg, Test_Field::ENABLE = false, Test_Field::COUNT = 0b010, Test_Field::MODE = Mode::C );
+
+    EXPECT_EQ( reg.reads(), 1 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::set() stages field updates in a register transaction.
+ */
+TEST( set, stagesTransaction )
+{
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).Times( 0 );
+    EXPECT_CALL( reg, write( 0b1000'0111 ) );
+
+    auto transaction = Register_Transaction{ reg, 0b0011'0000 };
+
+    set( transaction, Test_Field::FLAG = true, Test_Field::MODE = Mode::A );
+    set( transaction, Test_Field::ENABLE = true, Test_Field::COUNT = 0b011 );
+
+    EXPECT_EQ( reg.writes(), 0 );
+
+    transaction.commit();
+
+    EXPECT_EQ( reg.reads(), 0 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
+
+/**
+ * \brief Verify microlibrary::write() writes multiple fields with a single register
+ *        write.
+ */
+TEST( write, multipleFields )
+{
+    auto reg = Test_Register{};
+
+    EXPECT_CALL( reg, read() ).Times( 0 );
+    EXPECT_CALL( reg, write( 0b1011'0001 ) );
+
+    write( reg, Test_Field::FLAG = true, Test_Field::MODE = Mode::D, Test_Field::ENABLE = true );
+
+    EXPECT_EQ( reg.reads(), 0 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
@@ -20,6 +20,7 @@
  * \brief microlibrary::Format::Bin automated tests.
  */
 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 #include <string>
@@ -33,11 +34,19 @@
 
 namespace {
 
+using ::microlibrary::Result;
+using ::microlibrary::Format::Alignment;
 using ::microlibrary::Format::Bin;
+using ::microlibrary::Format::Kernel;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Input_String_Stream;
 using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Input_String_Stream;
 using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Input_Stream;
 using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Mock_Output_Stream;
 using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::_;
 using ::testing::A;
 using ::testing::Return;
 using ::testing::TestWithParam;
@@ -69,6 +78,204 @@ TEST( outputFormatterFormatBinPrintFaultReportingOutputStreamErrorHandling, putE
     EXPECT_TRUE( stream.fatal_error_reported() );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        reserve error.
+ */
+TEST( outputFormatterFormatBinPrintFaultReportingOutputStreamErrorHandling, reserveError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 61 };
+
+    EXPECT_CALL( stream.driver(), reserve( _ ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Bin{ std::uint8_t{ 0b10100110 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        commit error.
+ */
+TEST( outputFormatterFormatBinPrintFaultReportingOutputStreamErrorHandling, commitError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 10, '\0' );
+
+    auto const error = Mock_Error{ 173 };
+
+    EXPECT_CALL( stream.driver(), reserve( 10 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 10 ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( Bin{ std::uint8_t{ 0b10100110 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly when the stream's driver
+ *        supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 10, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 10 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 10 ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    EXPECT_EQ( stream.print( Bin{ std::uint8_t{ 0b10100110 } } ), 10 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0b10100110" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly when the
+ *        stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatBinPrintFaultReportingOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 10, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 10 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 10 ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Bin{ std::uint8_t{ 0b10100110 } } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 10 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0b10100110" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with right alignment.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyRightAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Bin<std::uint8_t, Kernel::COMPACT, 12>{ 0b0110'1001 } ), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "  0b01101001" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with left alignment.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyLeftAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Bin<std::uint8_t, Kernel::LOOKUP_TABLE, 12, '-', Alignment::LEFT>{ 0b0110'1001 } ), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0b01101001--" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Bin<std::uint8_t, Kernel::COMPACT, 12, '0', Alignment::INTERNAL>{ 0b0110'1001 } ), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0b0001101001" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly without the prefix.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyNoPrefix )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Bin<std::uint8_t, Kernel::LOOKUP_TABLE, 0, ' ', Alignment::RIGHT, false>{ 0b1100'0011 } ), 8 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "11000011" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatBinPrintFaultReportingOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::uint8_t, Kernel::COMPACT, 12, '0', Alignment::INTERNAL>{ 0b0110'1001 } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0b0001101001" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) reserves space for the fill characters
+ *        when the stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatBinPrintOutputStream, worksProperlyReservePadded )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 12, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 12 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 12 ) );
+
+    EXPECT_EQ( stream.print( Bin<std::uint8_t, Kernel::COMPACT, 12, '0', Alignment::INTERNAL>{ 0b0110'1001 } ), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0b0001101001" );
+}
+
 /**
  * \brief microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print() test
  *        case.
@@ -141,6 +348,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamI8, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamI8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::int8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamI8, ValuesIn( outputFormatterFormatBinPrintI8_TEST_CASES ) );
 
 /**
@@ -172,6 +399,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI8, worksProperly
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::int8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamI8, ValuesIn( outputFormatterFormatBinPrintI8_TEST_CASES ) );
 
 /**
@@ -220,6 +468,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamU8, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamU8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::uint8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamU8, ValuesIn( outputFormatterFormatBinPrintU8_TEST_CASES ) );
 
 /**
@@ -251,6 +519,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU8, worksProperly
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::uint8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamU8, ValuesIn( outputFormatterFormatBinPrintU8_TEST_CASES ) );
 
 /**
@@ -299,6 +588,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamI16, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamI16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::int16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamI16, ValuesIn( outputFormatterFormatBinPrintI16_TEST_CASES ) );
 
 /**
@@ -330,6 +639,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI16, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::int16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamI16, ValuesIn( outputFormatterFormatBinPrintI16_TEST_CASES ) );
 
 /**
@@ -378,6 +708,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamU16, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamU16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::uint16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamU16, ValuesIn( outputFormatterFormatBinPrintU16_TEST_CASES ) );
 
 /**
@@ -409,21 +759,42 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU16, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
-INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamU16, ValuesIn( outputFormatterFormatBinPrintU16_TEST_CASES ) );
-
 /**
- * \brief microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print()
- *        std::int32_t test cases.
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
  */
-outputFormatterFormatBinPrint_Test_Case<std::int32_t> const outputFormatterFormatBinPrintI32_TEST_CASES[]{
-    // clang-format off
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
 
-    { static_cast<std::int32_t>( 0b00000000000000000000000000000000 ), "0b00000000000000000000000000000000" },
-    { static_cast<std::int32_t>( 0b11111111111111111111111111111111 ), "0b11111111111111111111111111111111" },
+    auto stream = Fault_Reporting_Output_String_Stream{};
 
-    { static_cast<std::int32_t>( 0b01111000000011100010000000011110 ), "0b01111000000011100010000000011110" },
-    { static_cast<std::int32_t>( 0b00101110111011110111101100000000 ), "0b00101110111011110111101100000000" },
-    { static_cast<std::int32_t>( 0b10101011001010001111000101010010 ), "0b10101011001010001111000101010010" },
+    auto const result = stream.print( Bin<std::uint16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
+INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamU16, ValuesIn( outputFormatterFormatBinPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer>>::print()
+ *        std::int32_t test cases.
+ */
+outputFormatterFormatBinPrint_Test_Case<std::int32_t> const outputFormatterFormatBinPrintI32_TEST_CASES[]{
+    // clang-format off
+
+    { static_cast<std::int32_t>( 0b00000000000000000000000000000000 ), "0b00000000000000000000000000000000" },
+    { static_cast<std::int32_t>( 0b11111111111111111111111111111111 ), "0b11111111111111111111111111111111" },
+
+    { static_cast<std::int32_t>( 0b01111000000011100010000000011110 ), "0b01111000000011100010000000011110" },
+    { static_cast<std::int32_t>( 0b00101110111011110111101100000000 ), "0b00101110111011110111101100000000" },
+    { static_cast<std::int32_t>( 0b10101011001010001111000101010010 ), "0b10101011001010001111000101010010" },
     { static_cast<std::int32_t>( 0b11100010000110100110101010011001 ), "0b11100010000110100110101010011001" },
     { static_cast<std::int32_t>( 0b11011001110010011000010111111100 ), "0b11011001110010011000010111111100" },
 
@@ -457,6 +828,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamI32, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamI32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::int32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamI32, ValuesIn( outputFormatterFormatBinPrintI32_TEST_CASES ) );
 
 /**
@@ -488,6 +879,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI32, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::int32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamI32, ValuesIn( outputFormatterFormatBinPrintI32_TEST_CASES ) );
 
 /**
@@ -536,6 +948,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamU32, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamU32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::uint32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamU32, ValuesIn( outputFormatterFormatBinPrintU32_TEST_CASES ) );
 
 /**
@@ -567,6 +999,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU32, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::uint32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamU32, ValuesIn( outputFormatterFormatBinPrintU32_TEST_CASES ) );
 
 /**
@@ -615,6 +1068,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamI64, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamI64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::int64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamI64, ValuesIn( outputFormatterFormatBinPrintI64_TEST_CASES ) );
 
 /**
@@ -646,6 +1119,27 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI64, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamI64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::int64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamI64, ValuesIn( outputFormatterFormatBinPrintI64_TEST_CASES ) );
 
 /**
@@ -694,6 +1188,26 @@ TEST_P( outputFormatterFormatBinPrintOutputStreamU64, worksProperly )
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintOutputStreamU64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Bin<std::uint64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintOutputStreamU64, ValuesIn( outputFormatterFormatBinPrintU64_TEST_CASES ) );
 
 /**
@@ -725,4 +1239,697 @@ TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU64, worksProperl
     EXPECT_EQ( stream.string(), test_case.bin );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Bin<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatBinPrintFaultReportingOutputStreamU64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Bin<std::uint64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.bin );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatBinPrintFaultReportingOutputStreamU64, ValuesIn( outputFormatterFormatBinPrintU64_TEST_CASES ) );
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> & )
+ *        properly handles a get error.
+ */
+TEST( inputFormatterFormatBinScanFaultReportingInputStreamErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 47 };
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( Return( error ) );
+
+    auto       value  = Bin{ std::uint32_t{ 0x7D } };
+    auto const result = stream.scan( value );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), 0x7D );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan() error
+ *        handling test case.
+ */
+struct inputFormatterFormatBinScanErrorHandling_Test_Case {
+    /**
+     * \brief The input that cannot be parsed.
+     */
+    std::string_view input;
+
+    /**
+     * \brief The number of characters consumed before the error is detected.
+     */
+    std::size_t n;
+};
+
+auto operator<<( std::ostream & stream, inputFormatterFormatBinScanErrorHandling_Test_Case const & test_case )
+    -> std::ostream &
+{
+    return stream << test_case.input;
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan()
+ *        std::uint8_t error handling test cases.
+ */
+inputFormatterFormatBinScanErrorHandling_Test_Case const inputFormatterFormatBinScanErrorHandling_TEST_CASES[]{
+    // clang-format off
+
+    { "",            0 },
+    { "0b",          2 },
+    { "2",           0 },
+    { "0b100000000", 10 },
+
+    // clang-format on
+};
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) error handling
+ *        test fixture.
+ */
+class inputFormatterFormatBinScanInputStreamErrorHandling :
+    public TestWithParam<inputFormatterFormatBinScanErrorHandling_Test_Case> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) properly
+ *        handles input that is not a valid std::uint8_t.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamErrorHandling, invalidInput )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.input } };
+
+    auto value = Bin{ std::uint8_t{ 0x5A } };
+
+    EXPECT_EQ( stream.scan( value ), test_case.n );
+
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), 0x5A );
+
+    EXPECT_TRUE( stream.io_error_reported() );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamErrorHandling, ValuesIn( inputFormatterFormatBinScanErrorHandling_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::int8_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamI8 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::int8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamI8, ValuesIn( outputFormatterFormatBinPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::int8_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamI8 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::int8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamI8, ValuesIn( outputFormatterFormatBinPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::uint8_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamU8 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::uint8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamU8, ValuesIn( outputFormatterFormatBinPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::uint8_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamU8 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::uint8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamU8, ValuesIn( outputFormatterFormatBinPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::int16_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamI16 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::int16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamI16, ValuesIn( outputFormatterFormatBinPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::int16_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamI16 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::int16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamI16, ValuesIn( outputFormatterFormatBinPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::uint16_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamU16 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::uint16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamU16, ValuesIn( outputFormatterFormatBinPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::uint16_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamU16 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::uint16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamU16, ValuesIn( outputFormatterFormatBinPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::int32_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamI32 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::int32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamI32, ValuesIn( outputFormatterFormatBinPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::int32_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamI32 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::int32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamI32, ValuesIn( outputFormatterFormatBinPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::uint32_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamU32 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::uint32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamU32, ValuesIn( outputFormatterFormatBinPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::uint32_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamU32 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::uint32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamU32, ValuesIn( outputFormatterFormatBinPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::int64_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamI64 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::int64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamI64, ValuesIn( outputFormatterFormatBinPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::int64_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamI64 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::int64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamI64, ValuesIn( outputFormatterFormatBinPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) std::uint64_t test
+ *        fixture.
+ */
+class inputFormatterFormatBinScanInputStreamU64 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Bin<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatBinScanInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.bin } + ',' };
+
+    auto value = Bin{ std::uint64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanInputStreamU64, ValuesIn( outputFormatterFormatBinPrintU64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) std::uint64_t test fixture.
+ */
+class inputFormatterFormatBinScanFaultReportingInputStreamU64 :
+    public TestWithParam<outputFormatterFormatBinPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Bin<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Bin<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatBinScanFaultReportingInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.bin } };
+
+    auto value = Bin{ std::uint64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.bin.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatBinScanFaultReportingInputStreamU64, ValuesIn( outputFormatterFormatBinPrintU64_TEST_CASES ) );
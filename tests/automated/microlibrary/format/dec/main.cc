@@ -20,6 +20,7 @@
  * \brief microlibrary::Format::Dec automated tests.
  */
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <ostream>
@@ -34,11 +35,19 @@
 
 namespace {
 
+using ::microlibrary::Result;
+using ::microlibrary::Format::Alignment;
 using ::microlibrary::Format::Dec;
+using ::microlibrary::Format::Sign;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Input_String_Stream;
 using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Input_String_Stream;
 using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Input_Stream;
 using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Mock_Output_Stream;
 using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::_;
 using ::testing::A;
 using ::testing::Return;
 using ::testing::TestWithParam;
@@ -70,6 +79,234 @@ TEST( outputFormatterFormatDecPrintFaultReportingOutputStreamErrorHandling, putE
     EXPECT_TRUE( stream.fatal_error_reported() );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        reserve error.
+ */
+TEST( outputFormatterFormatDecPrintFaultReportingOutputStreamErrorHandling, reserveError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 149 };
+
+    EXPECT_CALL( stream.driver(), reserve( _ ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Dec{ std::int16_t{ -3078 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        commit error.
+ */
+TEST( outputFormatterFormatDecPrintFaultReportingOutputStreamErrorHandling, commitError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 5, '\0' );
+
+    auto const error = Mock_Error{ 207 };
+
+    EXPECT_CALL( stream.driver(), reserve( 5 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 5 ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( Dec{ std::int16_t{ -3078 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly when the stream's driver
+ *        supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 5, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 5 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 5 ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    EXPECT_EQ( stream.print( Dec{ std::int16_t{ -3078 } } ), 5 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "-3078" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly when the
+ *        stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatDecPrintFaultReportingOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 5, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 5 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 5 ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Dec{ std::int16_t{ -3078 } } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 5 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "-3078" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with right alignment.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyRightAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::int16_t, 6>{ -42 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "   -42" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with left alignment.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyLeftAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::int16_t, 6, '*', Alignment::LEFT>{ -42 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-42***" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::int16_t, 6, '0', Alignment::INTERNAL>{ -42 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-00042" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly when the formatted integer is wider than the field.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyWidthExceeded )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::int16_t, 2>{ -12345 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-12345" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with the sign always included.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlySignAlways )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::uint8_t, 4, '0', Alignment::INTERNAL, Sign::ALWAYS>{ 7 } ), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "+007" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with a space used as the sign of non-negative integers.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlySignSpace )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Dec<std::int32_t, 0, ' ', Alignment::RIGHT, Sign::SPACE>{ 123 } ), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), " 123" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatDecPrintFaultReportingOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Dec<std::int16_t, 6, '0', Alignment::INTERNAL>{ -42 } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-00042" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) reserves space for the fill characters
+ *        when the stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyReservePadded )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 6, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 6 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 6 ) );
+
+    EXPECT_EQ( stream.print( Dec<std::int16_t, 6, '0', Alignment::INTERNAL>{ -42 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "-00042" );
+}
+
 /**
  * \brief microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print() test
  *        case.
@@ -739,3 +976,722 @@ TEST_P( outputFormatterFormatDecPrintFaultReportingOutputStreamU64, worksProperl
 }
 
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatDecPrintFaultReportingOutputStreamU64, ValuesIn( outputFormatterFormatDecPrintU64_TEST_CASES ) );
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Dec<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly for every std::int8_t,
+ *        std::uint8_t, std::int16_t, and std::uint16_t value.
+ */
+TEST( outputFormatterFormatDecPrintOutputStream, worksProperlyExhaustive )
+{
+    for ( auto value = std::int_fast32_t{ std::numeric_limits<std::int16_t>::min() };
+          value <= std::numeric_limits<std::uint16_t>::max();
+          ++value ) {
+        if ( value >= std::numeric_limits<std::int8_t>::min()
+             and value <= std::numeric_limits<std::int8_t>::max() ) {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Dec{ static_cast<std::int8_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), std::to_string( value ) );
+        } // if
+
+        if ( value >= 0 and value <= std::numeric_limits<std::uint8_t>::max() ) {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Dec{ static_cast<std::uint8_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), std::to_string( value ) );
+        } // if
+
+        if ( value <= std::numeric_limits<std::int16_t>::max() ) {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Dec{ static_cast<std::int16_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), std::to_string( value ) );
+        } // if
+
+        if ( value >= 0 ) {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Dec{ static_cast<std::uint16_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), std::to_string( value ) );
+        } // if
+    } // for
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> & )
+ *        properly handles a get error.
+ */
+TEST( inputFormatterFormatDecScanFaultReportingInputStreamErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 47 };
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( Return( error ) );
+
+    auto       value  = Dec{ std::uint32_t{ 0x7D } };
+    auto const result = stream.scan( value );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), 0x7D );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan() error
+ *        handling test case.
+ */
+struct inputFormatterFormatDecScanErrorHandling_Test_Case {
+    /**
+     * \brief The input that cannot be parsed.
+     */
+    std::string_view input;
+
+    /**
+     * \brief The number of characters consumed before the error is detected.
+     */
+    std::size_t n;
+};
+
+auto operator<<( std::ostream & stream, inputFormatterFormatDecScanErrorHandling_Test_Case const & test_case )
+    -> std::ostream &
+{
+    return stream << test_case.input;
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan()
+ *        std::uint8_t error handling test cases.
+ */
+inputFormatterFormatDecScanErrorHandling_Test_Case const inputFormatterFormatDecScanErrorHandling_TEST_CASES[]{
+    // clang-format off
+
+    { "",     0 },
+    { "-",    0 },
+    { "x",    0 },
+    { "256",  2 },
+    { "1000", 3 },
+
+    // clang-format on
+};
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) error handling
+ *        test fixture.
+ */
+class inputFormatterFormatDecScanInputStreamErrorHandling :
+    public TestWithParam<inputFormatterFormatDecScanErrorHandling_Test_Case> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) properly
+ *        handles input that is not a valid std::uint8_t.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamErrorHandling, invalidInput )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.input } };
+
+    auto value = Dec{ std::uint8_t{ 0x5A } };
+
+    EXPECT_EQ( stream.scan( value ), test_case.n );
+
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), 0x5A );
+
+    EXPECT_TRUE( stream.io_error_reported() );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamErrorHandling, ValuesIn( inputFormatterFormatDecScanErrorHandling_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::int8_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamI8 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::int8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamI8, ValuesIn( outputFormatterFormatDecPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::int8_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamI8 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::int8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamI8, ValuesIn( outputFormatterFormatDecPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::uint8_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamU8 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::uint8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamU8, ValuesIn( outputFormatterFormatDecPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::uint8_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamU8 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::uint8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamU8, ValuesIn( outputFormatterFormatDecPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::int16_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamI16 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::int16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamI16, ValuesIn( outputFormatterFormatDecPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::int16_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamI16 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::int16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamI16, ValuesIn( outputFormatterFormatDecPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::uint16_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamU16 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::uint16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamU16, ValuesIn( outputFormatterFormatDecPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::uint16_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamU16 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::uint16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamU16, ValuesIn( outputFormatterFormatDecPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::int32_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamI32 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::int32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamI32, ValuesIn( outputFormatterFormatDecPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::int32_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamI32 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::int32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamI32, ValuesIn( outputFormatterFormatDecPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::uint32_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamU32 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::uint32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamU32, ValuesIn( outputFormatterFormatDecPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::uint32_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamU32 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::uint32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamU32, ValuesIn( outputFormatterFormatDecPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::int64_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamI64 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::int64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamI64, ValuesIn( outputFormatterFormatDecPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::int64_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamI64 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::int64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamI64, ValuesIn( outputFormatterFormatDecPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) std::uint64_t test
+ *        fixture.
+ */
+class inputFormatterFormatDecScanInputStreamU64 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Dec<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatDecScanInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.dec } + ',' };
+
+    auto value = Dec{ std::uint64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanInputStreamU64, ValuesIn( outputFormatterFormatDecPrintU64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) std::uint64_t test fixture.
+ */
+class inputFormatterFormatDecScanFaultReportingInputStreamU64 :
+    public TestWithParam<outputFormatterFormatDecPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Dec<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Dec<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatDecScanFaultReportingInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.dec } };
+
+    auto value = Dec{ std::uint64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.dec.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatDecScanFaultReportingInputStreamU64, ValuesIn( outputFormatterFormatDecPrintU64_TEST_CASES ) );
@@ -0,0 +1,244 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Format::Fixed automated tests.
+ */
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/format.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Format::Fixed;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::A;
+using ::testing::Return;
+
+/**
+ * \brief Format a fixed-point value using std::to_chars().
+ *
+ * \param[in] integer The fixed-point value.
+ * \param[in] fraction_bits The number of fraction bits in the fixed-point value.
+ * \param[in] precision The number of fraction digits to format.
+ *
+ * \return The formatted fixed-point value.
+ */
+auto to_chars( std::int_fast64_t integer, int fraction_bits, int precision ) -> std::string
+{
+    auto buffer = std::array<char, 64>{};
+
+    auto const result = std::to_chars(
+        buffer.data(),
+        buffer.data() + buffer.size(),
+        static_cast<double>( integer ) / static_cast<double>( std::uint_fast64_t{ 1 } << fraction_bits ),
+        std::chars_format::fixed,
+        precision );
+
+    return std::string{ buffer.data(), result.ptr };
+}
+
+} // namespace
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a put
+ *        error.
+ */
+TEST( outputFormatterFormatFixedPrintFaultReportingOutputStreamErrorHandling, putError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 24 };
+
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( Fixed<std::int16_t, 8>{ 0x0180 } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly.
+ */
+TEST( outputFormatterFormatFixedPrintOutputStream, worksProperly )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Fixed<std::int16_t, 8>{ -0x0180 } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-1.500" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly.
+ */
+TEST( outputFormatterFormatFixedPrintFaultReportingOutputStream, worksProperly )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Fixed<std::uint16_t, 4, 2>{ 0x3A7 } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 5 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "58.44" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Output_Stream &, Integer ) rounds to nearest, ties to even.
+ */
+TEST( outputFormatterFormatFixedPrintOutputStream, worksProperlyRounding )
+{
+    {
+        auto stream = Output_String_Stream{};
+
+        stream.print( Fixed<std::int8_t, 1, 0>{ 5 } );
+
+        EXPECT_EQ( stream.string(), "2" );
+    }
+
+    {
+        auto stream = Output_String_Stream{};
+
+        stream.print( Fixed<std::int8_t, 1, 0>{ 7 } );
+
+        EXPECT_EQ( stream.string(), "4" );
+    }
+
+    {
+        auto stream = Output_String_Stream{};
+
+        stream.print( Fixed<std::uint16_t, 8, 2>{ 0xFFFF } );
+
+        EXPECT_EQ( stream.string(), "256.00" );
+    }
+
+    {
+        auto stream = Output_String_Stream{};
+
+        stream.print( Fixed<std::uint8_t, 8, 1>{ 0xFF } );
+
+        EXPECT_EQ( stream.string(), "1.0" );
+    }
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Output_Stream &, Integer ) produces the same output as
+ *        std::to_chars() for every std::int16_t Q8.8 value and every std::uint8_t Q0.8
+ *        value.
+ */
+TEST( outputFormatterFormatFixedPrintOutputStream, worksProperlyExhaustive )
+{
+    for ( auto value = std::int_fast32_t{ std::numeric_limits<std::int16_t>::min() };
+          value <= std::numeric_limits<std::int16_t>::max();
+          ++value ) {
+        {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::int16_t, 8>{ static_cast<std::int16_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), to_chars( value, 8, 3 ) );
+        }
+
+        {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::int16_t, 8, 0>{ static_cast<std::int16_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), to_chars( value, 8, 0 ) );
+        }
+
+        {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::int16_t, 8, 1>{ static_cast<std::int16_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), to_chars( value, 8, 1 ) );
+        }
+
+        if ( value >= 0 and value <= std::numeric_limits<std::uint8_t>::max() ) {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::uint8_t, 8, 2>{ static_cast<std::uint8_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), to_chars( value, 8, 2 ) );
+        } // if
+    }     // for
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Fixed<Integer, FRACTION_BITS, PRECISION>>::print(
+ *        microlibrary::Output_Stream &, Integer ) produces the same output as
+ *        std::to_chars() for std::int32_t Q15.16 values and std::int64_t Q11.52
+ *        values.
+ */
+TEST( outputFormatterFormatFixedPrintOutputStream, worksProperlyWide )
+{
+    for ( auto value = std::int_fast64_t{ std::numeric_limits<std::int32_t>::min() };
+          value <= std::numeric_limits<std::int32_t>::max();
+          value += 0x0001'2345 ) {
+        {
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::int32_t, 16>{ static_cast<std::int32_t>( value ) } );
+
+            ASSERT_EQ( stream.string(), to_chars( value, 16, 5 ) );
+        }
+
+        {
+            auto const integer = value * 0x0012'3457;
+
+            auto stream = Output_String_Stream{};
+
+            stream.print( Fixed<std::int64_t, 52, 12>{ integer } );
+
+            ASSERT_EQ( stream.string(), to_chars( integer, 52, 12 ) );
+        }
+    } // for
+}
@@ -0,0 +1,231 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Format::Float automated tests.
+ */
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/format.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Format::Float;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::A;
+using ::testing::Return;
+
+/**
+ * \brief Format a floating-point value using std::to_chars().
+ *
+ * \tparam Floating_Point The type of floating-point value to format.
+ *
+ * \param[in] value The floating-point value to format.
+ * \param[in] precision The number of fraction digits to format.
+ *
+ * \return The formatted floating-point value.
+ */
+template<typename Floating_Point>
+auto to_chars( Floating_Point value, int precision ) -> std::string
+{
+    auto buffer = std::array<char, 512>{};
+
+    auto const result = std::to_chars(
+        buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::fixed, precision );
+
+    return std::string{ buffer.data(), result.ptr };
+}
+
+/**
+ * \brief Verify that microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>> produces the same output as std::to_chars().
+ *
+ * \tparam PRECISION The number of fraction digits to format.
+ * \tparam Floating_Point The type of floating-point value to format.
+ *
+ * \param[in] value The floating-point value to format.
+ */
+template<std::uint_fast8_t PRECISION, typename Floating_Point>
+void expect_to_chars_equivalence( Floating_Point value )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Float<Floating_Point, PRECISION>{ value } );
+
+    EXPECT_EQ( n, stream.string().size() );
+    EXPECT_EQ( stream.string(), to_chars( value, PRECISION ) );
+}
+
+/**
+ * \brief Verify that microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>> produces the same output as std::to_chars() for a set of precisions.
+ *
+ * \tparam Floating_Point The type of floating-point value to format.
+ *
+ * \param[in] value The floating-point value to format.
+ */
+template<typename Floating_Point>
+void expect_to_chars_equivalence( Floating_Point value )
+{
+    expect_to_chars_equivalence<0>( value );
+    expect_to_chars_equivalence<1>( value );
+    expect_to_chars_equivalence<6>( value );
+    expect_to_chars_equivalence<17>( value );
+}
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Floating_Point ) properly handles a put error.
+ */
+TEST( outputFormatterFormatFloatPrintFaultReportingOutputStreamErrorHandling, putError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 139 };
+
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( Float{ 2.75 } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>>::print( microlibrary::Output_Stream &, Floating_Point ) works
+ *        properly.
+ */
+TEST( outputFormatterFormatFloatPrintOutputStream, worksProperly )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Float<float, 3>{ -12.3456F } ), 7 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "-12.346" );
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Floating_Point ) works properly.
+ */
+TEST( outputFormatterFormatFloatPrintFaultReportingOutputStream, worksProperly )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Float{ 2.75 } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 8 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "2.750000" );
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<Floating_Point,
+ *        PRECISION>>::print( microlibrary::Output_Stream &, Floating_Point ) properly
+ *        handles special values.
+ */
+TEST( outputFormatterFormatFloatPrintOutputStream, worksProperlySpecialValues )
+{
+    for ( auto const value : {
+              std::numeric_limits<double>::infinity(),
+              -std::numeric_limits<double>::infinity(),
+              std::numeric_limits<double>::quiet_NaN(),
+              -std::numeric_limits<double>::quiet_NaN(),
+              0.0,
+              -0.0,
+              std::numeric_limits<double>::max(),
+              std::numeric_limits<double>::lowest(),
+              std::numeric_limits<double>::min(),
+              std::numeric_limits<double>::denorm_min(),
+              0.5,
+              1.5,
+              2.5,
+              0.125,
+              9.5,
+              99.96,
+          } ) {
+        expect_to_chars_equivalence( value );
+        expect_to_chars_equivalence( static_cast<float>( value ) );
+    } // for
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<float,
+ *        PRECISION>>::print( microlibrary::Output_Stream &, float ) produces the same
+ *        output as std::to_chars().
+ */
+TEST( outputFormatterFormatFloatPrintOutputStream, worksProperlyFloat )
+{
+    for ( auto bits = std::uint_fast64_t{ 0 }; bits <= std::numeric_limits<std::uint32_t>::max();
+          bits += 0x0003'3F1D ) {
+        auto const representation = static_cast<std::uint32_t>( bits );
+
+        float value;
+        std::memcpy( &value, &representation, sizeof( value ) );
+
+        expect_to_chars_equivalence( value );
+    } // for
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Float<double,
+ *        PRECISION>>::print( microlibrary::Output_Stream &, double ) produces the same
+ *        output as std::to_chars().
+ */
+TEST( outputFormatterFormatFloatPrintOutputStream, worksProperlyDouble )
+{
+    auto bits = std::uint64_t{ 0x0123'4567'89AB'CDEF };
+
+    for ( auto i = 0; i < 20'000; ++i ) {
+        // xorshift64
+        bits ^= bits << 13;
+        bits ^= bits >> 7;
+        bits ^= bits << 17;
+
+        double value;
+        std::memcpy( &value, &bits, sizeof( value ) );
+
+        expect_to_chars_equivalence( value );
+    } // for
+}
@@ -20,6 +20,7 @@
  * \brief microlibrary::Format::Hex automated tests.
  */
 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 #include <string>
@@ -33,11 +34,19 @@
 
 namespace {
 
+using ::microlibrary::Result;
+using ::microlibrary::Format::Alignment;
 using ::microlibrary::Format::Hex;
+using ::microlibrary::Format::Kernel;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Input_String_Stream;
 using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Input_String_Stream;
 using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Input_Stream;
 using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Mock_Output_Stream;
 using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::_;
 using ::testing::A;
 using ::testing::Return;
 using ::testing::TestWithParam;
@@ -69,6 +78,219 @@ TEST( outputFormatterFormatHexPrintFaultReportingOutputStreamErrorHandling, putE
     EXPECT_TRUE( stream.fatal_error_reported() );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        reserve error.
+ */
+TEST( outputFormatterFormatHexPrintFaultReportingOutputStreamErrorHandling, reserveError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 92 };
+
+    EXPECT_CALL( stream.driver(), reserve( _ ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Hex{ std::uint16_t{ 0x3FA2 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) properly handles a
+ *        commit error.
+ */
+TEST( outputFormatterFormatHexPrintFaultReportingOutputStreamErrorHandling, commitError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 6, '\0' );
+
+    auto const error = Mock_Error{ 14 };
+
+    EXPECT_CALL( stream.driver(), reserve( 6 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 6 ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( Hex{ std::uint16_t{ 0x3FA2 } } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly when the stream's driver
+ *        supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 6, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 6 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 6 ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    EXPECT_EQ( stream.print( Hex{ std::uint16_t{ 0x3FA2 } } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0x3FA2" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly when the
+ *        stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatHexPrintFaultReportingOutputStream, worksProperlyReserve )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto buffer = std::string( 6, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 6 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 6 ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    auto const result = stream.print( Hex{ std::uint16_t{ 0x3FA2 } } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0x3FA2" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with right alignment.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyRightAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Hex<std::uint8_t, Kernel::COMPACT, 6>{ 0x3C } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "  0x3C" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with left alignment.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyLeftAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Hex<std::uint8_t, Kernel::COMPACT, 6, '.', Alignment::LEFT>{ 0x3C } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0x3C.." );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE, 6, '0', Alignment::INTERNAL>{ 0x3C } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0x003C" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly without the prefix.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyNoPrefix )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Hex<std::uint16_t, Kernel::COMPACT, 0, ' ', Alignment::RIGHT, false>{ 0xB07E } ), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "B07E" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) works properly without the prefix with padding.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyNoPrefixPadded )
+{
+    auto stream = Output_String_Stream{};
+
+    EXPECT_EQ( stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE, 4, ' ', Alignment::RIGHT, false>{ 0x5A } ), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "  5A" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Integer ) works properly with internal alignment.
+ */
+TEST( outputFormatterFormatHexPrintFaultReportingOutputStream, worksProperlyInternalAlignment )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE, 6, '0', Alignment::INTERNAL>{ 0x3C } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "0x003C" );
+}
+
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print(
+ *        microlibrary::Output_Stream &, Integer ) reserves space for the fill characters
+ *        when the stream's driver supports writing directly to its write buffer.
+ */
+TEST( outputFormatterFormatHexPrintOutputStream, worksProperlyReservePadded )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto buffer = std::string( 6, '\0' );
+
+    EXPECT_CALL( stream.driver(), reserve( 6 ) ).WillOnce( Return( buffer.data() ) );
+    EXPECT_CALL( stream.driver(), commit( 6 ) );
+
+    EXPECT_EQ( stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE, 6, '0', Alignment::INTERNAL>{ 0x3C } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( buffer, "0x003C" );
+}
+
 /**
  * \brief microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print() test
  *        case.
@@ -141,6 +363,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamI8, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamI8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::int8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamI8, ValuesIn( outputFormatterFormatHexPrintI8_TEST_CASES ) );
 
 /**
@@ -172,6 +414,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI8, worksProperly
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::int8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamI8, ValuesIn( outputFormatterFormatHexPrintI8_TEST_CASES ) );
 
 /**
@@ -220,6 +483,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamU8, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamU8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamU8, ValuesIn( outputFormatterFormatHexPrintU8_TEST_CASES ) );
 
 /**
@@ -251,6 +534,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU8, worksProperly
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU8, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::uint8_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamU8, ValuesIn( outputFormatterFormatHexPrintU8_TEST_CASES ) );
 
 /**
@@ -299,6 +603,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamI16, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamI16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::int16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamI16, ValuesIn( outputFormatterFormatHexPrintI16_TEST_CASES ) );
 
 /**
@@ -330,6 +654,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI16, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::int16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamI16, ValuesIn( outputFormatterFormatHexPrintI16_TEST_CASES ) );
 
 /**
@@ -378,6 +723,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamU16, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamU16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::uint16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamU16, ValuesIn( outputFormatterFormatHexPrintU16_TEST_CASES ) );
 
 /**
@@ -409,11 +774,32 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU16, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
-INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamU16, ValuesIn( outputFormatterFormatHexPrintU16_TEST_CASES ) );
-
 /**
- * \brief microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print()
- *        std::int32_t test cases.
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU16, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::uint16_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
+INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamU16, ValuesIn( outputFormatterFormatHexPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer>>::print()
+ *        std::int32_t test cases.
  */
 outputFormatterFormatHexPrint_Test_Case<std::int32_t> const outputFormatterFormatHexPrintI32_TEST_CASES[]{
     // clang-format off
@@ -457,6 +843,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamI32, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamI32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::int32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamI32, ValuesIn( outputFormatterFormatHexPrintI32_TEST_CASES ) );
 
 /**
@@ -488,6 +894,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI32, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::int32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamI32, ValuesIn( outputFormatterFormatHexPrintI32_TEST_CASES ) );
 
 /**
@@ -536,6 +963,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamU32, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamU32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::uint32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamU32, ValuesIn( outputFormatterFormatHexPrintU32_TEST_CASES ) );
 
 /**
@@ -567,6 +1014,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU32, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU32, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::uint32_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamU32, ValuesIn( outputFormatterFormatHexPrintU32_TEST_CASES ) );
 
 /**
@@ -615,6 +1083,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamI64, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamI64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::int64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamI64, ValuesIn( outputFormatterFormatHexPrintI64_TEST_CASES ) );
 
 /**
@@ -646,6 +1134,27 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI64, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamI64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::int64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamI64, ValuesIn( outputFormatterFormatHexPrintI64_TEST_CASES ) );
 
 /**
@@ -694,6 +1203,26 @@ TEST_P( outputFormatterFormatHexPrintOutputStreamU64, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintOutputStreamU64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( Hex<std::uint64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintOutputStreamU64, ValuesIn( outputFormatterFormatHexPrintU64_TEST_CASES ) );
 
 /**
@@ -725,4 +1254,697 @@ TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU64, worksProperl
     EXPECT_EQ( stream.string(), test_case.hex );
 }
 
+/**
+ * \brief Verify
+ *        microlibrary::Output_Formatter<microlibrary::Format::Hex<Integer,
+ *        microlibrary::Format::Kernel::LOOKUP_TABLE>>::print( microlibrary::Fault_Reporting_Output_Stream &,
+ *        Integer ) works properly.
+ */
+TEST_P( outputFormatterFormatHexPrintFaultReportingOutputStreamU64, worksProperlyLookupTable )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print( Hex<std::uint64_t, Kernel::LOOKUP_TABLE>{ test_case.integer } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex );
+}
+
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexPrintFaultReportingOutputStreamU64, ValuesIn( outputFormatterFormatHexPrintU64_TEST_CASES ) );
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> & )
+ *        properly handles a get error.
+ */
+TEST( inputFormatterFormatHexScanFaultReportingInputStreamErrorHandling, getError )
+{
+    auto stream = Mock_Fault_Reporting_Input_Stream{};
+
+    auto const error = Mock_Error{ 47 };
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( Return( error ) );
+
+    auto       value  = Hex{ std::uint32_t{ 0x7D } };
+    auto const result = stream.scan( value );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), 0x7D );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan() error
+ *        handling test case.
+ */
+struct inputFormatterFormatHexScanErrorHandling_Test_Case {
+    /**
+     * \brief The input that cannot be parsed.
+     */
+    std::string_view input;
+
+    /**
+     * \brief The number of characters consumed before the error is detected.
+     */
+    std::size_t n;
+};
+
+auto operator<<( std::ostream & stream, inputFormatterFormatHexScanErrorHandling_Test_Case const & test_case )
+    -> std::ostream &
+{
+    return stream << test_case.input;
+}
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan()
+ *        std::uint8_t error handling test cases.
+ */
+inputFormatterFormatHexScanErrorHandling_Test_Case const inputFormatterFormatHexScanErrorHandling_TEST_CASES[]{
+    // clang-format off
+
+    { "",      0 },
+    { "0x",    2 },
+    { "g",     0 },
+    { "0x100", 4 },
+
+    // clang-format on
+};
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) error handling
+ *        test fixture.
+ */
+class inputFormatterFormatHexScanInputStreamErrorHandling :
+    public TestWithParam<inputFormatterFormatHexScanErrorHandling_Test_Case> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) properly
+ *        handles input that is not a valid std::uint8_t.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamErrorHandling, invalidInput )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.input } };
+
+    auto value = Hex{ std::uint8_t{ 0x5A } };
+
+    EXPECT_EQ( stream.scan( value ), test_case.n );
+
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), 0x5A );
+
+    EXPECT_TRUE( stream.io_error_reported() );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamErrorHandling, ValuesIn( inputFormatterFormatHexScanErrorHandling_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::int8_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamI8 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::int8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamI8, ValuesIn( outputFormatterFormatHexPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::int8_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamI8 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamI8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::int8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamI8, ValuesIn( outputFormatterFormatHexPrintI8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::uint8_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamU8 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::uint8_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamU8, ValuesIn( outputFormatterFormatHexPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::uint8_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamU8 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamU8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::uint8_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint8_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamU8, ValuesIn( outputFormatterFormatHexPrintU8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::int16_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamI16 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::int16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamI16, ValuesIn( outputFormatterFormatHexPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::int16_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamI16 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamI16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::int16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamI16, ValuesIn( outputFormatterFormatHexPrintI16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::uint16_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamU16 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::uint16_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamU16, ValuesIn( outputFormatterFormatHexPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::uint16_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamU16 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamU16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::uint16_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint16_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamU16, ValuesIn( outputFormatterFormatHexPrintU16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::int32_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamI32 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::int32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamI32, ValuesIn( outputFormatterFormatHexPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::int32_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamI32 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamI32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::int32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamI32, ValuesIn( outputFormatterFormatHexPrintI32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::uint32_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamU32 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::uint32_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamU32, ValuesIn( outputFormatterFormatHexPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::uint32_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamU32 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamU32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::uint32_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint32_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamU32, ValuesIn( outputFormatterFormatHexPrintU32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::int64_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamI64 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::int64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamI64, ValuesIn( outputFormatterFormatHexPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::int64_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamI64 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::int64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamI64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::int64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::int64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamI64, ValuesIn( outputFormatterFormatHexPrintI64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) std::uint64_t test
+ *        fixture.
+ */
+class inputFormatterFormatHexScanInputStreamU64 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Input_Stream &, microlibrary::Format::Hex<Integer> & ) works
+ *        properly.
+ */
+TEST_P( inputFormatterFormatHexScanInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Input_String_Stream{ std::string{ test_case.hex } + ',' };
+
+    auto value = Hex{ std::uint64_t{} };
+
+    EXPECT_EQ( stream.scan( value ), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+
+    auto delimiter = char{};
+    stream.get( delimiter );
+
+    EXPECT_EQ( delimiter, ',' );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanInputStreamU64, ValuesIn( outputFormatterFormatHexPrintU64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) std::uint64_t test fixture.
+ */
+class inputFormatterFormatHexScanFaultReportingInputStreamU64 :
+    public TestWithParam<outputFormatterFormatHexPrint_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify
+ *        microlibrary::Input_Formatter<microlibrary::Format::Hex<Integer>>::scan(
+ *        microlibrary::Fault_Reporting_Input_Stream &, microlibrary::Format::Hex<Integer> &
+ *        ) works properly.
+ */
+TEST_P( inputFormatterFormatHexScanFaultReportingInputStreamU64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Fault_Reporting_Input_String_Stream{ std::string{ test_case.hex } };
+
+    auto value = Hex{ std::uint64_t{} };
+
+    auto const result = stream.scan( value );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), test_case.hex.size() );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_FALSE( stream.fatal_error_reported() );
+    EXPECT_EQ( static_cast<std::uint64_t>( value ), test_case.integer );
+}
+
+INSTANTIATE_TEST_SUITE_P(, inputFormatterFormatHexScanFaultReportingInputStreamU64, ValuesIn( outputFormatterFormatHexPrintU64_TEST_CASES ) );
@@ -46,6 +46,8 @@ using ::testing::Return;
 using ::testing::TestWithParam;
 using ::testing::ValuesIn;
 
+using Data_Iterator = std::string_view::const_iterator;
+
 } // namespace
 
 /**
@@ -485,3 +487,79 @@ TEST_P( outputFormatterFormatHexDumpPrintFaultReportingOutputStream64, worksProp
 }
 
 INSTANTIATE_TEST_SUITE_P(, outputFormatterFormatHexDumpPrintFaultReportingOutputStream64, ValuesIn( outputFormatterFormatHexDumpPrint64_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Hex_Dump<Address,
+ *        Iterator, ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES>>::print(
+ *        microlibrary::Output_Stream &, microlibrary::Format::Hex_Dump<Address, Iterator,
+ *        ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES> const & ) properly handles
+ *        byte grouping.
+ */
+TEST( outputFormatterFormatHexDumpPrintOutputStream, grouping )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const data = std::string_view{ "{yZZk7V!/{>fm[lxV!$e|:" };
+
+    auto const n = stream.print(
+        Hex_Dump<std::uint16_t, Data_Iterator, 16, 8>{ 0x95A1, data.begin(), data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ(
+        stream.string(),
+        "95A1  7B 79 5A 5A 6B 37 56 21  2F 7B 3E 66 6D 5B 6C 78  |{yZZk7V!/{>fm[lx|\n"
+        "95B1  56 21 24 65 7C 3A                                 |V!$e|:|          \n" );
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Hex_Dump<Address,
+ *        Iterator, ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES>>::print(
+ *        microlibrary::Output_Stream &, microlibrary::Format::Hex_Dump<Address, Iterator,
+ *        ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES> const & ) properly handles
+ *        omitting the ASCII column and overriding the address width.
+ */
+TEST( outputFormatterFormatHexDumpPrintOutputStream, noASCIIColumnAddressWidth )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const data = std::string_view{ "(Y !d5vz\t^2" };
+
+    auto const n = stream.print( Hex_Dump<std::uint32_t, Data_Iterator, 8, 4, false, 6>{
+        0x1F12FFFC, data.begin(), data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ(
+        stream.string(),
+        "12FFFC  28 59 20 21  64 35 76 7A\n"
+        "130004  09 5E 32\n" );
+}
+
+/**
+ * \brief Verify microlibrary::Output_Formatter<microlibrary::Format::Hex_Dump<Address,
+ *        Iterator, ROW_BYTES, GROUP_BYTES, ASCII_COLUMN, ADDRESS_NIBBLES>>::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &,
+ *        microlibrary::Format::Hex_Dump<Address, Iterator, ROW_BYTES, GROUP_BYTES,
+ *        ASCII_COLUMN, ADDRESS_NIBBLES> const & ) properly handles omitting the address.
+ */
+TEST( outputFormatterFormatHexDumpPrintFaultReportingOutputStream, noAddress )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const data = std::string_view{ "V!$e|:" };
+
+    auto const result = stream.print(
+        Hex_Dump<std::uint16_t, Data_Iterator, 4, 4, true, 0>{ 0x95B1, data.begin(), data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ(
+        stream.string(),
+        "56 21 24 65  |V!$e|\n"
+        "7C 3A        ||:|  \n" );
+}
@@ -0,0 +1,220 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Format::String automated tests.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/format.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Output_String_Stream;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Mock_Output_Stream;
+using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::testing::A;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) works properly when the format string has no replacement fields.
+ */
+TEST( stringPrintOutputStream, worksProperlyLiteralOnly )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( MICROLIBRARY_FORMAT( "vT1Nw2ZQ" ) );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "vT1Nw2ZQ" );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) works properly when the format string is empty.
+ */
+TEST( stringPrintOutputStream, worksProperlyEmpty )
+{
+    auto stream = Mock_Output_Stream{};
+
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).Times( 0 );
+
+    EXPECT_EQ( stream.print( MICROLIBRARY_FORMAT( "" ) ), 0 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) works properly with replacement fields.
+ */
+TEST( stringPrintOutputStream, worksProperlyReplacementFields )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print(
+        MICROLIBRARY_FORMAT( "x={} y={:x} z={:b} w={:d} s={}{}!" ),
+        std::int16_t{ -1234 },
+        std::uint8_t{ 0x3C },
+        std::uint8_t{ 0b1010'0101 },
+        std::uint32_t{ 4000000000 },
+        "Nb9",
+        'q' );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "x=-1234 y=0x3C z=0b10100101 w=4000000000 s=Nb9q!" );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) works properly with escaped braces.
+ */
+TEST( stringPrintOutputStream, worksProperlyEscapedBraces )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const n = stream.print( MICROLIBRARY_FORMAT( "{{{:d}}}" ), std::uint8_t{ 7 } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "{7}" );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) writes each literal segment as a single block.
+ */
+TEST( stringPrintOutputStream, worksProperlyLiteralBlocks )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    EXPECT_CALL( stream.driver(), put( std::string{ "begin " } ) );
+    EXPECT_CALL( stream.driver(), put( std::string{ "0x2A" } ) );
+    EXPECT_CALL( stream.driver(), put( std::string{ " end" } ) );
+
+    EXPECT_EQ( stream.print( MICROLIBRARY_FORMAT( "begin {:x} end" ), std::uint8_t{ 0x2A } ), 14 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print( microlibrary::Output_Stream &,
+ *        Types &&... ) writes single character literal segments as characters.
+ */
+TEST( stringPrintOutputStream, worksProperlyLiteralCharacters )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    EXPECT_CALL( stream.driver(), put( SafeMatcherCast<char>( Eq( '[' ) ) ) );
+    EXPECT_CALL( stream.driver(), put( std::string{ "0x2A" } ) );
+    EXPECT_CALL( stream.driver(), put( SafeMatcherCast<char>( Eq( ']' ) ) ) );
+
+    EXPECT_EQ( stream.print( MICROLIBRARY_FORMAT( "[{:x}]" ), std::uint8_t{ 0x2A } ), 6 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Types &&... ) properly handles a
+ *        literal put error.
+ */
+TEST( stringPrintFaultReportingOutputStreamErrorHandling, literalPutError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 92 };
+
+    EXPECT_CALL( stream.driver(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( MICROLIBRARY_FORMAT( "a={} b={}" ), 'a', 'b' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Types &&... ) properly handles a
+ *        replacement field put error.
+ */
+TEST( stringPrintFaultReportingOutputStreamErrorHandling, fieldPutError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 18 };
+
+    EXPECT_CALL( stream.driver(), put( std::string{ "a=" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.driver(), put( A<char>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( MICROLIBRARY_FORMAT( "a={} b={}" ), 'a', 'b' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Format::String::print(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Types &&... ) works properly.
+ */
+TEST( stringPrintFaultReportingOutputStream, worksProperly )
+{
+    auto stream = Fault_Reporting_Output_String_Stream{};
+
+    auto const result = stream.print(
+        MICROLIBRARY_FORMAT( "[{:x}] {}" ), std::uint16_t{ 0xBEEF }, "Ok" );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), "[0xBEEF] Ok" );
+}
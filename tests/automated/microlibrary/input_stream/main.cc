@@ -0,0 +1,378 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Input_Stream automated tests.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Input_Formatter;
+using ::microlibrary::Input_Stream;
+using ::microlibrary::Testing::Automated::Input_String_Stream;
+using ::microlibrary::Testing::Automated::Mock_Input_Stream;
+using ::testing::_;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Ref;
+using ::testing::Return;
+
+enum class Foo {};
+
+class Mock_Input_Formatter {
+  public:
+    Mock_Input_Formatter() = default;
+
+    Mock_Input_Formatter( Mock_Input_Formatter && ) = delete;
+
+    Mock_Input_Formatter( Mock_Input_Formatter const & ) = delete;
+
+    ~Mock_Input_Formatter() noexcept = default;
+
+    auto operator=( Mock_Input_Formatter && ) = delete;
+
+    auto operator=( Mock_Input_Formatter const & ) = delete;
+
+    MOCK_METHOD( std::size_t, scan, (Input_Stream &, Foo &), ( const ) );
+};
+
+} // namespace
+
+template<>
+class microlibrary::Input_Formatter<::Foo> {
+  public:
+    Input_Formatter() = delete;
+
+    Input_Formatter( ::Mock_Input_Formatter const & mock_input_formatter ) noexcept :
+        m_mock_input_formatter{ &mock_input_formatter }
+    {
+    }
+
+    Input_Formatter( Input_Formatter && source ) noexcept = default;
+
+    Input_Formatter( Input_Formatter const & original ) noexcept = default;
+
+    ~Input_Formatter() noexcept = default;
+
+    auto operator=( Input_Formatter && expression ) noexcept -> Input_Formatter & = default;
+
+    auto operator=( Input_Formatter const & expression ) noexcept -> Input_Formatter & = default;
+
+    auto scan( Input_Stream & stream, ::Foo & foo ) const noexcept -> std::size_t
+    {
+        return m_mock_input_formatter->scan( stream, foo );
+    }
+
+  private:
+    ::Mock_Input_Formatter const * m_mock_input_formatter{};
+};
+
+/**
+ * \brief Verify microlibrary::Input_Stream::available() works properly.
+ */
+TEST( available, worksProperly )
+{
+    auto stream = Input_String_Stream{ "ZHp4" };
+
+    EXPECT_EQ( stream.available(), 4 );
+
+    auto character = char{};
+    stream.peek( character );
+
+    EXPECT_EQ( stream.available(), 4 );
+
+    stream.get( character );
+
+    EXPECT_EQ( stream.available(), 3 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::peek() properly handles end-of-file being
+ *        reached.
+ */
+TEST( peekErrorHandling, endOfFileReached )
+{
+    auto stream = Mock_Input_Stream{};
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( []( char * begin, char * ) {
+        return begin;
+    } );
+
+    auto character = char{ 'x' };
+    stream.peek( character );
+
+    EXPECT_EQ( character, 'x' );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::peek() works properly.
+ */
+TEST( peek, worksProperly )
+{
+    auto stream = Mock_Input_Stream{};
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( []( char * begin, char * ) {
+        *begin = 'q';
+
+        return begin + 1;
+    } );
+
+    auto character = char{};
+
+    stream.peek( character );
+    EXPECT_EQ( character, 'q' );
+
+    stream.peek( character );
+    EXPECT_EQ( character, 'q' );
+
+    stream.get( character );
+    EXPECT_EQ( character, 'q' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( char ) works properly.
+ */
+TEST( getChar, worksProperly )
+{
+    auto stream = Input_String_Stream{ "Gz" };
+
+    auto character = char{};
+
+    stream.get( character );
+    EXPECT_EQ( character, 'G' );
+
+    stream.get( character );
+    EXPECT_EQ( character, 'z' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+
+    stream.get( character );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( char *, char * ) properly handles
+ *        end-of-file being reached.
+ */
+TEST( getCharBlockErrorHandling, endOfFileReached )
+{
+    auto stream = Input_String_Stream{ "3Lw" };
+
+    auto string = std::string( 5, '\0' );
+
+    auto const end = stream.get( string.data(), string.data() + string.size() );
+
+    EXPECT_EQ( end, string.data() + 3 );
+    EXPECT_EQ( string.substr( 0, 3 ), "3Lw" );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( char *, char * ) works properly.
+ */
+TEST( getCharBlock, worksProperly )
+{
+    auto stream = Input_String_Stream{ "XUx1Ab6" };
+
+    auto character = char{};
+    stream.peek( character );
+
+    auto string = std::string( 7, '\0' );
+
+    auto const end = stream.get( string.data(), string.data() + string.size() );
+
+    EXPECT_EQ( end, string.data() + string.size() );
+    EXPECT_EQ( string, "XUx1Ab6" );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( char *, char * ) does not access the
+ *        driver if the block is satisfied by the peeked character.
+ */
+TEST( getCharBlock, worksProperlyPeekedCharacterOnly )
+{
+    auto stream = Mock_Input_Stream{};
+
+    EXPECT_CALL( stream.driver(), get( A<char *>(), A<char *>() ) ).WillOnce( []( char * begin, char * ) {
+        *begin = 'j';
+
+        return begin + 1;
+    } );
+
+    auto character = char{};
+    stream.peek( character );
+
+    auto block = char{};
+
+    EXPECT_EQ( stream.get( &block, &block + 1 ), &block + 1 );
+    EXPECT_EQ( block, 'j' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( std::uint8_t ) works properly.
+ */
+TEST( getData, worksProperly )
+{
+    auto stream = Input_String_Stream{ "\xA5" };
+
+    auto data = std::uint8_t{};
+
+    stream.get( data );
+
+    EXPECT_EQ( data, 0xA5 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::get( std::uint8_t *, std::uint8_t * ) works
+ *        properly.
+ */
+TEST( getDataBlock, worksProperly )
+{
+    auto stream = Input_String_Stream{ "\x49\x70\xB9" };
+
+    std::uint8_t data[ 3 ]{};
+
+    EXPECT_EQ( stream.get( data, data + 3 ), data + 3 );
+
+    EXPECT_EQ( data[ 0 ], 0x49 );
+    EXPECT_EQ( data[ 1 ], 0x70 );
+    EXPECT_EQ( data[ 2 ], 0xB9 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::scan() works properly when there is a single
+ *        value to parse.
+ */
+TEST( scan, worksProperlySingleValue )
+{
+    auto stream = Mock_Input_Stream{};
+
+    auto       foo           = Foo{ 243 };
+    auto const foo_formatter = Mock_Input_Formatter{};
+    auto const foo_size      = std::size_t{ 156 };
+
+    EXPECT_CALL( foo_formatter, scan( Ref( stream ), Ref( foo ) ) ).WillOnce( Return( foo_size ) );
+
+    EXPECT_EQ( stream.scan( foo, Input_Formatter<Foo>{ foo_formatter } ), foo_size );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::scan() works properly when there are multiple
+ *        values to parse.
+ */
+TEST( scan, worksProperlyMultipleValues )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Input_Stream{};
+
+    auto       foo_a           = Foo{ 201 };
+    auto const foo_a_formatter = Mock_Input_Formatter{};
+    auto const foo_a_size      = std::size_t{ 47 };
+    auto       foo_b           = Foo{ 141 };
+    auto const foo_b_formatter = Mock_Input_Formatter{};
+    auto const foo_b_size      = std::size_t{ 253 };
+
+    EXPECT_CALL( foo_a_formatter, scan( Ref( stream ), Ref( foo_a ) ) ).WillOnce( Return( foo_a_size ) );
+    EXPECT_CALL( foo_b_formatter, scan( Ref( stream ), Ref( foo_b ) ) ).WillOnce( Return( foo_b_size ) );
+
+    EXPECT_EQ(
+        stream.scan(
+            foo_a, Input_Formatter<Foo>{ foo_a_formatter }, foo_b, Input_Formatter<Foo>{ foo_b_formatter } ),
+        foo_a_size + foo_b_size );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Stream::scan() stops parsing values once the stream
+ *        is no longer nominal.
+ */
+TEST( scan, stopsWhenNotNominal )
+{
+    auto stream = Mock_Input_Stream{};
+
+    auto       foo_a           = Foo{ 201 };
+    auto const foo_a_formatter = Mock_Input_Formatter{};
+    auto const foo_a_size      = std::size_t{ 47 };
+    auto       foo_b           = Foo{ 141 };
+    auto const foo_b_formatter = Mock_Input_Formatter{};
+
+    EXPECT_CALL( foo_a_formatter, scan( Ref( stream ), Ref( foo_a ) ) ).WillOnce( [ & ]( Input_Stream & s, Foo & ) {
+        s.report_io_error();
+
+        return foo_a_size;
+    } );
+    EXPECT_CALL( foo_b_formatter, scan( _, _ ) ).Times( 0 );
+
+    EXPECT_EQ(
+        stream.scan(
+            foo_a, Input_Formatter<Foo>{ foo_a_formatter }, foo_b, Input_Formatter<Foo>{ foo_b_formatter } ),
+        foo_a_size );
+
+    EXPECT_TRUE( stream.io_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Input_Formatter<char>::scan( microlibrary::Input_Stream &,
+ *        char & ) works properly.
+ */
+TEST( inputFormatterCharScanInputStream, worksProperly )
+{
+    auto stream = Input_String_Stream{ "u" };
+
+    auto character = char{};
+
+    EXPECT_EQ( stream.scan( character ), 1 );
+    EXPECT_EQ( character, 'u' );
+
+    EXPECT_TRUE( stream.is_nominal() );
+
+    EXPECT_EQ( stream.scan( character ), 0 );
+
+    EXPECT_TRUE( stream.end_of_file_reached() );
+}
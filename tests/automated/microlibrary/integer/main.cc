@@ -32,13 +32,27 @@
 
 namespace {
 
+using ::microlibrary::byte_swap;
+using ::microlibrary::countr_zero;
 using ::microlibrary::highest_bit_set;
 using ::microlibrary::is_power_of_two;
 using ::microlibrary::mask;
+using ::microlibrary::popcount;
 using ::microlibrary::reflect;
+using ::microlibrary::rotl;
+using ::microlibrary::rotr;
 using ::testing::TestWithParam;
 using ::testing::ValuesIn;
 
+// the integer utilities must remain usable in constant expressions
+static_assert( highest_bit_set( std::uint64_t{ 1 } << 40 ) == 40 );
+static_assert( byte_swap( std::uint32_t{ 0x1234'5678 } ) == 0x7856'3412 );
+static_assert( reflect( std::uint16_t{ 0x0001 } ) == 0x8000 );
+static_assert( popcount( std::uint32_t{ 0xF0F0'0001 } ) == 9 );
+static_assert( countr_zero( std::uint8_t{ 0b0010'0000 } ) == 5 );
+static_assert( rotl( std::uint16_t{ 0x8001 }, 1 ) == 0x0003 );
+static_assert( rotr( std::uint16_t{ 0x8001 }, 1 ) == 0xC000 );
+
 } // namespace
 
 /**
@@ -326,6 +340,60 @@ highestBitSet_Test_Case<std::uint32_t> const highestBitSet32_TEST_CASES[]{
 
 INSTANTIATE_TEST_SUITE_P(, highestBitSet32, ValuesIn( highestBitSet32_TEST_CASES ) );
 
+/**
+ * \brief microlibrary::highest_bit_set() std::uint64_t test fixture.
+ */
+class highestBitSet64 : public TestWithParam<highestBitSet_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::highest_bit_set() works properly.
+ */
+TEST_P( highestBitSet64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( highest_bit_set( test_case.value ), test_case.highest_bit_set );
+}
+
+/**
+ * \brief microlibrary::highest_bit_set() std::uint64_t test cases.
+ */
+highestBitSet_Test_Case<std::uint64_t> const highestBitSet64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000001,  0 },
+    { 0x0000000000000080,  7 },
+    { 0x0000000000004000, 14 },
+    { 0x0000000000200000, 21 },
+    { 0x0000000010000000, 28 },
+    { 0x0000000800000000, 35 },
+    { 0x0000040000000000, 42 },
+    { 0x0002000000000000, 49 },
+    { 0x0100000000000000, 56 },
+    { 0x8000000000000000, 63 },
+    { 0x8000000000000000, 63 },
+
+    { 0x0000000000000003,  1 },
+    { 0x00000000000007FF, 10 },
+    { 0x00000000000FFFFF, 19 },
+    { 0x000000001FFFFFFF, 28 },
+    { 0x0000003FFFFFFFFF, 37 },
+    { 0x00007FFFFFFFFFFF, 46 },
+    { 0x00FFFFFFFFFFFFFF, 55 },
+
+    { 0x9EFD9CE2054A108A, 63 },
+    { 0x8676B326906E6A67, 63 },
+    { 0x236DAC08AF9D9634, 61 },
+    { 0x7C21AB0D672BD7E9, 62 },
+    { 0xF391361ABB4CCA3E, 63 },
+    { 0xFA843E7CF5B67503, 63 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, highestBitSet64, ValuesIn( highestBitSet64_TEST_CASES ) );
+
 /**
  * \brief microlibrary::mask() test case.
  *
@@ -1555,6 +1623,52 @@ reflect_Test_Case<std::uint32_t> const reflect32_TEST_CASES[]{
 
 INSTANTIATE_TEST_SUITE_P(, reflect32, ValuesIn( reflect32_TEST_CASES ) );
 
+/**
+ * \brief microlibrary::reflect() std::uint64_t test fixture.
+ */
+class reflect64 : public TestWithParam<reflect_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::reflect() works properly.
+ */
+TEST_P( reflect64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( reflect( test_case.value ), test_case.reflection );
+}
+
+/**
+ * \brief microlibrary::reflect() std::uint64_t test cases.
+ */
+reflect_Test_Case<std::uint64_t> const reflect64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF },
+
+    { 0x0000000000000001, 0x8000000000000000 },
+    { 0x0000000000000002, 0x4000000000000000 },
+    { 0x0000000000000080, 0x0100000000000000 },
+    { 0x0000000000000100, 0x0080000000000000 },
+    { 0x0000000080000000, 0x0000000100000000 },
+    { 0x0000000100000000, 0x0000000080000000 },
+    { 0x0100000000000000, 0x0000000000000080 },
+    { 0x8000000000000000, 0x0000000000000001 },
+
+    { 0xD10322399713D85B, 0xDA1BC8E99C44C08B },
+    { 0x2EEBDD04643E2EC8, 0x13747C2620BBD774 },
+    { 0xFED259C33215FF4F, 0xF2FFA84CC39A4B7F },
+    { 0xF5FD749B405CF5D4, 0x2BAF3A02D92EBFAF },
+    { 0xAD22A5CD269AED1D, 0xB8B75964B3A544B5 },
+    { 0xE849DDDD1C43AF35, 0xACF5C238BBBB9217 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, reflect64, ValuesIn( reflect64_TEST_CASES ) );
+
 /**
  * \brief microlibrary::is_power_of_two() test case.
  *
@@ -1898,3 +2012,1126 @@ isPowerOfTwo_Test_Case<std::uint32_t> const isPowerOfTwo32_TEST_CASES[]{
 };
 
 INSTANTIATE_TEST_SUITE_P(, isPowerOfTwo32, ValuesIn( isPowerOfTwo32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::byte_swap() test case.
+ *
+ * \tparam Integer The type of unsigned integer the byte swap will be performed on.
+ */
+template<typename Integer>
+struct byteSwap_Test_Case {
+    /**
+     * \brief The unsigned integer value to byte swap.
+     */
+    Integer value;
+
+    /**
+     * \brief The byte swapped unsigned integer value.
+     */
+    Integer byte_swap;
+};
+
+template<typename Integer>
+auto operator<<( std::ostream & stream, byteSwap_Test_Case<Integer> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.value }
+                  << ", "
+                  << ".byte_swap = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.byte_swap }
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief microlibrary::byte_swap() std::uint8_t test fixture.
+ */
+class byteSwap8 : public TestWithParam<byteSwap_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::byte_swap() works properly.
+ */
+TEST_P( byteSwap8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( byte_swap( test_case.value ), test_case.byte_swap );
+}
+
+/**
+ * \brief microlibrary::byte_swap() std::uint8_t test cases.
+ */
+byteSwap_Test_Case<std::uint8_t> const byteSwap8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000, 0b00000000 },
+    { 0b11111111, 0b11111111 },
+
+    { 0b11111111, 0b11111111 },
+
+    { 0b10000101, 0b10000101 },
+    { 0b01101010, 0b01101010 },
+    { 0b11001110, 0b11001110 },
+    { 0b01001101, 0b01001101 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, byteSwap8, ValuesIn( byteSwap8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::byte_swap() std::uint16_t test fixture.
+ */
+class byteSwap16 : public TestWithParam<byteSwap_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::byte_swap() works properly.
+ */
+TEST_P( byteSwap16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( byte_swap( test_case.value ), test_case.byte_swap );
+}
+
+/**
+ * \brief microlibrary::byte_swap() std::uint16_t test cases.
+ */
+byteSwap_Test_Case<std::uint16_t> const byteSwap16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000000, 0b0000000000000000 },
+    { 0b1111111111111111, 0b1111111111111111 },
+
+    { 0b0000000011111111, 0b1111111100000000 },
+    { 0b1111111100000000, 0b0000000011111111 },
+
+    { 0b1111010111100010, 0b1110001011110101 },
+    { 0b0101110110011001, 0b1001100101011101 },
+    { 0b0100101000100100, 0b0010010001001010 },
+    { 0b0010110010111000, 0b1011100000101100 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, byteSwap16, ValuesIn( byteSwap16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::byte_swap() std::uint32_t test fixture.
+ */
+class byteSwap32 : public TestWithParam<byteSwap_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::byte_swap() works properly.
+ */
+TEST_P( byteSwap32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( byte_swap( test_case.value ), test_case.byte_swap );
+}
+
+/**
+ * \brief microlibrary::byte_swap() std::uint32_t test cases.
+ */
+byteSwap_Test_Case<std::uint32_t> const byteSwap32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000000, 0b00000000000000000000000000000000 },
+    { 0b11111111111111111111111111111111, 0b11111111111111111111111111111111 },
+
+    { 0b00000000000000000000000011111111, 0b11111111000000000000000000000000 },
+    { 0b00000000000000001111111100000000, 0b00000000111111110000000000000000 },
+    { 0b00000000111111110000000000000000, 0b00000000000000001111111100000000 },
+    { 0b11111111000000000000000000000000, 0b00000000000000000000000011111111 },
+
+    { 0b11000100000111111001110111111101, 0b11111101100111010001111111000100 },
+    { 0b10110100100001000011100010110101, 0b10110101001110001000010010110100 },
+    { 0b10110100010001111100000011001110, 0b11001110110000000100011110110100 },
+    { 0b10001010010010011001011011101111, 0b11101111100101100100100110001010 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, byteSwap32, ValuesIn( byteSwap32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::byte_swap() std::uint64_t test fixture.
+ */
+class byteSwap64 : public TestWithParam<byteSwap_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::byte_swap() works properly.
+ */
+TEST_P( byteSwap64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( byte_swap( test_case.value ), test_case.byte_swap );
+}
+
+/**
+ * \brief microlibrary::byte_swap() std::uint64_t test cases.
+ */
+byteSwap_Test_Case<std::uint64_t> const byteSwap64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF },
+
+    { 0x00000000000000FF, 0xFF00000000000000 },
+    { 0x000000000000FF00, 0x00FF000000000000 },
+    { 0x0000000000FF0000, 0x0000FF0000000000 },
+    { 0x00000000FF000000, 0x000000FF00000000 },
+    { 0x000000FF00000000, 0x00000000FF000000 },
+    { 0x0000FF0000000000, 0x0000000000FF0000 },
+    { 0x00FF000000000000, 0x000000000000FF00 },
+    { 0xFF00000000000000, 0x00000000000000FF },
+
+    { 0x473D212BA950666D, 0x6D6650A92B213D47 },
+    { 0xEAE0D2C11C339464, 0x6494331CC1D2E0EA },
+    { 0x3FB81D2706E55426, 0x2654E506271DB83F },
+    { 0xD0B0090D62590992, 0x920959620D09B0D0 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, byteSwap64, ValuesIn( byteSwap64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::popcount() test case.
+ *
+ * \tparam Integer The type of unsigned integer the count will be performed on.
+ */
+template<typename Integer>
+struct popcount_Test_Case {
+    /**
+     * \brief The unsigned integer value to perform the count on.
+     */
+    Integer value;
+
+    /**
+     * \brief The number of bits set in the unsigned integer value.
+     */
+    std::uint_fast8_t popcount;
+};
+
+template<typename Integer>
+auto operator<<( std::ostream & stream, popcount_Test_Case<Integer> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.value }
+                  << ", "
+                  << ".popcount = " << std::dec << static_cast<std::uint_fast16_t>( test_case.popcount )
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief microlibrary::popcount() std::uint8_t test fixture.
+ */
+class popcount8 : public TestWithParam<popcount_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::popcount() works properly.
+ */
+TEST_P( popcount8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( popcount( test_case.value ), test_case.popcount );
+}
+
+/**
+ * \brief microlibrary::popcount() std::uint8_t test cases.
+ */
+popcount_Test_Case<std::uint8_t> const popcount8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000,  0 },
+    { 0b11111111,  8 },
+
+    { 0b00000001,  1 },
+    { 0b00000010,  1 },
+    { 0b00000100,  1 },
+    { 0b00001000,  1 },
+    { 0b00010000,  1 },
+    { 0b00100000,  1 },
+    { 0b01000000,  1 },
+    { 0b10000000,  1 },
+
+    { 0b00000011,  2 },
+    { 0b00000111,  3 },
+    { 0b00001111,  4 },
+    { 0b00011111,  5 },
+    { 0b00111111,  6 },
+    { 0b01111111,  7 },
+
+    { 0b10111111,  7 },
+    { 0b01101011,  5 },
+    { 0b01000000,  1 },
+    { 0b11011100,  5 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, popcount8, ValuesIn( popcount8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::popcount() std::uint16_t test fixture.
+ */
+class popcount16 : public TestWithParam<popcount_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::popcount() works properly.
+ */
+TEST_P( popcount16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( popcount( test_case.value ), test_case.popcount );
+}
+
+/**
+ * \brief microlibrary::popcount() std::uint16_t test cases.
+ */
+popcount_Test_Case<std::uint16_t> const popcount16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000000,  0 },
+    { 0b1111111111111111, 16 },
+
+    { 0b0000000000000001,  1 },
+    { 0b0000000000000100,  1 },
+    { 0b0000000000010000,  1 },
+    { 0b0000000001000000,  1 },
+    { 0b0000000100000000,  1 },
+    { 0b0000010000000000,  1 },
+    { 0b0001000000000000,  1 },
+    { 0b0100000000000000,  1 },
+
+    { 0b0000000000000011,  2 },
+    { 0b0000000000001111,  4 },
+    { 0b0000000000111111,  6 },
+    { 0b0000000011111111,  8 },
+    { 0b0000001111111111, 10 },
+    { 0b0000111111111111, 12 },
+    { 0b0011111111111111, 14 },
+
+    { 0b1000000001101001,  5 },
+    { 0b1100110101101000,  8 },
+    { 0b0101000101000011,  6 },
+    { 0b1010001111111001, 10 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, popcount16, ValuesIn( popcount16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::popcount() std::uint32_t test fixture.
+ */
+class popcount32 : public TestWithParam<popcount_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::popcount() works properly.
+ */
+TEST_P( popcount32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( popcount( test_case.value ), test_case.popcount );
+}
+
+/**
+ * \brief microlibrary::popcount() std::uint32_t test cases.
+ */
+popcount_Test_Case<std::uint32_t> const popcount32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000000,  0 },
+    { 0b11111111111111111111111111111111, 32 },
+
+    { 0b00000000000000000000000000000001,  1 },
+    { 0b00000000000000000000000000010000,  1 },
+    { 0b00000000000000000000000100000000,  1 },
+    { 0b00000000000000000001000000000000,  1 },
+    { 0b00000000000000010000000000000000,  1 },
+    { 0b00000000000100000000000000000000,  1 },
+    { 0b00000001000000000000000000000000,  1 },
+    { 0b00010000000000000000000000000000,  1 },
+
+    { 0b00000000000000000000000000000011,  2 },
+    { 0b00000000000000000000000000111111,  6 },
+    { 0b00000000000000000000001111111111, 10 },
+    { 0b00000000000000000011111111111111, 14 },
+    { 0b00000000000000111111111111111111, 18 },
+    { 0b00000000001111111111111111111111, 22 },
+    { 0b00000011111111111111111111111111, 26 },
+    { 0b00111111111111111111111111111111, 30 },
+
+    { 0b11011000101010001111000001100101, 15 },
+    { 0b10101111001101110001110110000111, 19 },
+    { 0b11110001111110000011101001111001, 19 },
+    { 0b10111001011010011110110000000111, 17 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, popcount32, ValuesIn( popcount32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::popcount() std::uint64_t test fixture.
+ */
+class popcount64 : public TestWithParam<popcount_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::popcount() works properly.
+ */
+TEST_P( popcount64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( popcount( test_case.value ), test_case.popcount );
+}
+
+/**
+ * \brief microlibrary::popcount() std::uint64_t test cases.
+ */
+popcount_Test_Case<std::uint64_t> const popcount64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000000,  0 },
+    { 0xFFFFFFFFFFFFFFFF, 64 },
+
+    { 0x0000000000000001,  1 },
+    { 0x0000000000000100,  1 },
+    { 0x0000000000010000,  1 },
+    { 0x0000000001000000,  1 },
+    { 0x0000000100000000,  1 },
+    { 0x0000010000000000,  1 },
+    { 0x0001000000000000,  1 },
+    { 0x0100000000000000,  1 },
+
+    { 0x0000000000000003,  2 },
+    { 0x00000000000003FF, 10 },
+    { 0x000000000003FFFF, 18 },
+    { 0x0000000003FFFFFF, 26 },
+    { 0x00000003FFFFFFFF, 34 },
+    { 0x000003FFFFFFFFFF, 42 },
+    { 0x0003FFFFFFFFFFFF, 50 },
+    { 0x03FFFFFFFFFFFFFF, 58 },
+
+    { 0x2335E9E266CEA9FA, 35 },
+    { 0x8D1A6BFFFF9A3914, 38 },
+    { 0x23CF493F0FEBDDF8, 39 },
+    { 0xCAA7E9BFD00724A1, 32 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, popcount64, ValuesIn( popcount64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::countr_zero() test case.
+ *
+ * \tparam Integer The type of unsigned integer the count will be performed on.
+ */
+template<typename Integer>
+struct countrZero_Test_Case {
+    /**
+     * \brief The unsigned integer value to perform the count on.
+     */
+    Integer value;
+
+    /**
+     * \brief The number of consecutive bits that are not set in the unsigned integer value,
+     *        starting from the least significant bit.
+     */
+    std::uint_fast8_t countr_zero;
+};
+
+template<typename Integer>
+auto operator<<( std::ostream & stream, countrZero_Test_Case<Integer> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.value }
+                  << ", "
+                  << ".countr_zero = " << std::dec << static_cast<std::uint_fast16_t>( test_case.countr_zero )
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief microlibrary::countr_zero() std::uint8_t test fixture.
+ */
+class countrZero8 : public TestWithParam<countrZero_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::countr_zero() works properly.
+ */
+TEST_P( countrZero8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( countr_zero( test_case.value ), test_case.countr_zero );
+}
+
+/**
+ * \brief microlibrary::countr_zero() std::uint8_t test cases.
+ */
+countrZero_Test_Case<std::uint8_t> const countrZero8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000,  8 },
+    { 0b11111111,  0 },
+
+    { 0b00000001,  0 },
+    { 0b00000010,  1 },
+    { 0b00000100,  2 },
+    { 0b00001000,  3 },
+    { 0b00010000,  4 },
+    { 0b00100000,  5 },
+    { 0b01000000,  6 },
+    { 0b10000000,  7 },
+    { 0b10000000,  7 },
+
+    { 0b11111110,  1 },
+    { 0b11111100,  2 },
+    { 0b11111000,  3 },
+    { 0b11110000,  4 },
+    { 0b11100000,  5 },
+    { 0b11000000,  6 },
+    { 0b10000000,  7 },
+
+    { 0b11100000,  5 },
+    { 0b10110010,  1 },
+    { 0b10100110,  1 },
+    { 0b11100001,  0 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, countrZero8, ValuesIn( countrZero8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::countr_zero() std::uint16_t test fixture.
+ */
+class countrZero16 : public TestWithParam<countrZero_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::countr_zero() works properly.
+ */
+TEST_P( countrZero16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( countr_zero( test_case.value ), test_case.countr_zero );
+}
+
+/**
+ * \brief microlibrary::countr_zero() std::uint16_t test cases.
+ */
+countrZero_Test_Case<std::uint16_t> const countrZero16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000000, 16 },
+    { 0b1111111111111111,  0 },
+
+    { 0b0000000000000001,  0 },
+    { 0b0000000000000100,  2 },
+    { 0b0000000000010000,  4 },
+    { 0b0000000001000000,  6 },
+    { 0b0000000100000000,  8 },
+    { 0b0000010000000000, 10 },
+    { 0b0001000000000000, 12 },
+    { 0b0100000000000000, 14 },
+    { 0b1000000000000000, 15 },
+
+    { 0b1111111111111110,  1 },
+    { 0b1111111111111000,  3 },
+    { 0b1111111111100000,  5 },
+    { 0b1111111110000000,  7 },
+    { 0b1111111000000000,  9 },
+    { 0b1111100000000000, 11 },
+    { 0b1110000000000000, 13 },
+    { 0b1000000000000000, 15 },
+
+    { 0b1011010010100000,  5 },
+    { 0b1000100001101001,  0 },
+    { 0b1000111100010011,  0 },
+    { 0b1100110101000010,  1 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, countrZero16, ValuesIn( countrZero16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::countr_zero() std::uint32_t test fixture.
+ */
+class countrZero32 : public TestWithParam<countrZero_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::countr_zero() works properly.
+ */
+TEST_P( countrZero32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( countr_zero( test_case.value ), test_case.countr_zero );
+}
+
+/**
+ * \brief microlibrary::countr_zero() std::uint32_t test cases.
+ */
+countrZero_Test_Case<std::uint32_t> const countrZero32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000000, 32 },
+    { 0b11111111111111111111111111111111,  0 },
+
+    { 0b00000000000000000000000000000001,  0 },
+    { 0b00000000000000000000000000010000,  4 },
+    { 0b00000000000000000000000100000000,  8 },
+    { 0b00000000000000000001000000000000, 12 },
+    { 0b00000000000000010000000000000000, 16 },
+    { 0b00000000000100000000000000000000, 20 },
+    { 0b00000001000000000000000000000000, 24 },
+    { 0b00010000000000000000000000000000, 28 },
+    { 0b10000000000000000000000000000000, 31 },
+
+    { 0b11111111111111111111111111111110,  1 },
+    { 0b11111111111111111111111111100000,  5 },
+    { 0b11111111111111111111111000000000,  9 },
+    { 0b11111111111111111110000000000000, 13 },
+    { 0b11111111111111100000000000000000, 17 },
+    { 0b11111111111000000000000000000000, 21 },
+    { 0b11111110000000000000000000000000, 25 },
+    { 0b11100000000000000000000000000000, 29 },
+
+    { 0b11110100100001110011000100010101,  0 },
+    { 0b10101111100100101001101010010001,  0 },
+    { 0b10110101110000110011011101000100,  2 },
+    { 0b11010100101111101100011111011000,  3 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, countrZero32, ValuesIn( countrZero32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::countr_zero() std::uint64_t test fixture.
+ */
+class countrZero64 : public TestWithParam<countrZero_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::countr_zero() works properly.
+ */
+TEST_P( countrZero64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( countr_zero( test_case.value ), test_case.countr_zero );
+}
+
+/**
+ * \brief microlibrary::countr_zero() std::uint64_t test cases.
+ */
+countrZero_Test_Case<std::uint64_t> const countrZero64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000000, 64 },
+    { 0xFFFFFFFFFFFFFFFF,  0 },
+
+    { 0x0000000000000001,  0 },
+    { 0x0000000000000100,  8 },
+    { 0x0000000000010000, 16 },
+    { 0x0000000001000000, 24 },
+    { 0x0000000100000000, 32 },
+    { 0x0000010000000000, 40 },
+    { 0x0001000000000000, 48 },
+    { 0x0100000000000000, 56 },
+    { 0x8000000000000000, 63 },
+
+    { 0xFFFFFFFFFFFFFFFE,  1 },
+    { 0xFFFFFFFFFFFFFE00,  9 },
+    { 0xFFFFFFFFFFFE0000, 17 },
+    { 0xFFFFFFFFFE000000, 25 },
+    { 0xFFFFFFFE00000000, 33 },
+    { 0xFFFFFE0000000000, 41 },
+    { 0xFFFE000000000000, 49 },
+    { 0xFE00000000000000, 57 },
+
+    { 0x9F9DB8DD8A3B09DD,  0 },
+    { 0xB730D88FE1E8A4AA,  1 },
+    { 0x91B5AECDA386A3A0,  5 },
+    { 0xE8E06B0C4F27B35C,  2 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, countrZero64, ValuesIn( countrZero64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotl() test case.
+ *
+ * \tparam Integer The type of unsigned integer the rotation will be performed on.
+ */
+template<typename Integer>
+struct rotl_Test_Case {
+    /**
+     * \brief The unsigned integer value to rotate.
+     */
+    Integer value;
+
+    /**
+     * \brief The number of bit positions to rotate the unsigned integer value by.
+     */
+    std::uint_fast8_t shift;
+
+    /**
+     * \brief The rotated unsigned integer value.
+     */
+    Integer rotation;
+};
+
+template<typename Integer>
+auto operator<<( std::ostream & stream, rotl_Test_Case<Integer> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.value }
+                  << ", "
+                  << ".shift = " << std::dec << static_cast<std::uint_fast16_t>( test_case.shift )
+                  << ", "
+                  << ".rotation = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.rotation }
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief microlibrary::rotl() std::uint8_t test fixture.
+ */
+class rotl8 : public TestWithParam<rotl_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotl() works properly.
+ */
+TEST_P( rotl8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotl( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotl() std::uint8_t test cases.
+ */
+rotl_Test_Case<std::uint8_t> const rotl8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000001,  0, 0b00000001 },
+    { 0b00000001,  1, 0b00000010 },
+    { 0b00000001,  4, 0b00010000 },
+    { 0b00000001,  7, 0b10000000 },
+    { 0b00000001,  8, 0b00000001 },
+    { 0b00000001, 11, 0b00001000 },
+
+    { 0b00010101,  0, 0b00010101 },
+    { 0b00010101,  1, 0b00101010 },
+    { 0b00010101,  4, 0b01010001 },
+    { 0b00010101,  7, 0b10001010 },
+    { 0b00010101,  8, 0b00010101 },
+    { 0b00010101, 11, 0b10101000 },
+
+    { 0b10000001,  7, 0b11000000 },
+    { 0b10100011,  2, 0b10001110 },
+    { 0b10101110,  6, 0b10101011 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotl8, ValuesIn( rotl8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotl() std::uint16_t test fixture.
+ */
+class rotl16 : public TestWithParam<rotl_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotl() works properly.
+ */
+TEST_P( rotl16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotl( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotl() std::uint16_t test cases.
+ */
+rotl_Test_Case<std::uint16_t> const rotl16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000001,  0, 0b0000000000000001 },
+    { 0b0000000000000001,  1, 0b0000000000000010 },
+    { 0b0000000000000001,  8, 0b0000000100000000 },
+    { 0b0000000000000001, 15, 0b1000000000000000 },
+    { 0b0000000000000001, 16, 0b0000000000000001 },
+    { 0b0000000000000001, 19, 0b0000000000001000 },
+
+    { 0b1101000000111001,  0, 0b1101000000111001 },
+    { 0b1101000000111001,  1, 0b1010000001110011 },
+    { 0b1101000000111001,  8, 0b0011100111010000 },
+    { 0b1101000000111001, 15, 0b1110100000011100 },
+    { 0b1101000000111001, 16, 0b1101000000111001 },
+    { 0b1101000000111001, 19, 0b1000000111001110 },
+
+    { 0b1000000110001101, 10, 0b0011011000000110 },
+    { 0b0000010010010000, 13, 0b0000000010010010 },
+    { 0b0101111101001000,  1, 0b1011111010010000 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotl16, ValuesIn( rotl16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotl() std::uint32_t test fixture.
+ */
+class rotl32 : public TestWithParam<rotl_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotl() works properly.
+ */
+TEST_P( rotl32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotl( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotl() std::uint32_t test cases.
+ */
+rotl_Test_Case<std::uint32_t> const rotl32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000001,  0, 0b00000000000000000000000000000001 },
+    { 0b00000000000000000000000000000001,  1, 0b00000000000000000000000000000010 },
+    { 0b00000000000000000000000000000001, 16, 0b00000000000000010000000000000000 },
+    { 0b00000000000000000000000000000001, 31, 0b10000000000000000000000000000000 },
+    { 0b00000000000000000000000000000001, 32, 0b00000000000000000000000000000001 },
+    { 0b00000000000000000000000000000001, 35, 0b00000000000000000000000000001000 },
+
+    { 0b11100101100110011110001101011001,  0, 0b11100101100110011110001101011001 },
+    { 0b11100101100110011110001101011001,  1, 0b11001011001100111100011010110011 },
+    { 0b11100101100110011110001101011001, 16, 0b11100011010110011110010110011001 },
+    { 0b11100101100110011110001101011001, 31, 0b11110010110011001111000110101100 },
+    { 0b11100101100110011110001101011001, 32, 0b11100101100110011110001101011001 },
+    { 0b11100101100110011110001101011001, 35, 0b00101100110011110001101011001111 },
+
+    { 0b11000000100001010101101011001001, 22, 0b10110010011100000010000101010110 },
+    { 0b00001100111000000010110100101000, 30, 0b00000011001110000000101101001010 },
+    { 0b01011111111101001100101101010000,  0, 0b01011111111101001100101101010000 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotl32, ValuesIn( rotl32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotl() std::uint64_t test fixture.
+ */
+class rotl64 : public TestWithParam<rotl_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotl() works properly.
+ */
+TEST_P( rotl64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotl( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotl() std::uint64_t test cases.
+ */
+rotl_Test_Case<std::uint64_t> const rotl64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000001,  0, 0x0000000000000001 },
+    { 0x0000000000000001,  1, 0x0000000000000002 },
+    { 0x0000000000000001, 32, 0x0000000100000000 },
+    { 0x0000000000000001, 63, 0x8000000000000000 },
+    { 0x0000000000000001, 64, 0x0000000000000001 },
+    { 0x0000000000000001, 67, 0x0000000000000008 },
+
+    { 0x67CC1752DE27660B,  0, 0x67CC1752DE27660B },
+    { 0x67CC1752DE27660B,  1, 0xCF982EA5BC4ECC16 },
+    { 0x67CC1752DE27660B, 32, 0xDE27660B67CC1752 },
+    { 0x67CC1752DE27660B, 63, 0xB3E60BA96F13B305 },
+    { 0x67CC1752DE27660B, 64, 0x67CC1752DE27660B },
+    { 0x67CC1752DE27660B, 67, 0x3E60BA96F13B305B },
+
+    { 0x1DF995313D2B9A36, 27, 0x89E95CD1B0EFCCA9 },
+    { 0x3FA244ADF517A775, 46, 0xE9DD4FE8912B7D45 },
+    { 0x44673E230EE06E0B,  8, 0x673E230EE06E0B44 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotl64, ValuesIn( rotl64_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotr() test case.
+ *
+ * \tparam Integer The type of unsigned integer the rotation will be performed on.
+ */
+template<typename Integer>
+struct rotr_Test_Case {
+    /**
+     * \brief The unsigned integer value to rotate.
+     */
+    Integer value;
+
+    /**
+     * \brief The number of bit positions to rotate the unsigned integer value by.
+     */
+    std::uint_fast8_t shift;
+
+    /**
+     * \brief The rotated unsigned integer value.
+     */
+    Integer rotation;
+};
+
+template<typename Integer>
+auto operator<<( std::ostream & stream, rotr_Test_Case<Integer> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.value }
+                  << ", "
+                  << ".shift = " << std::dec << static_cast<std::uint_fast16_t>( test_case.shift )
+                  << ", "
+                  << ".rotation = 0b" << std::bitset<std::numeric_limits<Integer>::digits>{ test_case.rotation }
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief microlibrary::rotr() std::uint8_t test fixture.
+ */
+class rotr8 : public TestWithParam<rotr_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotr() works properly.
+ */
+TEST_P( rotr8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotr( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotr() std::uint8_t test cases.
+ */
+rotr_Test_Case<std::uint8_t> const rotr8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000001,  0, 0b00000001 },
+    { 0b00000001,  1, 0b10000000 },
+    { 0b00000001,  4, 0b00010000 },
+    { 0b00000001,  7, 0b00000010 },
+    { 0b00000001,  8, 0b00000001 },
+    { 0b00000001, 11, 0b00100000 },
+
+    { 0b11001001,  0, 0b11001001 },
+    { 0b11001001,  1, 0b11100100 },
+    { 0b11001001,  4, 0b10011100 },
+    { 0b11001001,  7, 0b10010011 },
+    { 0b11001001,  8, 0b11001001 },
+    { 0b11001001, 11, 0b00111001 },
+
+    { 0b01000110,  3, 0b11001000 },
+    { 0b10111111,  2, 0b11101111 },
+    { 0b01000000,  4, 0b00000100 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotr8, ValuesIn( rotr8_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotr() std::uint16_t test fixture.
+ */
+class rotr16 : public TestWithParam<rotr_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotr() works properly.
+ */
+TEST_P( rotr16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotr( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotr() std::uint16_t test cases.
+ */
+rotr_Test_Case<std::uint16_t> const rotr16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000001,  0, 0b0000000000000001 },
+    { 0b0000000000000001,  1, 0b1000000000000000 },
+    { 0b0000000000000001,  8, 0b0000000100000000 },
+    { 0b0000000000000001, 15, 0b0000000000000010 },
+    { 0b0000000000000001, 16, 0b0000000000000001 },
+    { 0b0000000000000001, 19, 0b0010000000000000 },
+
+    { 0b1110101010100001,  0, 0b1110101010100001 },
+    { 0b1110101010100001,  1, 0b1111010101010000 },
+    { 0b1110101010100001,  8, 0b1010000111101010 },
+    { 0b1110101010100001, 15, 0b1101010101000011 },
+    { 0b1110101010100001, 16, 0b1110101010100001 },
+    { 0b1110101010100001, 19, 0b0011110101010100 },
+
+    { 0b0101100100001010, 10, 0b0100001010010110 },
+    { 0b0010101110110100, 10, 0b1110110100001010 },
+    { 0b0001100000010111,  8, 0b0001011100011000 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotr16, ValuesIn( rotr16_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotr() std::uint32_t test fixture.
+ */
+class rotr32 : public TestWithParam<rotr_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotr() works properly.
+ */
+TEST_P( rotr32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotr( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotr() std::uint32_t test cases.
+ */
+rotr_Test_Case<std::uint32_t> const rotr32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000001,  0, 0b00000000000000000000000000000001 },
+    { 0b00000000000000000000000000000001,  1, 0b10000000000000000000000000000000 },
+    { 0b00000000000000000000000000000001, 16, 0b00000000000000010000000000000000 },
+    { 0b00000000000000000000000000000001, 31, 0b00000000000000000000000000000010 },
+    { 0b00000000000000000000000000000001, 32, 0b00000000000000000000000000000001 },
+    { 0b00000000000000000000000000000001, 35, 0b00100000000000000000000000000000 },
+
+    { 0b01010101110010011101111111011011,  0, 0b01010101110010011101111111011011 },
+    { 0b01010101110010011101111111011011,  1, 0b10101010111001001110111111101101 },
+    { 0b01010101110010011101111111011011, 16, 0b11011111110110110101010111001001 },
+    { 0b01010101110010011101111111011011, 31, 0b10101011100100111011111110110110 },
+    { 0b01010101110010011101111111011011, 32, 0b01010101110010011101111111011011 },
+    { 0b01010101110010011101111111011011, 35, 0b01101010101110010011101111111011 },
+
+    { 0b00000010011111111101100111101011,  3, 0b01100000010011111111101100111101 },
+    { 0b11000000110101100100010000100001, 22, 0b01011001000100001000011100000011 },
+    { 0b00000100111010110100100001110000, 29, 0b00100111010110100100001110000000 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotr32, ValuesIn( rotr32_TEST_CASES ) );
+
+/**
+ * \brief microlibrary::rotr() std::uint64_t test fixture.
+ */
+class rotr64 : public TestWithParam<rotr_Test_Case<std::uint64_t>> {
+};
+
+/**
+ * \brief Verify microlibrary::rotr() works properly.
+ */
+TEST_P( rotr64, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( rotr( test_case.value, test_case.shift ), test_case.rotation );
+}
+
+/**
+ * \brief microlibrary::rotr() std::uint64_t test cases.
+ */
+rotr_Test_Case<std::uint64_t> const rotr64_TEST_CASES[]{
+    // clang-format off
+
+    { 0x0000000000000001,  0, 0x0000000000000001 },
+    { 0x0000000000000001,  1, 0x8000000000000000 },
+    { 0x0000000000000001, 32, 0x0000000100000000 },
+    { 0x0000000000000001, 63, 0x0000000000000002 },
+    { 0x0000000000000001, 64, 0x0000000000000001 },
+    { 0x0000000000000001, 67, 0x2000000000000000 },
+
+    { 0x45C2C169BEA12BA5,  0, 0x45C2C169BEA12BA5 },
+    { 0x45C2C169BEA12BA5,  1, 0xA2E160B4DF5095D2 },
+    { 0x45C2C169BEA12BA5, 32, 0xBEA12BA545C2C169 },
+    { 0x45C2C169BEA12BA5, 63, 0x8B8582D37D42574A },
+    { 0x45C2C169BEA12BA5, 64, 0x45C2C169BEA12BA5 },
+    { 0x45C2C169BEA12BA5, 67, 0xA8B8582D37D42574 },
+
+    { 0xA212F8FC794BAEAD,  6, 0xB6884BE3F1E52EBA },
+    { 0x32C3233DBA9EBA35, 39, 0x7B753D746A658646 },
+    { 0x1335276B42114ABF, 62, 0x4CD49DAD08452AFC },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P(, rotr64, ValuesIn( rotr64_TEST_CASES ) );
@@ -0,0 +1,176 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log automated tests.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/format.h"
+#include "microlibrary/log.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Log::id;
+using ::microlibrary::Log::Message;
+using ::microlibrary::Log::write;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Output_Vector_Stream;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Output_Stream;
+using ::microlibrary::Testing::Automated::Output_Vector_Stream;
+using ::testing::A;
+using ::testing::Return;
+
+struct Pressure : Message<Pressure, std::uint16_t, std::int8_t> {
+    static constexpr auto string() noexcept -> char const *
+    {
+        return "p={} d={}";
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Log::id() works properly.
+ */
+TEST( id, worksProperly )
+{
+    // FNV-1a of "" followed by a null character
+    EXPECT_EQ( id<>( "" ), 0x050C5D1F );
+
+    EXPECT_EQ( ( id<std::uint8_t>( "x={}" ) ), ( id<std::uint8_t>( "x={}" ) ) );
+    EXPECT_NE( ( id<std::uint8_t>( "x={}" ) ), ( id<std::int8_t>( "x={}" ) ) );
+    EXPECT_NE( ( id<std::uint8_t>( "x={}" ) ), ( id<std::uint8_t>( "y={}" ) ) );
+
+    static_assert( id<>( "" ) == 0x050C5D1F );
+}
+
+/**
+ * \brief Verify microlibrary::Log::write( microlibrary::Output_Stream &,
+ *        microlibrary::Format::String<Source>, Types... ) works properly.
+ */
+TEST( writeOutputStream, worksProperly )
+{
+    auto stream = Output_Vector_Stream<std::uint8_t>{};
+
+    write( stream, MICROLIBRARY_FORMAT( "a={} b={:x} c={}" ), std::int16_t{ -2 }, std::uint32_t{ 0x12345678 }, 'Z' );
+
+    auto const format_string_id = id<std::int16_t, std::uint32_t, char>( "a={} b={:x} c={}" );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ(
+        stream.vector(),
+        ( std::vector<std::uint8_t>{
+            static_cast<std::uint8_t>( format_string_id ),
+            static_cast<std::uint8_t>( format_string_id >> 8 ),
+            static_cast<std::uint8_t>( format_string_id >> 16 ),
+            static_cast<std::uint8_t>( format_string_id >> 24 ),
+            0xFE,
+            0xFF,
+            0x78,
+            0x56,
+            0x34,
+            0x12,
+            'Z',
+        } ) );
+}
+
+/**
+ * \brief Verify microlibrary::Log::write( microlibrary::Fault_Reporting_Output_Stream &,
+ *        microlibrary::Format::String<Source>, Types... ) properly handles a put error.
+ */
+TEST( writeFaultReportingOutputStreamErrorHandling, putError )
+{
+    auto stream = Mock_Fault_Reporting_Output_Stream{};
+
+    auto const error = Mock_Error{ 140 };
+
+    EXPECT_CALL( stream.driver(), put( A<std::vector<std::uint8_t>>() ) ).WillOnce( Return( error ) );
+
+    auto const result = write( stream, MICROLIBRARY_FORMAT( "{}" ), std::uint8_t{ 4 } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_TRUE( stream.fatal_error_reported() );
+}
+
+/**
+ * \brief Verify microlibrary::Log::write( microlibrary::Fault_Reporting_Output_Stream &,
+ *        microlibrary::Format::String<Source>, Types... ) works properly.
+ */
+TEST( writeFaultReportingOutputStream, worksProperly )
+{
+    auto stream = Fault_Reporting_Output_Vector_Stream<std::uint8_t>{};
+
+    auto const result = write( stream, MICROLIBRARY_FORMAT( "boot" ) );
+
+    auto const format_string_id = id<>( "boot" );
+
+    EXPECT_FALSE( result.is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ(
+        stream.vector(),
+        ( std::vector<std::uint8_t>{
+            static_cast<std::uint8_t>( format_string_id ),
+            static_cast<std::uint8_t>( format_string_id >> 8 ),
+            static_cast<std::uint8_t>( format_string_id >> 16 ),
+            static_cast<std::uint8_t>( format_string_id >> 24 ),
+        } ) );
+}
+
+/**
+ * \brief Verify microlibrary::Log::Message::write( microlibrary::Output_Stream &,
+ *        Types... ) works properly.
+ */
+TEST( messageWriteOutputStream, worksProperly )
+{
+    auto stream   = Output_Vector_Stream<std::uint8_t>{};
+    auto expected = Output_Vector_Stream<std::uint8_t>{};
+
+    Pressure::write( stream, 1013, -3 );
+    write( expected, MICROLIBRARY_FORMAT( "p={} d={}" ), std::uint16_t{ 1013 }, std::int8_t{ -3 } );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.vector(), expected.vector() );
+}
+
+/**
+ * \brief Verify microlibrary::Log::Message::write(
+ *        microlibrary::Fault_Reporting_Output_Stream &, Types... ) works properly.
+ */
+TEST( messageWriteFaultReportingOutputStream, worksProperly )
+{
+    auto stream   = Fault_Reporting_Output_Vector_Stream<std::uint8_t>{};
+    auto expected = Output_Vector_Stream<std::uint8_t>{};
+
+    auto const result = Pressure::write( stream, 998, 7 );
+    write( expected, MICROLIBRARY_FORMAT( "p={} d={}" ), std::uint16_t{ 998 }, std::int8_t{ 7 } );
+
+    EXPECT_FALSE( result.is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.vector(), expected.vector() );
+}
@@ -0,0 +1,276 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log_Decoder automated tests.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "microlibrary/error.h"
+#include "microlibrary/format.h"
+#include "microlibrary/log.h"
+#include "microlibrary/log_decoder.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Log_Decoder;
+using ::microlibrary::Log::id;
+using ::microlibrary::Log::Message;
+using ::microlibrary::Log::write;
+using ::microlibrary::Testing::Automated::Output_String_Stream;
+using ::microlibrary::Testing::Automated::Output_Vector_Stream;
+
+struct Reset : Message<Reset> {
+    static constexpr auto string() noexcept -> char const *
+    {
+        return "reset";
+    }
+};
+
+struct Voltage : Message<Voltage, std::uint16_t, char> {
+    static constexpr auto string() noexcept -> char const *
+    {
+        return "v={:x} ch={}";
+    }
+};
+
+struct Invalid : Message<Invalid, std::uint8_t> {
+    static constexpr auto string() noexcept -> char const *
+    {
+        return "{:q}";
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::add() properly handles an invalid format
+ *        string.
+ */
+TEST( addErrorHandling, invalidFormatString )
+{
+    auto decoder = Log_Decoder{};
+
+    auto const result = decoder.add<std::uint8_t>( "{:q}" );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::add() properly handles an argument count
+ *        mismatch.
+ */
+TEST( addErrorHandling, argumentCountMismatch )
+{
+    auto decoder = Log_Decoder{};
+
+    auto const result = decoder.add<std::uint8_t, std::uint8_t>( "{}" );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::add() properly handles a duplicate format
+ *        string.
+ */
+TEST( addErrorHandling, duplicateFormatString )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add<std::uint8_t>( "{}" ).is_error() );
+
+    auto const result = decoder.add<std::uint8_t>( "{}" );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::add( microlibrary::Log::Message<Source, Types...>
+ *        ) properly handles an invalid format string.
+ */
+TEST( addMessageErrorHandling, invalidFormatString )
+{
+    auto decoder = Log_Decoder{};
+
+    auto const result = decoder.add( Invalid{} );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::add( microlibrary::Log::Message<Source, Types...>
+ *        ) properly handles a duplicate format string.
+ */
+TEST( addMessageErrorHandling, duplicateFormatString )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add<>( "reset" ).is_error() );
+
+    auto const result = decoder.add( Reset{} );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::decode() properly handles an incomplete
+ *        format string ID.
+ */
+TEST( decodeErrorHandling, incompleteFormatStringID )
+{
+    auto decoder = Log_Decoder{};
+
+    auto const data = std::vector<std::uint8_t>{ 0x1F, 0x5D, 0x0C };
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = decoder.decode( data.data(), data.data() + data.size(), stream );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_UNDERFLOW );
+
+    EXPECT_EQ( stream.string(), "" );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::decode() properly handles an unknown format
+ *        string ID.
+ */
+TEST( decodeErrorHandling, unknownFormatStringID )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add<>( "boot" ).is_error() );
+
+    auto log = Output_Vector_Stream<std::uint8_t>{};
+
+    write( log, MICROLIBRARY_FORMAT( "reset" ) );
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = decoder.decode( log.vector().data(), log.vector().data() + log.vector().size(), stream );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INVALID_ARGUMENT );
+
+    EXPECT_EQ( stream.string(), "" );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::decode() properly handles incomplete
+ *        arguments.
+ */
+TEST( decodeErrorHandling, incompleteArguments )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add<std::uint32_t>( "{}" ).is_error() );
+
+    auto log = Output_Vector_Stream<std::uint8_t>{};
+
+    write( log, MICROLIBRARY_FORMAT( "{}" ), std::uint32_t{ 7 } );
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = decoder.decode( log.vector().data(), log.vector().data() + log.vector().size() - 1, stream );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_UNDERFLOW );
+
+    EXPECT_EQ( stream.string(), "" );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::decode() works properly.
+ */
+TEST( decode, worksProperly )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add<>( "boot" ).is_error() );
+    EXPECT_FALSE( ( decoder.add<std::int16_t, std::uint8_t, char>( "t={} s={:x} m={}" ).is_error() ) );
+    EXPECT_FALSE( ( decoder.add<std::uint8_t, std::int64_t>( "{{{:b}}} {:d}" ).is_error() ) );
+
+    auto log = Output_Vector_Stream<std::uint8_t>{};
+
+    write( log, MICROLIBRARY_FORMAT( "boot" ) );
+    write( log, MICROLIBRARY_FORMAT( "t={} s={:x} m={}" ), std::int16_t{ -273 }, std::uint8_t{ 0xA5 }, 'C' );
+    write( log, MICROLIBRARY_FORMAT( "{{{:b}}} {:d}" ), std::uint8_t{ 0x05 }, std::int64_t{ -9'000'000'000 } );
+
+    auto stream = Output_String_Stream{};
+
+    auto const * const begin = log.vector().data();
+    auto const * const end   = log.vector().data() + log.vector().size();
+
+    auto const * i = begin;
+    while ( i != end ) {
+        auto const result = decoder.decode( i, end, stream );
+
+        ASSERT_FALSE( result.is_error() );
+
+        i = result.value();
+
+        stream.put( '\n' );
+    } // while
+
+    EXPECT_EQ( stream.string(), "boot\nt=-273 s=0xA5 m=C\n{0b00000101} -9000000000\n" );
+}
+
+/**
+ * \brief Verify microlibrary::Log_Decoder::decode() works properly when decoding records
+ *        written using messages.
+ */
+TEST( decode, worksProperlyMessages )
+{
+    auto decoder = Log_Decoder{};
+
+    EXPECT_FALSE( decoder.add( Reset{} ).is_error() );
+    EXPECT_FALSE( decoder.add( Voltage{} ).is_error() );
+
+    auto log = Output_Vector_Stream<std::uint8_t>{};
+
+    Voltage::write( log, 0x0CE4, 'A' );
+    Reset::write( log );
+
+    auto stream = Output_String_Stream{};
+
+    auto const * const end = log.vector().data() + log.vector().size();
+
+    auto const * i = log.vector().data();
+    while ( i != end ) {
+        auto const result = decoder.decode( i, end, stream );
+
+        ASSERT_FALSE( result.is_error() );
+
+        i = result.value();
+
+        stream.put( '\n' );
+    } // while
+
+    EXPECT_EQ( stream.string(), "v=0x0CE4 ch=A\nreset\n" );
+}
@@ -32,6 +32,7 @@
 #include "microlibrary/microchip/megaavr0/peripheral/clkctrl.h"
 #include "microlibrary/pointer.h"
 #include "microlibrary/testing/automated/microchip/megaavr0/clock.h"
+#include "microlibrary/testing/automated/register.h"
 
 namespace {
 
@@ -46,6 +47,9 @@ using ::microlibrary::Microchip::megaAVR0::External_32_768_kHz_Crystal_Oscillato
 using ::microlibrary::Microchip::megaAVR0::Internal_16_20_MHz_Oscillator_Mode;
 using ::microlibrary::Microchip::megaAVR0::Internal_32_768_kHz_Ultra_Low_Power_Oscillator_Mode;
 using ::microlibrary::Microchip::megaAVR0::Peripheral::CLKCTRL;
+using ::microlibrary::Testing::Automated::Register_Trace;
+using ::microlibrary::Testing::Automated::Register_Trace_Replay;
+using ::testing::_;
 using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::TestWithParam;
@@ -252,6 +256,9 @@ TEST_P( setClockSource, worksProperly )
     EXPECT_CALL( clkctrl.mclkctrla, write( test_case.mclkctrla_final ) );
 
     clock_controller.set_clock_source( test_case.source );
+
+    EXPECT_EQ( clkctrl.mclkctrla.reads(), 1 );
+    EXPECT_EQ( clkctrl.mclkctrla.writes(), 1 );
 }
 
 /**
@@ -1858,6 +1865,9 @@ TEST_P( setExternal32768kHzCrystalOscillatorMode, worksProperly )
     EXPECT_CALL( clkctrl.xosc32kctrla, write( test_case.xosc32kctrla_final ) );
 
     clock_controller.set_external_32_768_kHz_crystal_oscillator_mode( test_case.mode );
+
+    EXPECT_EQ( clkctrl.xosc32kctrla.reads(), 1 );
+    EXPECT_EQ( clkctrl.xosc32kctrla.writes(), 1 );
 }
 
 /**
@@ -2052,3 +2062,69 @@ externalClockIsStable_Test_Case const externalClockIsStable_TEST_CASES[]{
 };
 
 INSTANTIATE_TEST_SUITE_P(, externalClockIsStable, ValuesIn( externalClockIsStable_TEST_CASES ) );
+
+/**
+ * \brief Configure a clock controller's clock source and clock prescaler.
+ *
+ * \param[in] clkctrl The CLKCTRL peripheral to configure.
+ * \param[in] source The clock source to use.
+ */
+void configure_clock( CLKCTRL & clkctrl, Clock_Source source )
+{
+    EXPECT_CALL( clkctrl.mclkctrla, read() ).WillRepeatedly( Return( 0b1'0000'0'00 ) );
+    EXPECT_CALL( clkctrl.mclkctrla, write( _ ) ).Times( 1 );
+    EXPECT_CALL( clkctrl.mclkctrlb, read() ).WillRepeatedly( Return( 0b000'0000'0 ) );
+    EXPECT_CALL( clkctrl.mclkctrlb, write( _ ) ).Times( 1 );
+
+    auto clock_controller = Clock_Controller{ Not_Null{ &clkctrl } };
+
+    clock_controller.set_clock_source( source );
+    clock_controller.configure_clock_prescaler( Clock_Prescaler_Value::_4, Clock_Prescaler::ENABLED );
+}
+
+/**
+ * \brief Verify a recorded microlibrary::Microchip::megaAVR0::Clock_Controller register
+ *        access trace can be replayed against another CLKCTRL peripheral instance.
+ */
+TEST( registerTrace, replaysProperly )
+{
+    auto clkctrl_recorded = CLKCTRL{};
+
+    auto const accesses = [ & ] {
+        auto trace = Register_Trace{ 16, &clkctrl_recorded };
+
+        configure_clock( clkctrl_recorded, Clock_Source::EXTERNAL_CLOCK );
+
+        EXPECT_EQ( trace.counts( &clkctrl_recorded.mclkctrla ).reads, 1 );
+        EXPECT_EQ( trace.counts( &clkctrl_recorded.mclkctrla ).writes, 1 );
+        EXPECT_EQ( trace.counts( &clkctrl_recorded.mclkctrlb ).reads, 0 );
+        EXPECT_EQ( trace.counts( &clkctrl_recorded.mclkctrlb ).writes, 1 );
+
+        return trace.accesses();
+    }();
+
+    ASSERT_EQ( accesses.size(), 3 );
+
+    {
+        auto clkctrl_replayed = CLKCTRL{};
+
+        auto const replay = Register_Trace_Replay{ accesses, &clkctrl_replayed };
+
+        configure_clock( clkctrl_replayed, Clock_Source::EXTERNAL_CLOCK );
+
+        EXPECT_TRUE( replay.matches() );
+        EXPECT_TRUE( replay.mismatches().empty() );
+    }
+
+    {
+        auto clkctrl_replayed = CLKCTRL{};
+
+        auto const replay = Register_Trace_Replay{ accesses, &clkctrl_replayed };
+
+        configure_clock( clkctrl_replayed, Clock_Source::INTERNAL_16_20_MHz_OSCILLATOR );
+
+        EXPECT_TRUE( replay.complete() );
+        EXPECT_FALSE( replay.matches() );
+        EXPECT_EQ( replay.mismatches().size(), 1 );
+    }
+}
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -36,6 +37,7 @@
 
 namespace {
 
+using ::microlibrary::Character_Block;
 using ::microlibrary::Error_Code;
 using ::microlibrary::Output_Formatter;
 using ::microlibrary::Output_Stream;
@@ -182,6 +184,29 @@ TEST( putDataBlock, worksProperly )
     EXPECT_TRUE( stream.is_nominal() );
 }
 
+/**
+ * \brief Verify microlibrary::Output_Stream::put( microlibrary::Character_Block const *,
+ *        microlibrary::Character_Block const * ) works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const a = std::string_view{ "tW" };
+    auto const b = std::string_view{ "8Hc0q" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    EXPECT_CALL( stream.driver(), put( std::vector<std::string>{ "tW", "8Hc0q" } ) );
+
+    stream.put( std::begin( blocks ), std::end( blocks ) );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Verify microlibrary::Output_Stream::print() works properly when there is a
  *        single value to format.
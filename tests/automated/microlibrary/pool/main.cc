@@ -0,0 +1,331 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Pool automated tests.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "microlibrary/error.h"
+#include "microlibrary/pool.h"
+
+namespace {
+
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Pool;
+
+/**
+ * \brief Object that tracks the number of live instances.
+ */
+class Tracked {
+  public:
+    /**
+     * \brief The number of live instances.
+     */
+    static inline auto live = 0;
+
+    Tracked() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] a The first value component.
+     * \param[in] b The second value component.
+     */
+    Tracked( std::uint32_t a, std::uint32_t b ) noexcept : m_value{ a ^ ( b << 16 ) }
+    {
+        ++live;
+    }
+
+    Tracked( Tracked && ) = delete;
+
+    Tracked( Tracked const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tracked() noexcept
+    {
+        --live;
+    }
+
+    auto operator=( Tracked && ) = delete;
+
+    auto operator=( Tracked const & ) = delete;
+
+    /**
+     * \brief Get the value.
+     *
+     * \return The value.
+     */
+    auto value() const noexcept
+    {
+        return m_value;
+    }
+
+  private:
+    /**
+     * \brief The value.
+     */
+    std::uint32_t m_value;
+};
+
+/**
+ * \brief Counting pool lock.
+ */
+class Counting_Lock {
+  public:
+    /**
+     * \brief The number of times the lock has been acquired.
+     */
+    static inline auto acquisitions = 0;
+
+    /**
+     * \brief The lock is held.
+     */
+    static inline auto held = false;
+
+    /**
+     * \brief Constructor.
+     */
+    Counting_Lock() noexcept
+    {
+        EXPECT_FALSE( held );
+
+        held = true;
+        ++acquisitions;
+    }
+
+    Counting_Lock( Counting_Lock && ) = delete;
+
+    Counting_Lock( Counting_Lock const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Counting_Lock() noexcept
+    {
+        held = false;
+    }
+
+    auto operator=( Counting_Lock && ) = delete;
+
+    auto operator=( Counting_Lock const & ) = delete;
+};
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Pool::Handle is sized properly.
+ */
+TEST( handle, sizedProperly )
+{
+    EXPECT_TRUE( ( std::is_same_v<Pool<char, 1>::Handle, std::uint8_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Pool<char, 254>::Handle, std::uint8_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Pool<char, 255>::Handle, std::uint16_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Pool<char, 65534>::Handle, std::uint16_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Pool<char, 65535>::Handle, std::uint32_t> ) );
+}
+
+/**
+ * \brief Verify microlibrary::Pool::allocate() properly handles a full pool.
+ */
+TEST( allocateErrorHandling, full )
+{
+    auto pool = Pool<std::uint16_t, 3>{};
+
+    for ( auto const value : { 0x4A3E, 0x9C01, 0x1F7B } ) {
+        EXPECT_FALSE( pool.allocate( value ).is_error() );
+    } // for
+
+    EXPECT_TRUE( pool.full() );
+
+    for ( auto i = 0; i < 2; ++i ) {
+        auto const result = pool.allocate( 0xE285 );
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+    } // for
+
+    EXPECT_EQ( pool.size(), 3 );
+    EXPECT_EQ( pool.failed_allocations(), 2 );
+}
+
+/**
+ * \brief Verify microlibrary::Pool::allocate() and microlibrary::Pool::free() construct
+ *        and destroy objects.
+ */
+TEST( allocateFree, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto pool = Pool<Tracked, 4>{};
+
+    EXPECT_TRUE( pool.empty() );
+    EXPECT_EQ( pool.available(), 4 );
+
+    auto const a = pool.allocate( 0x1234, 0x0001 );
+    auto const b = pool.allocate( 0x5678, 0x0002 );
+
+    ASSERT_FALSE( a.is_error() );
+    ASSERT_FALSE( b.is_error() );
+    EXPECT_NE( a.value(), b.value() );
+
+    EXPECT_EQ( Tracked::live, 2 );
+    EXPECT_EQ( pool[ a.value() ].value(), 0x0001'1234 );
+    EXPECT_EQ( pool[ b.value() ].value(), 0x0002'5678 );
+    EXPECT_EQ( pool.handle( &pool[ b.value() ] ), b.value() );
+
+    pool.free( a.value() );
+
+    EXPECT_EQ( Tracked::live, 1 );
+    EXPECT_EQ( pool.size(), 1 );
+
+    auto const c = pool.allocate( 0x9ABC, 0x0003 );
+
+    ASSERT_FALSE( c.is_error() );
+    EXPECT_EQ( c.value(), a.value() );
+    EXPECT_EQ( pool[ c.value() ].value(), 0x0003'9ABC );
+    EXPECT_EQ( pool[ b.value() ].value(), 0x0002'5678 );
+
+    pool.free( b.value() );
+    pool.free( c.value() );
+
+    EXPECT_EQ( Tracked::live, 0 );
+    EXPECT_TRUE( pool.empty() );
+    EXPECT_EQ( pool.high_water_mark(), 2 );
+}
+
+/**
+ * \brief Verify microlibrary::Pool::reset_statistics() works properly.
+ */
+TEST( resetStatistics, worksProperly )
+{
+    auto pool = Pool<std::uint8_t, 2>{};
+
+    auto const a = pool.allocate( 1 );
+    auto const b = pool.allocate( 2 );
+
+    ASSERT_FALSE( a.is_error() );
+    ASSERT_FALSE( b.is_error() );
+    EXPECT_TRUE( pool.allocate( 3 ).is_error() );
+
+    pool.free( a.value() );
+
+    EXPECT_EQ( pool.high_water_mark(), 2 );
+    EXPECT_EQ( pool.failed_allocations(), 1 );
+
+    pool.reset_statistics();
+
+    EXPECT_EQ( pool.high_water_mark(), 1 );
+    EXPECT_EQ( pool.failed_allocations(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Pool uses its lock policy.
+ */
+TEST( lock, worksProperly )
+{
+    auto pool = Pool<std::uint8_t, 2, Counting_Lock>{};
+
+    Counting_Lock::acquisitions = 0;
+
+    auto const a = pool.allocate( 1 );
+
+    ASSERT_FALSE( a.is_error() );
+    EXPECT_EQ( Counting_Lock::acquisitions, 1 );
+
+    pool.free( a.value() );
+
+    EXPECT_EQ( Counting_Lock::acquisitions, 2 );
+    EXPECT_FALSE( Counting_Lock::held );
+}
+
+/**
+ * \brief Verify microlibrary::Pool works properly with random allocate/free patterns.
+ */
+TEST( stress, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto pool = Pool<Tracked, 200>{};
+
+    auto allocated = std::map<Pool<Tracked, 200>::Handle, std::uint32_t>{};
+    auto high_water_mark = std::size_t{ 0 };
+    auto failed_allocations = std::size_t{ 0 };
+
+    auto generator = std::mt19937{ 0x5EED };
+
+    for ( auto i = 0; i < 100'000; ++i ) {
+        // bias toward allocation for the first half to exercise the full pool, and toward
+        // freeing for the second half to exercise draining the pool
+        auto const allocate = generator() % 100 < ( i < 50'000 ? 60U : 40U );
+
+        if ( allocate ) {
+            auto const value  = static_cast<std::uint32_t>( generator() & 0xFFFF );
+            auto const result = pool.allocate( value, 0 );
+
+            if ( allocated.size() == pool.capacity() ) {
+                ASSERT_TRUE( result.is_error() );
+                ASSERT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+                ++failed_allocations;
+            } else {
+                ASSERT_FALSE( result.is_error() );
+                ASSERT_LT( result.value(), pool.capacity() );
+                ASSERT_EQ( allocated.count( result.value() ), 0 );
+
+                allocated[ result.value() ] = value;
+
+                if ( allocated.size() > high_water_mark ) {
+                    high_water_mark = allocated.size();
+                } // if
+            } // else
+        } else if ( not allocated.empty() ) {
+            auto entry = allocated.begin();
+            std::advance( entry, generator() % allocated.size() );
+
+            ASSERT_EQ( pool[ entry->first ].value(), entry->second );
+
+            pool.free( entry->first );
+            allocated.erase( entry );
+        } // else if
+
+        ASSERT_EQ( pool.size(), allocated.size() );
+        ASSERT_EQ( static_cast<std::size_t>( Tracked::live ), allocated.size() );
+    } // for
+
+    for ( auto const & [ handle, value ] : allocated ) {
+        EXPECT_EQ( pool[ handle ].value(), value );
+
+        pool.free( handle );
+    } // for
+
+    EXPECT_TRUE( pool.empty() );
+    EXPECT_EQ( Tracked::live, 0 );
+    EXPECT_EQ( pool.high_water_mark(), high_water_mark );
+    EXPECT_EQ( pool.high_water_mark(), pool.capacity() );
+    EXPECT_EQ( pool.failed_allocations(), failed_allocations );
+}
@@ -0,0 +1,239 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Testing::Automated::Register_Trace automated tests.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "microlibrary/testing/automated/register.h"
+
+namespace {
+
+using ::microlibrary::Testing::Automated::Register_Access;
+using ::microlibrary::Testing::Automated::Register_Access_Type;
+using ::microlibrary::Testing::Automated::Register_Trace;
+using ::microlibrary::Testing::Automated::Register_Trace_Replay;
+using ::microlibrary::Testing::Automated::Register_Tracer;
+using ::microlibrary::Testing::Automated::Tracing_Register;
+
+/**
+ * \brief Peripheral with tracing registers.
+ */
+struct Peripheral {
+    Tracing_Register<std::uint8_t> a{};
+    Tracing_Register<std::uint8_t> b{};
+};
+
+/**
+ * \brief Access a peripheral's registers.
+ *
+ * \param[in] peripheral The peripheral whose registers will be accessed.
+ */
+void access( Peripheral & peripheral )
+{
+    peripheral.a = 0b1010'0101;
+    peripheral.b |= static_cast<std::uint8_t>( peripheral.a & 0b0000'1111 );
+    peripheral.a &= 0b1111'0000;
+    peripheral.b ^= 0b1000'0001;
+}
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace records accesses
+ *        properly.
+ */
+TEST( registerTrace, recordsAccesses )
+{
+    auto peripheral = Peripheral{};
+
+    auto const trace = Register_Trace{ 8, &peripheral };
+
+    EXPECT_EQ( Register_Tracer::active(), &trace );
+
+    access( peripheral );
+
+    EXPECT_EQ( peripheral.a.contents(), 0b1010'0000 );
+    EXPECT_EQ( peripheral.b.contents(), 0b1000'0100 );
+
+    EXPECT_EQ(
+        trace.accesses(),
+        ( std::vector<Register_Access>{
+            { 0, 0, Register_Access_Type::WRITE, 0b1010'0101 },
+            { 1, 0, Register_Access_Type::READ, 0b1010'0101 },
+            { 2, 1, Register_Access_Type::WRITE_OR, 0b0000'0101 },
+            { 3, 0, Register_Access_Type::WRITE_AND, 0b1111'0000 },
+            { 4, 1, Register_Access_Type::WRITE_XOR, 0b1000'0001 },
+        } ) );
+    EXPECT_EQ( trace.dropped(), 0 );
+
+    EXPECT_EQ( trace.counts( &peripheral.a ).reads, 2 );
+    EXPECT_EQ( trace.counts( &peripheral.a ).writes, 2 );
+    EXPECT_EQ( trace.counts( &peripheral.b ).reads, 2 );
+    EXPECT_EQ( trace.counts( &peripheral.b ).writes, 2 );
+    EXPECT_EQ( trace.counts().size(), 2 );
+}
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace drops the oldest
+ *        accesses when its ring buffer is full.
+ */
+TEST( registerTrace, dropsOldestAccesses )
+{
+    auto peripheral = Peripheral{};
+
+    auto trace = Register_Trace{ 2, &peripheral };
+
+    access( peripheral );
+
+    EXPECT_EQ( trace.capacity(), 2 );
+    EXPECT_EQ(
+        trace.accesses(),
+        ( std::vector<Register_Access>{
+            { 3, 0, Register_Access_Type::WRITE_AND, 0b1111'0000 },
+            { 4, 1, Register_Access_Type::WRITE_XOR, 0b1000'0001 },
+        } ) );
+    EXPECT_EQ( trace.dropped(), 3 );
+    EXPECT_EQ( trace.counts( &peripheral.a ).writes, 2 );
+
+    trace.clear();
+
+    EXPECT_TRUE( trace.accesses().empty() );
+    EXPECT_EQ( trace.dropped(), 0 );
+    EXPECT_TRUE( trace.counts().empty() );
+}
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace restores the previously
+ *        active tracer when it is destroyed.
+ */
+TEST( registerTrace, restoresPreviousTracer )
+{
+    EXPECT_EQ( Register_Tracer::active(), nullptr );
+
+    {
+        auto const outer = Register_Trace{ 1 };
+
+        {
+            auto const inner = Register_Trace{ 1 };
+
+            EXPECT_EQ( Register_Tracer::active(), &inner );
+        }
+
+        EXPECT_EQ( Register_Tracer::active(), &outer );
+    }
+
+    EXPECT_EQ( Register_Tracer::active(), nullptr );
+}
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace_Replay accepts a
+ *        matching access sequence and reports recorded read values.
+ */
+TEST( registerTraceReplay, matches )
+{
+    auto peripheral = Peripheral{};
+
+    auto const accesses = [ & ] {
+        auto const trace = Register_Trace{ 8, &peripheral };
+
+        access( peripheral );
+
+        return trace.accesses();
+    }();
+
+    auto replayed_peripheral = Peripheral{};
+
+    auto const replay = Register_Trace_Replay{ accesses, &replayed_peripheral };
+
+    EXPECT_FALSE( replay.complete() );
+
+    access( replayed_peripheral );
+
+    EXPECT_TRUE( replay.complete() );
+    EXPECT_TRUE( replay.mismatches().empty() );
+    EXPECT_TRUE( replay.matches() );
+}
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace_Replay reports the
+ *        recorded value for reads.
+ */
+TEST( registerTraceReplay, reportsRecordedReadValue )
+{
+    auto peripheral = Peripheral{};
+
+    auto const replay = Register_Trace_Replay{
+        { { 0, 1, Register_Access_Type::READ, 0b0110'1001 } }, &peripheral
+    };
+
+    EXPECT_EQ( static_cast<std::uint8_t>( peripheral.b ), 0b0110'1001 );
+    EXPECT_TRUE( replay.matches() );
+}
+
+/**
+ * \brief Verify microlibrary::Testing::Automated::Register_Trace_Replay reports
+ *        mismatched, unexpected, and missing accesses.
+ */
+TEST( registerTraceReplay, reportsMismatches )
+{
+    auto peripheral = Peripheral{};
+
+    {
+        auto const replay = Register_Trace_Replay{
+            {
+                { 0, 0, Register_Access_Type::WRITE, 0b1010'0101 },
+                { 1, 1, Register_Access_Type::WRITE, 0b0000'0000 },
+            },
+            &peripheral
+        };
+
+        peripheral.a = 0b1010'0101;
+        peripheral.b = 0b0000'0001;
+
+        EXPECT_TRUE( replay.complete() );
+        EXPECT_EQ( replay.mismatches().size(), 1 );
+        EXPECT_FALSE( replay.matches() );
+    }
+
+    {
+        auto const replay = Register_Trace_Replay{
+            { { 0, 0, Register_Access_Type::WRITE, 0b1010'0101 } }, &peripheral
+        };
+
+        peripheral.a = 0b1010'0101;
+        peripheral.a |= 0b0000'0001;
+
+        EXPECT_EQ( replay.mismatches().size(), 1 );
+        EXPECT_FALSE( replay.matches() );
+    }
+
+    {
+        auto const replay = Register_Trace_Replay{
+            { { 0, 0, Register_Access_Type::WRITE, 0b1010'0101 } }, &peripheral
+        };
+
+        EXPECT_TRUE( replay.mismatches().empty() );
+        EXPECT_FALSE( replay.complete() );
+        EXPECT_FALSE( replay.matches() );
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Register_Transaction automated tests.
+ */
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/register.h"
+
+namespace {
+
+using ::microlibrary::Register;
+using ::microlibrary::Register_Transaction;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::Register_Transaction( Register_Type &
+ *        ) reads the register once and does not write the register.
+ */
+TEST( constructor, readsRegister )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    EXPECT_CALL( reg, read() ).WillOnce( Return( 0b1010'0101 ) );
+    EXPECT_CALL( reg, write( _ ) ).Times( 0 );
+
+    auto const transaction = Register_Transaction{ reg };
+
+    EXPECT_EQ( transaction.value(), 0b1010'0101 );
+
+    EXPECT_EQ( reg.reads(), 1 );
+    EXPECT_EQ( reg.writes(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::Register_Transaction( Register_Type &,
+ *        Type ) does not access the register.
+ */
+TEST( constructor, doesNotReadRegister )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    EXPECT_CALL( reg, read() ).Times( 0 );
+    EXPECT_CALL( reg, write( _ ) ).Times( 0 );
+
+    auto const transaction = Register_Transaction{ reg, 0b0101'1010 };
+
+    EXPECT_EQ( transaction.value(), 0b0101'1010 );
+
+    EXPECT_EQ( reg.reads(), 0 );
+    EXPECT_EQ( reg.writes(), 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::modify() works properly.
+ */
+TEST( modify, worksProperly )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    auto transaction = Register_Transaction{ reg, 0b1111'0000 };
+
+    transaction.modify( 0b0011'1100, 0b1110'1011 );
+
+    EXPECT_EQ( transaction.value(), 0b1110'1000 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::set() works properly.
+ */
+TEST( set, worksProperly )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    auto transaction = Register_Transaction{ reg, 0b1100'0000 };
+
+    transaction.set( 0b0000'0110 );
+
+    EXPECT_EQ( transaction.value(), 0b1100'0110 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::clear() works properly.
+ */
+TEST( clear, worksProperly )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    auto transaction = Register_Transaction{ reg, 0b1111'1111 };
+
+    transaction.clear( 0b1000'0001 );
+
+    EXPECT_EQ( transaction.value(), 0b0111'1110 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction assignment and compound assignment
+ *        operators work properly.
+ */
+TEST( assignment, worksProperly )
+{
+    auto reg = Register<std::uint8_t>{};
+
+    auto transaction = Register_Transaction{ reg, 0b0000'0000 };
+
+    transaction = 0b1100'1100;
+    EXPECT_EQ( transaction.value(), 0b1100'1100 );
+
+    transaction &= 0b1010'1010;
+    EXPECT_EQ( transaction.value(), 0b1000'1000 );
+
+    transaction |= 0b0000'0011;
+    EXPECT_EQ( transaction.value(), 0b1000'1011 );
+
+    transaction ^= 0b1000'0001;
+    EXPECT_EQ( transaction.value(), 0b0000'1010 );
+
+    EXPECT_EQ( static_cast<std::uint8_t>( transaction ), 0b0000'1010 );
+}
+
+/**
+ * \brief Verify microlibrary::Register_Transaction::commit() coalesces multiple field
+ *        updates into a single register read and a single register write.
+ */
+TEST( commit, coalescesAccesses )
+{
+    auto const in_sequence = InSequence{};
+
+    auto reg = Register<std::uint8_t>{};
+
+    EXPECT_CALL( reg, read() ).WillOnce( Return( 0b1001'0110 ) );
+    EXPECT_CALL( reg, write( 0b0101'1101 ) );
+
+    auto transaction = Register_Transaction{ reg };
+
+    transaction.modify( 0b0000'0110, 0b0000'0100 );
+    transaction.set( 0b0000'1001 );
+    transaction.clear( 0b1000'0000 );
+    transaction.modify( 0b0111'0000, 0b0101'0000 );
+
+    transaction.commit();
+
+    EXPECT_EQ( reg.reads(), 1 );
+    EXPECT_EQ( reg.writes(), 1 );
+}
@@ -0,0 +1,188 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Ring_Buffer automated tests.
+ */
+
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "microlibrary/error.h"
+#include "microlibrary/ring_buffer.h"
+
+namespace {
+
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Ring_Buffer;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer::Index is sized properly.
+ */
+TEST( index, sizedProperly )
+{
+    EXPECT_TRUE( ( std::is_same_v<Ring_Buffer<char, 1>::Index, std::uint8_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Ring_Buffer<char, 128>::Index, std::uint8_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Ring_Buffer<char, 256>::Index, std::uint16_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Ring_Buffer<char, 32768>::Index, std::uint16_t> ) );
+    EXPECT_TRUE( ( std::is_same_v<Ring_Buffer<char, 65536>::Index, std::uint32_t> ) );
+}
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer::push( microlibrary::Ring_Buffer::Value const &
+ *        ) properly handles a full ring buffer.
+ */
+TEST( pushErrorHandling, full )
+{
+    auto ring_buffer = Ring_Buffer<std::uint16_t, 4>{};
+
+    for ( auto const value : { 0x4A3E, 0x9C01, 0x1F7B, 0xE285 } ) {
+        EXPECT_FALSE( ring_buffer.push( value ).is_error() );
+    } // for
+
+    EXPECT_TRUE( ring_buffer.full() );
+
+    auto const result = ring_buffer.push( 0x63D9 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( ring_buffer.size(), 4 );
+}
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer::pop() properly handles an empty ring buffer.
+ */
+TEST( popErrorHandling, empty )
+{
+    auto ring_buffer = Ring_Buffer<std::uint16_t, 4>{};
+
+    EXPECT_TRUE( ring_buffer.empty() );
+
+    auto const result = ring_buffer.pop();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_UNDERFLOW );
+}
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer::push( microlibrary::Ring_Buffer::Value const &
+ *        ) and microlibrary::Ring_Buffer::pop() work properly.
+ */
+TEST( pushPop, worksProperly )
+{
+    auto ring_buffer = Ring_Buffer<std::uint8_t, 8>{};
+
+    auto expected = std::uint8_t{ 0 };
+    auto next     = std::uint8_t{ 0 };
+
+    // run enough iterations to wrap the free running indices several times
+    for ( auto i = 0; i < 1000; ++i ) {
+        for ( auto j = 0; j < 5; ++j ) {
+            ASSERT_FALSE( ring_buffer.push( next++ ).is_error() );
+        } // for
+
+        ASSERT_EQ( ring_buffer.size(), 5 );
+
+        for ( auto j = 0; j < 5; ++j ) {
+            auto const result = ring_buffer.pop();
+
+            ASSERT_FALSE( result.is_error() );
+            ASSERT_EQ( result.value(), expected++ );
+        } // for
+
+        ASSERT_TRUE( ring_buffer.empty() );
+    } // for
+}
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer::push( microlibrary::Ring_Buffer::Const_Pointer,
+ *        microlibrary::Ring_Buffer::Const_Pointer ) and microlibrary::Ring_Buffer::pop(
+ *        microlibrary::Ring_Buffer::Pointer, microlibrary::Ring_Buffer::Pointer ) work
+ *        properly.
+ */
+TEST( pushPopBlock, worksProperly )
+{
+    auto ring_buffer = Ring_Buffer<std::uint8_t, 8>{};
+
+    auto const a = std::vector<std::uint8_t>{ 0x1D, 0xB7, 0x40, 0x8E, 0xF2 };
+    auto const b = std::vector<std::uint8_t>{ 0x35, 0xC9, 0x6A, 0x04, 0x91, 0x7F };
+
+    EXPECT_EQ( ring_buffer.push( a.data(), a.data() + a.size() ), a.data() + a.size() );
+
+    auto popped = std::vector<std::uint8_t>( 3 );
+
+    EXPECT_EQ( ring_buffer.pop( popped.data(), popped.data() + popped.size() ), popped.data() + 3 );
+    EXPECT_EQ( popped, ( std::vector<std::uint8_t>{ 0x1D, 0xB7, 0x40 } ) );
+
+    // only 6 of the elements fit, and the block wraps around the end of the storage
+    EXPECT_EQ( ring_buffer.push( b.data(), b.data() + b.size() ), b.data() + 6 );
+    EXPECT_TRUE( ring_buffer.full() );
+
+    popped.resize( 10 );
+
+    EXPECT_EQ( ring_buffer.pop( popped.data(), popped.data() + popped.size() ), popped.data() + 8 );
+    popped.resize( 8 );
+    EXPECT_EQ(
+        popped, ( std::vector<std::uint8_t>{ 0x8E, 0xF2, 0x35, 0xC9, 0x6A, 0x04, 0x91, 0x7F } ) );
+    EXPECT_TRUE( ring_buffer.empty() );
+}
+
+/**
+ * \brief Verify microlibrary::Ring_Buffer works properly when shared between a producer
+ *        thread and a consumer thread.
+ */
+TEST( singleProducerSingleConsumer, worksProperly )
+{
+    auto ring_buffer = Ring_Buffer<std::uint32_t, 64>{};
+
+    auto const count = std::uint32_t{ 20000 };
+
+    auto producer = std::thread{ [ &ring_buffer, count ]() {
+        for ( auto value = std::uint32_t{ 0 }; value < count; ) {
+            if ( ring_buffer.push( value ).is_error() ) {
+                std::this_thread::yield();
+            } else {
+                ++value;
+            } // else
+        }     // for
+    } };
+
+    auto consumed = std::vector<std::uint32_t>{};
+    consumed.reserve( count );
+
+    while ( consumed.size() < count ) {
+        auto const result = ring_buffer.pop();
+        if ( result.is_error() ) {
+            std::this_thread::yield();
+        } else {
+            consumed.push_back( result.value() );
+        } // else
+    }     // while
+
+    producer.join();
+
+    for ( auto i = std::uint32_t{ 0 }; i < count; ++i ) {
+        ASSERT_EQ( consumed[ i ], i );
+    } // for
+}
@@ -0,0 +1,370 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary Serial Line Internet Protocol (SLIP) framing automated tests.
+ */
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/slip.h"
+#include "microlibrary/testing/automated/error.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver;
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Result;
+using ::microlibrary::SLIP_Decoder;
+using ::microlibrary::SLIP_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Fault_Reporting_Vector_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Mock_Error;
+using ::microlibrary::Testing::Automated::Mock_Fault_Reporting_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Vector_Stream_IO_Driver;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+} // namespace
+
+/**
+ * \brief SLIP test case.
+ */
+struct SLIP_Test_Case {
+    /**
+     * \brief The frame.
+     */
+    std::vector<std::uint8_t> frame;
+
+    /**
+     * \brief The encoded frame.
+     */
+    std::vector<std::uint8_t> encoded_frame;
+};
+
+auto operator<<( std::ostream & stream, SLIP_Test_Case const & test_case ) -> std::ostream &
+{
+    return stream << "{ .frame.size() = " << test_case.frame.size()
+                  << ", .encoded_frame.size() = " << test_case.encoded_frame.size() << " }";
+}
+
+/**
+ * \brief SLIP test cases.
+ */
+SLIP_Test_Case const SLIP_TEST_CASES[]{
+    // clang-format off
+
+    { { 0x00 },                         { 0x00, 0xC0 } },
+    { { 0x11, 0x22, 0x33 },             { 0x11, 0x22, 0x33, 0xC0 } },
+    { { 0xC0 },                         { 0xDB, 0xDC, 0xC0 } },
+    { { 0xDB },                         { 0xDB, 0xDD, 0xC0 } },
+    { { 0xDC, 0xDD },                   { 0xDC, 0xDD, 0xC0 } },
+    { { 0xC0, 0xDB, 0xC0 },             { 0xDB, 0xDC, 0xDB, 0xDD, 0xDB, 0xDC, 0xC0 } },
+    { { 0x11, 0xC0, 0x22, 0xDB, 0x33 }, { 0x11, 0xDB, 0xDC, 0x22, 0xDB, 0xDD, 0x33, 0xC0 } },
+
+    // clang-format on
+};
+
+/**
+ * \brief microlibrary::SLIP_Stream_IO_Driver test fixture.
+ */
+class slipStreamIODriver : public TestWithParam<SLIP_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::SLIP_Stream_IO_Driver::put( std::uint8_t const *,
+ *        std::uint8_t const * ) and microlibrary::SLIP_Stream_IO_Driver::end_frame() work
+ *        properly.
+ */
+TEST_P( slipStreamIODriver, worksProperlyBlock )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto slip_driver = SLIP_Stream_IO_Driver{ driver };
+
+    slip_driver.put( test_case.frame.data(), test_case.frame.data() + test_case.frame.size() );
+    slip_driver.end_frame();
+
+    EXPECT_FALSE( slip_driver.frame_in_progress() );
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+/**
+ * \brief Verify microlibrary::SLIP_Stream_IO_Driver::put( std::uint8_t ) and
+ *        microlibrary::SLIP_Stream_IO_Driver::end_frame() work properly.
+ */
+TEST_P( slipStreamIODriver, worksProperlyByte )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto slip_driver = SLIP_Stream_IO_Driver{ driver };
+
+    for ( auto const byte : test_case.frame ) { slip_driver.put( byte ); } // for
+    slip_driver.end_frame();
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+INSTANTIATE_TEST_SUITE_P(, slipStreamIODriver, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::SLIP_Stream_IO_Driver::flush() works properly.
+ */
+TEST( slipStreamIODriverFlush, worksProperly )
+{
+    auto driver = Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto slip_driver = SLIP_Stream_IO_Driver{ driver };
+
+    slip_driver.flush();
+
+    EXPECT_TRUE( driver.vector().empty() );
+
+    auto const string = std::string_view{ "A\xC0" };
+
+    slip_driver.put( string.begin(), string.end() );
+
+    EXPECT_TRUE( slip_driver.frame_in_progress() );
+
+    slip_driver.flush();
+    slip_driver.flush();
+
+    EXPECT_FALSE( slip_driver.frame_in_progress() );
+    EXPECT_EQ( driver.vector(), ( std::vector<std::uint8_t>{ 'A', 0xDB, 0xDC, 0xC0 } ) );
+}
+
+/**
+ * \brief microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver test fixture.
+ */
+class faultReportingSLIPStreamIODriver : public TestWithParam<SLIP_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) and
+ *        microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::end_frame() work properly.
+ */
+TEST_P( faultReportingSLIPStreamIODriver, worksProperlyBlock )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Fault_Reporting_Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto slip_driver = Fault_Reporting_SLIP_Stream_IO_Driver{ driver };
+
+    EXPECT_FALSE( slip_driver.put( test_case.frame.data(), test_case.frame.data() + test_case.frame.size() ).is_error() );
+    EXPECT_FALSE( slip_driver.end_frame().is_error() );
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::put( std::uint8_t )
+ *        and microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::end_frame() work
+ *        properly.
+ */
+TEST_P( faultReportingSLIPStreamIODriver, worksProperlyByte )
+{
+    auto const test_case = GetParam();
+
+    auto driver = Fault_Reporting_Vector_Stream_IO_Driver<std::uint8_t>{};
+
+    auto slip_driver = Fault_Reporting_SLIP_Stream_IO_Driver{ driver };
+
+    for ( auto const byte : test_case.frame ) {
+        EXPECT_FALSE( slip_driver.put( byte ).is_error() );
+    } // for
+    EXPECT_FALSE( slip_driver.end_frame().is_error() );
+
+    EXPECT_EQ( driver.vector(), test_case.encoded_frame );
+}
+
+INSTANTIATE_TEST_SUITE_P(, faultReportingSLIPStreamIODriver, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::put( std::uint8_t
+ *        const *, std::uint8_t const * ) properly handles a put error.
+ */
+TEST( faultReportingSLIPStreamIODriverPutDataBlockErrorHandling, putError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto slip_driver = Fault_Reporting_SLIP_Stream_IO_Driver{ driver };
+
+    auto const error = Mock_Error{ 212 };
+
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0x11, 0x22 } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( driver, put( std::vector<std::uint8_t>{ 0xDB, 0xDC } ) ).WillOnce( Return( error ) );
+
+    auto const data = std::vector<std::uint8_t>{ 0x11, 0x22, 0xC0, 0x33 };
+
+    auto const result = slip_driver.put( data.data(), data.data() + data.size() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify microlibrary::Fault_Reporting_SLIP_Stream_IO_Driver::flush() properly
+ *        handles a flush error.
+ */
+TEST( faultReportingSLIPStreamIODriverFlushErrorHandling, flushError )
+{
+    auto driver = Mock_Fault_Reporting_Stream_IO_Driver{};
+
+    auto slip_driver = Fault_Reporting_SLIP_Stream_IO_Driver{ driver };
+
+    auto const error = Mock_Error{ 64 };
+
+    EXPECT_CALL( driver, flush() ).WillOnce( Return( error ) );
+
+    auto const result = slip_driver.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief microlibrary::SLIP_Decoder::decode() test fixture.
+ */
+class slipDecoderDecode : public TestWithParam<SLIP_Test_Case> {
+};
+
+/**
+ * \brief Verify microlibrary::SLIP_Decoder::decode() works properly.
+ */
+TEST_P( slipDecoderDecode, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto decoder = SLIP_Decoder<16>{};
+
+    for ( auto repetition = 0; repetition < 2; ++repetition ) {
+        for ( auto byte = test_case.encoded_frame.begin(); byte != test_case.encoded_frame.end(); ++byte ) {
+            auto const result = decoder.decode( *byte );
+
+            ASSERT_FALSE( result.is_error() );
+            EXPECT_EQ( result.value(), byte + 1 == test_case.encoded_frame.end() );
+        } // for
+
+        EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), test_case.frame );
+    } // for
+}
+
+INSTANTIATE_TEST_SUITE_P(, slipDecoderDecode, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief Verify microlibrary::SLIP_Decoder::decode() ignores empty frames.
+ */
+TEST( slipDecoderDecodeEmptyFrames, ignored )
+{
+    auto decoder = SLIP_Decoder<8>{};
+
+    for ( auto const byte : std::vector<std::uint8_t>{ 0xC0, 0xC0, 0x11, 0x22 } ) {
+        auto const result = decoder.decode( byte );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_FALSE( result.value() );
+    } // for
+
+    auto const result = decoder.decode( 0xC0 );
+
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_TRUE( result.value() );
+    EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), ( std::vector<std::uint8_t>{ 0x11, 0x22 } ) );
+}
+
+/**
+ * \brief Verify microlibrary::SLIP_Decoder::decode() properly handles a frame that does
+ *        not fit in the frame buffer.
+ */
+TEST( slipDecoderDecodeErrorHandling, frameTooLarge )
+{
+    auto decoder = SLIP_Decoder<2>{};
+
+    EXPECT_FALSE( decoder.decode( 0x11 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x22 ).is_error() );
+
+    auto const result = decoder.decode( 0x33 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_FALSE( decoder.decode( 0x44 ).value() );
+    EXPECT_FALSE( decoder.decode( 0xC0 ).value() );
+
+    EXPECT_FALSE( decoder.decode( 0x55 ).value() );
+    EXPECT_TRUE( decoder.decode( 0xC0 ).value() );
+    EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), ( std::vector<std::uint8_t>{ 0x55 } ) );
+}
+
+/**
+ * \brief Verify microlibrary::SLIP_Decoder::decode() properly handles an invalid escape
+ *        sequence.
+ */
+TEST( slipDecoderDecodeErrorHandling, invalidEscapeSequence )
+{
+    auto decoder = SLIP_Decoder<8>{};
+
+    EXPECT_FALSE( decoder.decode( 0x11 ).value() );
+    EXPECT_FALSE( decoder.decode( 0xDB ).value() );
+
+    auto const result = decoder.decode( 0x22 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+
+    EXPECT_FALSE( decoder.decode( 0xC0 ).value() );
+
+    EXPECT_FALSE( decoder.decode( 0x33 ).value() );
+    EXPECT_TRUE( decoder.decode( 0xC0 ).value() );
+    EXPECT_EQ( std::vector<std::uint8_t>( decoder.begin(), decoder.end() ), ( std::vector<std::uint8_t>{ 0x33 } ) );
+}
+
+/**
+ * \brief Verify microlibrary::SLIP_Decoder::decode() properly handles a frame that ends
+ *        with an incomplete escape sequence.
+ */
+TEST( slipDecoderDecodeErrorHandling, incompleteEscapeSequence )
+{
+    auto decoder = SLIP_Decoder<8>{};
+
+    EXPECT_FALSE( decoder.decode( 0x11 ).value() );
+    EXPECT_FALSE( decoder.decode( 0xDB ).value() );
+
+    auto const result = decoder.decode( 0xC0 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    EXPECT_EQ( decoder.size(), 0 );
+}
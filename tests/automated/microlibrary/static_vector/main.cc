@@ -0,0 +1,406 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Static_Vector automated tests.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "microlibrary/algorithm.h"
+#include "microlibrary/error.h"
+#include "microlibrary/static_vector.h"
+
+namespace {
+
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Static_Vector;
+
+/**
+ * \brief Element that tracks the number of live instances.
+ */
+class Tracked {
+  public:
+    /**
+     * \brief The number of live instances.
+     */
+    static inline auto live = 0;
+
+    Tracked() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] a The first value component.
+     * \param[in] b The second value component.
+     */
+    Tracked( int a, int b ) noexcept : m_value{ a * 100 + b }
+    {
+        ++live;
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Tracked( Tracked && source ) noexcept : m_value{ source.m_value }
+    {
+        source.m_value = -1;
+
+        ++live;
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Tracked( Tracked const & original ) noexcept : m_value{ original.m_value }
+    {
+        ++live;
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tracked() noexcept
+    {
+        --live;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Tracked && expression ) noexcept -> Tracked &
+    {
+        m_value            = expression.m_value;
+        expression.m_value = -1;
+
+        return *this;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Tracked const & expression ) noexcept -> Tracked & = default;
+
+    /**
+     * \brief Get the value.
+     *
+     * \return The value.
+     */
+    auto value() const noexcept
+    {
+        return m_value;
+    }
+
+  private:
+    /**
+     * \brief The value.
+     */
+    int m_value;
+};
+
+/**
+ * \brief Get the values of a vector's elements.
+ *
+ * \tparam N The vector capacity.
+ *
+ * \param[in] vector The vector whose element values are to be gotten.
+ *
+ * \return The values of the vector's elements.
+ */
+template<std::size_t N>
+auto values( Static_Vector<Tracked, N> const & vector ) -> Static_Vector<int, N>
+{
+    auto result = Static_Vector<int, N>{};
+
+    for ( auto const & element : vector ) { static_cast<void>( result.push_back( element.value() ) ); } // for
+
+    return result;
+}
+
+/**
+ * \brief Create a vector from a list of values.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The vector capacity.
+ *
+ * \param[in] list The values to add to the vector.
+ *
+ * \return The created vector.
+ */
+template<typename T, std::size_t N>
+auto make( std::initializer_list<T> list ) -> Static_Vector<T, N>
+{
+    auto vector = Static_Vector<T, N>{};
+
+    for ( auto const & value : list ) { static_cast<void>( vector.push_back( value ) ); } // for
+
+    return vector;
+}
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Static_Vector is trivially destructible if its element type
+ *        is trivially destructible.
+ */
+TEST( destructor, triviallyDestructible )
+{
+    EXPECT_TRUE( ( std::is_trivially_destructible_v<Static_Vector<std::uint8_t, 4>> ) );
+    EXPECT_FALSE( ( std::is_trivially_destructible_v<Static_Vector<Tracked, 4>> ) );
+
+    EXPECT_EQ( sizeof( Static_Vector<std::uint8_t, 4> ), 5 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::~Static_Vector() destroys the vector's
+ *        elements.
+ */
+TEST( destructor, destroysElements )
+{
+    Tracked::live = 0;
+
+    {
+        auto vector = Static_Vector<Tracked, 4>{};
+
+        EXPECT_FALSE( vector.emplace_back( 1, 2 ).is_error() );
+        EXPECT_FALSE( vector.emplace_back( 3, 4 ).is_error() );
+
+        EXPECT_EQ( Tracked::live, 2 );
+    }
+
+    EXPECT_EQ( Tracked::live, 0 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::push_back() properly handles a full vector.
+ */
+TEST( pushBackErrorHandling, full )
+{
+    auto vector = Static_Vector<std::uint16_t, 3>{};
+
+    for ( auto const value : { 0x4A3E, 0x9C01, 0x1F7B } ) {
+        EXPECT_FALSE( vector.push_back( value ).is_error() );
+    } // for
+
+    EXPECT_TRUE( vector.full() );
+
+    auto const result = vector.push_back( 0xE285 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( vector, ( make<std::uint16_t, 3>( { 0x4A3E, 0x9C01, 0x1F7B } ) ) );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::emplace_back() works properly.
+ */
+TEST( emplaceBack, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto vector = Static_Vector<Tracked, 2>{};
+
+    EXPECT_TRUE( vector.empty() );
+
+    EXPECT_FALSE( vector.emplace_back( 5, 7 ).is_error() );
+    EXPECT_FALSE( vector.emplace_back( 2, 9 ).is_error() );
+
+    auto const result = vector.emplace_back( 1, 1 );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( Tracked::live, 2 );
+    EXPECT_EQ( vector.size(), 2 );
+    EXPECT_EQ( vector.front().value(), 507 );
+    EXPECT_EQ( vector.back().value(), 209 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::insert() works properly.
+ */
+TEST( insert, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto vector = Static_Vector<Tracked, 5>{};
+
+    auto result = vector.insert( vector.end(), Tracked{ 0, 3 } );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), vector.begin() );
+
+    result = vector.insert( vector.begin(), Tracked{ 0, 1 } );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), vector.begin() );
+
+    result = vector.insert( vector.begin() + 1, Tracked{ 0, 2 } );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), vector.begin() + 1 );
+
+    result = vector.insert( vector.end(), Tracked{ 0, 5 } );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), vector.begin() + 3 );
+
+    result = vector.insert( vector.end() - 1, Tracked{ 0, 4 } );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), vector.begin() + 3 );
+
+    EXPECT_EQ( values( vector ), ( make<int, 5>( { 1, 2, 3, 4, 5 } ) ) );
+    EXPECT_EQ( Tracked::live, 5 );
+
+    result = vector.insert( vector.begin(), Tracked{ 0, 6 } );
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_OVERFLOW );
+
+    EXPECT_EQ( values( vector ), ( make<int, 5>( { 1, 2, 3, 4, 5 } ) ) );
+    EXPECT_EQ( Tracked::live, 5 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::erase() works properly.
+ */
+TEST( erase, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto vector = Static_Vector<Tracked, 6>{};
+
+    for ( auto i = 1; i <= 6; ++i ) { EXPECT_FALSE( vector.emplace_back( 0, i ).is_error() ); } // for
+
+    EXPECT_EQ( vector.erase( vector.begin() + 1 ), vector.begin() + 1 );
+    EXPECT_EQ( values( vector ), ( make<int, 6>( { 1, 3, 4, 5, 6 } ) ) );
+    EXPECT_EQ( Tracked::live, 5 );
+
+    EXPECT_EQ( vector.erase( vector.begin() + 1, vector.begin() + 3 ), vector.begin() + 1 );
+    EXPECT_EQ( values( vector ), ( make<int, 6>( { 1, 5, 6 } ) ) );
+    EXPECT_EQ( Tracked::live, 3 );
+
+    EXPECT_EQ( vector.erase( vector.begin(), vector.begin() ), vector.begin() );
+    EXPECT_EQ( Tracked::live, 3 );
+
+    auto const following = vector.erase( vector.end() - 1 );
+    EXPECT_EQ( following, vector.end() );
+    EXPECT_EQ( values( vector ), ( make<int, 6>( { 1, 5 } ) ) );
+    EXPECT_EQ( Tracked::live, 2 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector::pop_back() and
+ *        microlibrary::Static_Vector::clear() work properly.
+ */
+TEST( popBackClear, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto vector = Static_Vector<Tracked, 4>{};
+
+    for ( auto i = 1; i <= 4; ++i ) { EXPECT_FALSE( vector.emplace_back( 0, i ).is_error() ); } // for
+
+    vector.pop_back();
+
+    EXPECT_EQ( values( vector ), ( make<int, 4>( { 1, 2, 3 } ) ) );
+    EXPECT_EQ( Tracked::live, 3 );
+
+    vector.clear();
+
+    EXPECT_TRUE( vector.empty() );
+    EXPECT_EQ( Tracked::live, 0 );
+
+    EXPECT_FALSE( vector.emplace_back( 0, 9 ).is_error() );
+    EXPECT_EQ( values( vector ), ( make<int, 4>( { 9 } ) ) );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector copy and move construction and assignment work
+ *        properly.
+ */
+TEST( copyMove, worksProperly )
+{
+    Tracked::live = 0;
+
+    auto a = Static_Vector<Tracked, 4>{};
+    EXPECT_FALSE( a.emplace_back( 1, 2 ).is_error() );
+    EXPECT_FALSE( a.emplace_back( 3, 4 ).is_error() );
+
+    auto b = a;
+    EXPECT_EQ( values( a ), values( b ) );
+    EXPECT_EQ( Tracked::live, 4 );
+
+    auto c = std::move( a );
+    EXPECT_EQ( values( c ), values( b ) );
+    EXPECT_EQ( Tracked::live, 6 );
+
+    auto d = Static_Vector<Tracked, 4>{};
+    EXPECT_FALSE( d.emplace_back( 5, 6 ).is_error() );
+    EXPECT_NE( values( d ), values( b ) );
+
+    d = b;
+    EXPECT_EQ( values( d ), values( b ) );
+    EXPECT_EQ( Tracked::live, 8 );
+
+    d = std::move( c );
+    EXPECT_EQ( values( d ), values( b ) );
+    EXPECT_EQ( Tracked::live, 8 );
+}
+
+/**
+ * \brief Verify microlibrary::Static_Vector works with the microlibrary algorithms.
+ */
+TEST( algorithms, worksProperly )
+{
+    auto vector = Static_Vector<std::uint8_t, 8>{};
+
+    EXPECT_FALSE( vector.push_back( 0 ).is_error() );
+    EXPECT_FALSE( vector.push_back( 0 ).is_error() );
+    EXPECT_FALSE( vector.push_back( 0 ).is_error() );
+
+    ::microlibrary::fill( vector.begin(), vector.end(), 0x5A );
+
+    EXPECT_EQ( vector, ( make<std::uint8_t, 8>( { 0x5A, 0x5A, 0x5A } ) ) );
+
+    auto next = std::uint8_t{ 0x10 };
+    ::microlibrary::generate( vector.begin(), vector.end(), [ &next ]() { return next++; } );
+
+    auto sum = 0;
+    ::microlibrary::for_each( vector.rbegin(), vector.rend(), [ &sum ]( auto value ) { sum = sum * 0x100 + value; } );
+
+    EXPECT_EQ( sum, 0x12'11'10 );
+
+    auto const expected = make<std::uint8_t, 8>( { 0x10, 0x11, 0x12 } );
+
+    EXPECT_TRUE( ::microlibrary::equal( vector.begin(), vector.end(), expected.begin(), expected.end() ) );
+    EXPECT_FALSE( ::microlibrary::equal( vector.begin(), vector.end(), expected.begin(), expected.end() - 1 ) );
+}
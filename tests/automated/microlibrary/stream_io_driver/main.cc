@@ -21,6 +21,8 @@
  */
 
 #include <cstdint>
+#include <iterator>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -31,6 +33,7 @@
 
 namespace {
 
+using ::microlibrary::Character_Block;
 using ::microlibrary::Testing::Automated::Mock_Stream_IO_Driver;
 using ::testing::Eq;
 using ::testing::InSequence;
@@ -93,3 +96,40 @@ TEST( putDataBlock, worksProperly )
 
     driver.Stream_IO_Driver::put( &*values.begin(), &*values.end() );
 }
+
+/**
+ * \brief Verify microlibrary::Stream_IO_Driver::put( microlibrary::Character_Block const
+ *        *, microlibrary::Character_Block const * ) works properly.
+ */
+TEST( putCharBlockList, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto driver = Mock_Stream_IO_Driver{};
+
+    auto const a = std::string_view{ "Xh0" };
+    auto const b = std::string_view{ "" };
+    auto const c = std::string_view{ "p4GyM" };
+
+    Character_Block const blocks[]{
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+        { c.begin(), c.end() },
+    };
+
+    EXPECT_CALL( driver, put( std::string{ a } ) );
+    EXPECT_CALL( driver, put( std::string{ b } ) );
+    EXPECT_CALL( driver, put( std::string{ c } ) );
+
+    driver.Stream_IO_Driver::put( std::begin( blocks ), std::end( blocks ) );
+}
+
+/**
+ * \brief Verify microlibrary::Stream_IO_Driver::reserve() works properly.
+ */
+TEST( reserve, worksProperly )
+{
+    auto driver = Mock_Stream_IO_Driver{};
+
+    EXPECT_EQ( driver.Stream_IO_Driver::reserve( 17 ), nullptr );
+}
@@ -0,0 +1,218 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Tee_Stream_IO_Driver automated tests.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/tee_stream_io_driver.h"
+#include "microlibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::microlibrary::Character_Block;
+using ::microlibrary::Tee_Stream_IO_Driver;
+using ::microlibrary::Testing::Automated::Mock_Stream_IO_Driver;
+using ::testing::A;
+using ::testing::TypedEq;
+
+} // namespace
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver sink enable mask management works
+ *        properly.
+ */
+TEST( mask, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+    auto sink_c = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b, sink_c };
+
+    static_assert( decltype( driver )::sinks() == 3 );
+
+    EXPECT_EQ( driver.mask(), 0b111 );
+
+    driver.disable( 1 );
+
+    EXPECT_EQ( driver.mask(), 0b101 );
+    EXPECT_TRUE( driver.is_enabled( 0 ) );
+    EXPECT_FALSE( driver.is_enabled( 1 ) );
+    EXPECT_TRUE( driver.is_enabled( 2 ) );
+
+    driver.enable( 1 );
+
+    EXPECT_EQ( driver.mask(), 0b111 );
+
+    driver.set_mask( 0b1010 );
+
+    EXPECT_EQ( driver.mask(), 0b010 );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( char ) works properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+    auto sink_c = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b, sink_c };
+
+    driver.disable( 1 );
+
+    auto const character = 'X';
+
+    EXPECT_CALL( sink_a, put( TypedEq<char>( character ) ) );
+    EXPECT_CALL( sink_b, put( A<char>() ) ).Times( 0 );
+    EXPECT_CALL( sink_c, put( TypedEq<char>( character ) ) );
+
+    driver.put( character );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( char const *, char const * )
+ *        works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const string = std::string_view{ "7Wq0cLzN" };
+
+    EXPECT_CALL( sink_a, put( std::string{ string } ) );
+    EXPECT_CALL( sink_b, put( std::string{ string } ) );
+
+    driver.put( string.begin(), string.end() );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( char const * ) works properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    driver.disable( 0 );
+
+    auto const string = "rB3uE";
+
+    EXPECT_CALL( sink_a, put( A<std::string>() ) ).Times( 0 );
+    EXPECT_CALL( sink_b, put( std::string{ string } ) );
+
+    driver.put( string );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( std::uint8_t ) works properly.
+ */
+TEST( putData, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const data = std::uint8_t{ 0x9C };
+
+    EXPECT_CALL( sink_a, put( TypedEq<std::uint8_t>( data ) ) );
+    EXPECT_CALL( sink_b, put( TypedEq<std::uint8_t>( data ) ) );
+
+    driver.put( data );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( std::uint8_t const *,
+ *        std::uint8_t const * ) works properly.
+ */
+TEST( putDataBlock, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const data = std::vector<std::uint8_t>{ 0x4E, 0x02, 0xD7, 0x61 };
+
+    EXPECT_CALL( sink_a, put( data ) );
+    EXPECT_CALL( sink_b, put( data ) );
+
+    driver.put( &*data.begin(), &*data.begin() + data.size() );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::put( Character_Block const *,
+ *        Character_Block const * ) works properly.
+ */
+TEST( putCharacterBlocks, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    auto const a = std::string_view{ "Jd5" };
+    auto const b = std::string_view{ "o8Ky1" };
+
+    Character_Block const blocks[] = {
+        { a.begin(), a.end() },
+        { b.begin(), b.end() },
+    };
+
+    auto const expected = std::vector<std::string>{ std::string{ a }, std::string{ b } };
+
+    EXPECT_CALL( sink_a, put( expected ) );
+    EXPECT_CALL( sink_b, put( expected ) );
+
+    driver.put( std::begin( blocks ), std::end( blocks ) );
+}
+
+/**
+ * \brief Verify microlibrary::Tee_Stream_IO_Driver::flush() works properly.
+ */
+TEST( flush, worksProperly )
+{
+    auto sink_a = Mock_Stream_IO_Driver{};
+    auto sink_b = Mock_Stream_IO_Driver{};
+
+    auto driver = Tee_Stream_IO_Driver{ sink_a, sink_b };
+
+    driver.disable( 1 );
+
+    EXPECT_CALL( sink_a, flush() );
+    EXPECT_CALL( sink_b, flush() ).Times( 0 );
+
+    driver.flush();
+}
@@ -0,0 +1,183 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary algorithms benchmarks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "microlibrary/algorithm.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Testing::Benchmark::clobber_memory;
+using ::microlibrary::Testing::Benchmark::do_not_optimize;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief Benchmarked range sizes, in bytes.
+ */
+constexpr std::size_t SIZES[]{ 15, 256, 4096 };
+
+/**
+ * \brief Benchmarked range offsets from a word boundary, in bytes.
+ */
+constexpr std::size_t OFFSETS[]{ 0, 1 };
+
+/**
+ * \brief Get a benchmark name.
+ *
+ * \param[in] algorithm The benchmarked algorithm.
+ * \param[in] iterator The benchmarked iterator type.
+ * \param[in] size The benchmarked range size.
+ * \param[in] offset The benchmarked range offset.
+ *
+ * \return The benchmark name.
+ */
+auto name( char const * algorithm, char const * iterator, std::size_t size, std::size_t offset )
+    -> std::string
+{
+    return std::string{ algorithm } + '/' + iterator + "/size:" + std::to_string( size )
+           + "/offset:" + std::to_string( offset );
+}
+
+/**
+ * \brief Add the benchmarks for a range size and offset.
+ *
+ * Each algorithm is benchmarked with pointers (processed a word at a time when supported)
+ * and with non-pointer iterators (processed an element at a time).
+ *
+ * \param[in] suite The suite to add the benchmarks to.
+ * \param[in] size The benchmarked range size.
+ * \param[in] offset The benchmarked range offset.
+ */
+void add( Suite & suite, std::size_t size, std::size_t offset )
+{
+    using Buffer = std::vector<std::uint8_t>;
+
+    suite.add(
+        name( "fill", "pointer", size, offset ),
+        size,
+        [ buffer = Buffer( offset + size ), offset ]( std::uint64_t iterations ) mutable {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                ::microlibrary::fill(
+                    buffer.data() + offset, buffer.data() + buffer.size(), static_cast<std::uint8_t>( i ) );
+                clobber_memory();
+            } // for
+        } );
+
+    suite.add(
+        name( "fill", "iterator", size, offset ),
+        size,
+        [ buffer = Buffer( offset + size ), offset ]( std::uint64_t iterations ) mutable {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                ::microlibrary::fill( buffer.begin() + offset, buffer.end(), static_cast<std::uint8_t>( i ) );
+                clobber_memory();
+            } // for
+        } );
+
+    suite.add(
+        name( "equal", "pointer", size, offset ),
+        size,
+        [ a = Buffer( offset + size, 0xA5 ), b = Buffer( offset + size, 0xA5 ), offset ](
+            std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize( ::microlibrary::equal(
+                    a.data() + offset, a.data() + a.size(), b.data() + offset ) );
+            } // for
+        } );
+
+    suite.add(
+        name( "equal", "iterator", size, offset ),
+        size,
+        [ a = Buffer( offset + size, 0xA5 ), b = Buffer( offset + size, 0xA5 ), offset ](
+            std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize( ::microlibrary::equal( a.begin() + offset, a.end(), b.begin() + offset ) );
+            } // for
+        } );
+
+    suite.add(
+        name( "copy", "pointer", size, offset ),
+        size,
+        [ source = Buffer( offset + size, 0xA5 ), destination = Buffer( offset + size ), offset ](
+            std::uint64_t iterations ) mutable {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize( ::microlibrary::copy(
+                    source.data() + offset, source.data() + source.size(), destination.data() + offset ) );
+                clobber_memory();
+            } // for
+        } );
+
+    suite.add(
+        name( "copy", "iterator", size, offset ),
+        size,
+        [ source = Buffer( offset + size, 0xA5 ), destination = Buffer( offset + size ), offset ](
+            std::uint64_t iterations ) mutable {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                ::microlibrary::copy( source.begin() + offset, source.end(), destination.begin() + offset );
+                clobber_memory();
+            } // for
+        } );
+
+    suite.add(
+        name( "find", "pointer", size, offset ),
+        size,
+        [ buffer = Buffer( offset + size, 0xA5 ), offset ]( std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize( ::microlibrary::find(
+                    buffer.data() + offset, buffer.data() + buffer.size(), std::uint8_t{ 0x5A } ) );
+            } // for
+        } );
+
+    suite.add(
+        name( "find", "iterator", size, offset ),
+        size,
+        [ buffer = Buffer( offset + size, 0xA5 ), offset ]( std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize(
+                    ::microlibrary::find( buffer.begin() + offset, buffer.end(), std::uint8_t{ 0x5A } ) );
+            } // for
+        } );
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary algorithms benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "algorithm" };
+
+    for ( auto const size : SIZES ) {
+        for ( auto const offset : OFFSETS ) { add( suite, size, offset ); } // for
+    }                                                                     // for
+
+    return suite.main( argc, argv );
+}
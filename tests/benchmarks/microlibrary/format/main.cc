@@ -0,0 +1,265 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary formatting benchmarks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "microlibrary/format.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Format::Bin;
+using ::microlibrary::Format::Dec;
+using ::microlibrary::Format::Fixed;
+using ::microlibrary::Format::Float;
+using ::microlibrary::Format::Hex;
+using ::microlibrary::Format::Hex_Dump;
+using ::microlibrary::Format::Kernel;
+using ::microlibrary::Testing::Benchmark::Null_Output_Stream;
+using ::microlibrary::Testing::Benchmark::Null_Stream_IO_Driver;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief Reference decimal integer format specifier.
+ *
+ * Formatted by the original microlibrary::Format::Dec kernel (one digit per % 10 and / 10
+ * pair) so that the digit pair kernel can be compared against it.
+ *
+ * \tparam Integer The type of integer to format.
+ */
+template<typename Integer>
+struct Reference_Dec {
+    /**
+     * \brief The integer to format.
+     */
+    Integer integer;
+};
+
+} // namespace
+
+/**
+ * \brief Reference_Dec output formatter.
+ *
+ * \tparam Integer The type of integer to format.
+ */
+template<typename Integer>
+class microlibrary::Output_Formatter<::Reference_Dec<Integer>> {
+  public:
+    /**
+     * \brief Write a formatted integer to a stream.
+     *
+     * \param[in] stream The stream to write the formatted integer to.
+     * \param[in] reference_dec The integer to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Output_Stream & stream, ::Reference_Dec<Integer> reference_dec ) const noexcept -> std::size_t
+    {
+        char formatted_integer[ ( std::is_signed_v<Integer> ? 1 : 0 ) + std::numeric_limits<Integer>::digits10 + 1 ];
+
+        auto const end     = formatted_integer + sizeof( formatted_integer );
+        auto       i       = end;
+        auto       integer = reference_dec.integer;
+
+        if constexpr ( std::is_signed_v<Integer> ) {
+            auto const is_negative = integer < 0;
+
+            do {
+                *--i = static_cast<char>( '0' + std::abs( integer % 10 ) );
+
+                integer /= 10;
+            } while ( integer );
+
+            if ( is_negative ) {
+                *--i = '-';
+            } // if
+        } else {
+            do {
+                *--i = static_cast<char>( '0' + ( integer % 10 ) );
+
+                integer /= 10;
+            } while ( integer );
+        } // else
+
+        stream.put( i, end );
+
+        return static_cast<std::size_t>( end - i );
+    }
+};
+
+namespace {
+
+/**
+ * \brief The number of values each benchmark cycles through.
+ */
+constexpr auto VALUES = std::size_t{ 256 };
+
+/**
+ * \brief Generate values to format.
+ *
+ * \tparam T The value type.
+ *
+ * \return The values to format.
+ */
+template<typename T>
+auto values() -> std::vector<T>
+{
+    auto engine = std::mt19937_64{ 0x2B7E1516 };
+
+    auto values = std::vector<T>( VALUES );
+    if constexpr ( std::is_floating_point_v<T> ) {
+        auto distribution = std::uniform_real_distribution<T>{ -1e6, 1e6 };
+        for ( auto & value : values ) { value = distribution( engine ); } // for
+    } else {
+        using Distribution_Type = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+        auto distribution = std::uniform_int_distribution<Distribution_Type>{
+            std::numeric_limits<T>::min(), std::numeric_limits<T>::max()
+        };
+        for ( auto & value : values ) { value = static_cast<T>( distribution( engine ) ); } // for
+    }                                                                     // else
+
+    return values;
+}
+
+/**
+ * \brief Get the name of a type.
+ *
+ * \tparam T The type whose name is to be gotten.
+ *
+ * \return The name of the type.
+ */
+template<typename T>
+auto type_name() -> std::string
+{
+    if constexpr ( std::is_same_v<T, float> ) {
+        return "float";
+    } else if constexpr ( std::is_same_v<T, double> ) {
+        return "double";
+    } else {
+        return std::string{ std::is_signed_v<T> ? "int" : "uint" }
+               + std::to_string( std::numeric_limits<std::make_unsigned_t<T>>::digits );
+    } // else
+}
+
+/**
+ * \brief Add a benchmark for a format specifier, for each stream I/O driver write
+ *        mechanism (per-call writes and direct writes to the driver's write buffer).
+ *
+ * \tparam Format_Specifier The benchmarked format specifier.
+ * \tparam T The formatted value type.
+ *
+ * \param[in] suite The suite to add the benchmarks to.
+ * \param[in] name The benchmark name.
+ */
+template<typename Format_Specifier, typename T>
+void add( Suite & suite, std::string const & name )
+{
+    for ( auto const supports_reserve : { false, true } ) {
+        auto driver = std::make_shared<Null_Stream_IO_Driver>( supports_reserve );
+        auto stream = std::make_shared<Null_Output_Stream>( *driver );
+
+        suite.add(
+            name + '/' + type_name<T>() + ( supports_reserve ? "/reserve" : "/put" ),
+            [ driver, stream, values = values<T>() ]( std::uint64_t iterations ) {
+                for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                    stream->print( Format_Specifier{ values[ i % VALUES ] } );
+                } // for
+            } );
+        suite.count( "driver_calls_per_operation", [ driver ] { return driver->calls(); } );
+        suite.count( "characters_per_operation", [ driver ] { return driver->bytes(); } );
+    } // for
+}
+
+/**
+ * \brief Add the integer format specifier benchmarks for an integer type.
+ *
+ * \tparam Integer The integer type.
+ *
+ * \param[in] suite The suite to add the benchmarks to.
+ */
+template<typename Integer>
+void add_integer( Suite & suite )
+{
+    add<Dec<Integer>, Integer>( suite, "Dec" );
+    add<Reference_Dec<Integer>, Integer>( suite, "Dec/reference" );
+    if constexpr ( std::is_unsigned_v<Integer> ) {
+        add<Hex<Integer, Kernel::COMPACT>, Integer>( suite, "Hex/compact" );
+        add<Hex<Integer, Kernel::LOOKUP_TABLE>, Integer>( suite, "Hex/lookup_table" );
+        add<Bin<Integer, Kernel::COMPACT>, Integer>( suite, "Bin/compact" );
+        add<Bin<Integer, Kernel::LOOKUP_TABLE>, Integer>( suite, "Bin/lookup_table" );
+    } // if
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary formatting benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "format" };
+
+    add_integer<std::uint8_t>( suite );
+    add_integer<std::uint16_t>( suite );
+    add_integer<std::uint32_t>( suite );
+    add_integer<std::uint64_t>( suite );
+    add_integer<std::int8_t>( suite );
+    add_integer<std::int16_t>( suite );
+    add_integer<std::int32_t>( suite );
+    add_integer<std::int64_t>( suite );
+
+    add<Fixed<std::int32_t, 16>, std::int32_t>( suite, "Fixed/q16" );
+
+    add<Float<float>, float>( suite, "Float" );
+    add<Float<double>, double>( suite, "Float" );
+
+    {
+        auto driver = std::make_shared<Null_Stream_IO_Driver>();
+        auto stream = std::make_shared<Null_Output_Stream>( *driver );
+        auto data   = values<std::uint8_t>();
+
+        suite.add( "Hex_Dump/256", data.size(), [ driver, stream, data ]( std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                stream->print( Hex_Dump<std::uint16_t, std::uint8_t const *>{
+                    0x0000, data.data(), data.data() + data.size() } );
+            } // for
+        } );
+        suite.count( "driver_calls_per_operation", [ driver ] { return driver->calls(); } );
+    }
+
+    return suite.main( argc, argv );
+}
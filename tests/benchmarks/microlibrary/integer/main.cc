@@ -0,0 +1,139 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary integer utilities benchmarks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "microlibrary/integer.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Testing::Benchmark::do_not_optimize;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief The number of operands each benchmark cycles through.
+ */
+constexpr auto OPERANDS = std::size_t{ 256 };
+
+/**
+ * \brief Generate benchmark operands.
+ *
+ * \tparam Integer The operand type.
+ *
+ * \return The benchmark operands (non-zero, so that every utility's precondition is
+ *         satisfied).
+ */
+template<typename Integer>
+auto operands() -> std::vector<Integer>
+{
+    auto engine       = std::mt19937_64{ 0x4D1C2A6B };
+    auto distribution = std::uniform_int_distribution<std::uint64_t>{
+        1, std::numeric_limits<Integer>::max()
+    };
+
+    auto values = std::vector<Integer>( OPERANDS );
+    for ( auto & value : values ) { value = static_cast<Integer>( distribution( engine ) ); } // for
+
+    return values;
+}
+
+/**
+ * \brief Add a benchmark for an integer utility.
+ *
+ * \tparam Integer The operand type.
+ * \tparam Function The integer utility's type.
+ *
+ * \param[in] suite The suite to add the benchmark to.
+ * \param[in] utility The name of the integer utility.
+ * \param[in] function The integer utility.
+ */
+template<typename Integer, typename Function>
+void add( Suite & suite, char const * utility, Function function )
+{
+    suite.add(
+        std::string{ utility } + "/uint" + std::to_string( std::numeric_limits<Integer>::digits ),
+        [ values = operands<Integer>(), function ]( std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+                do_not_optimize( function( values[ i % OPERANDS ] ) );
+            } // for
+        } );
+}
+
+/**
+ * \brief Add the benchmarks for an integer width.
+ *
+ * \tparam Integer The operand type.
+ *
+ * \param[in] suite The suite to add the benchmarks to.
+ */
+template<typename Integer>
+void add( Suite & suite )
+{
+    add<Integer>( suite, "highest_bit_set", []( Integer value ) {
+        return ::microlibrary::highest_bit_set( value );
+    } );
+    add<Integer>( suite, "byte_swap", []( Integer value ) {
+        return ::microlibrary::byte_swap( value );
+    } );
+    add<Integer>(
+        suite, "reflect", []( Integer value ) { return ::microlibrary::reflect( value ); } );
+    add<Integer>( suite, "is_power_of_two", []( Integer value ) {
+        return ::microlibrary::is_power_of_two( value );
+    } );
+    add<Integer>(
+        suite, "popcount", []( Integer value ) { return ::microlibrary::popcount( value ); } );
+    add<Integer>( suite, "countr_zero", []( Integer value ) {
+        return ::microlibrary::countr_zero( value );
+    } );
+    add<Integer>(
+        suite, "rotl", []( Integer value ) { return ::microlibrary::rotl( value, 3 ); } );
+    add<Integer>(
+        suite, "rotr", []( Integer value ) { return ::microlibrary::rotr( value, 3 ); } );
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary integer utilities benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "integer" };
+
+    add<std::uint8_t>( suite );
+    add<std::uint16_t>( suite );
+    add<std::uint32_t>( suite );
+    add<std::uint64_t>( suite );
+
+    return suite.main( argc, argv );
+}
@@ -0,0 +1,84 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Log benchmarks.
+ */
+
+#include <cstdint>
+#include <memory>
+
+#include "microlibrary/format.h"
+#include "microlibrary/log.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Testing::Benchmark::Null_Output_Stream;
+using ::microlibrary::Testing::Benchmark::Null_Stream_IO_Driver;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief Add a benchmark.
+ *
+ * \tparam Write The type of the functor used to write a record.
+ *
+ * \param[in] suite The suite to add the benchmark to.
+ * \param[in] name The benchmark name.
+ * \param[in] write The functor used to write a record.
+ */
+template<typename Write>
+void add( Suite & suite, char const * name, Write write )
+{
+    auto driver = std::make_shared<Null_Stream_IO_Driver>();
+    auto stream = std::make_shared<Null_Output_Stream>( *driver );
+
+    suite.add( name, [ driver, stream, write ]( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            write( *stream, static_cast<std::uint8_t>( i & 0x7 ), static_cast<std::uint16_t>( i ) );
+        } // for
+    } );
+    suite.count( "driver_calls_per_record", [ driver ] { return driver->calls(); } );
+    suite.count( "bytes_per_record", [ driver ] { return driver->bytes(); } );
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary::Log benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "log" };
+
+    add( suite, "text", []( auto & stream, std::uint8_t channel, std::uint16_t sample ) {
+        stream.print( MICROLIBRARY_FORMAT( "ADC channel {} sample: {}\n" ), channel, sample );
+    } );
+
+    add( suite, "binary", []( auto & stream, std::uint8_t channel, std::uint16_t sample ) {
+        ::microlibrary::Log::write(
+            stream, MICROLIBRARY_FORMAT( "ADC channel {} sample: {}\n" ), channel, sample );
+    } );
+
+    return suite.main( argc, argv );
+}
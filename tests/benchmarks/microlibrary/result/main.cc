@@ -0,0 +1,133 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary::Result benchmarks.
+ */
+
+#include <cstdint>
+
+#include "microlibrary/error.h"
+#include "microlibrary/result.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Generic_Error;
+using ::microlibrary::Result;
+using ::microlibrary::Testing::Benchmark::do_not_optimize;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief Produce a value or an error (innermost call of a propagation chain).
+ *
+ * \param[in] value The value to produce. A value of 0 produces an error.
+ *
+ * \return The value if it is not 0.
+ * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the value is 0.
+ */
+[[gnu::noinline]] auto produce( std::uint32_t value ) noexcept -> Result<std::uint32_t>
+{
+    if ( value == 0 ) {
+        return Generic_Error::INVALID_ARGUMENT;
+    } // if
+
+    return value;
+}
+
+/**
+ * \brief Propagate a value or an error through a number of calls.
+ *
+ * \tparam DEPTH The number of calls to propagate the value or error through.
+ *
+ * \param[in] value The value to produce. A value of 0 produces an error.
+ *
+ * \return The value if it is not 0.
+ * \return microlibrary::Generic_Error::INVALID_ARGUMENT if the value is 0.
+ */
+template<int DEPTH>
+[[gnu::noinline]] auto propagate( std::uint32_t value ) noexcept -> Result<std::uint32_t>
+{
+    auto result = [ value ] {
+        if constexpr ( DEPTH == 1 ) {
+            return produce( value );
+        } else {
+            return propagate<DEPTH - 1>( value );
+        } // else
+    }();
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return result.value() + 1;
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary::Result benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "result" };
+
+    suite.add( "construct/value", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            auto const result = Result<std::uint64_t>{ i };
+            do_not_optimize( result );
+        } // for
+    } );
+
+    suite.add( "construct/error", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            auto const result = Result<std::uint64_t>{ Generic_Error::RUNTIME_ERROR };
+            do_not_optimize( result );
+        } // for
+    } );
+
+    suite.add( "propagate/value/depth:1", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            do_not_optimize( propagate<1>( 1 ) );
+        } // for
+    } );
+
+    suite.add( "propagate/error/depth:1", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            do_not_optimize( propagate<1>( 0 ) );
+        } // for
+    } );
+
+    suite.add( "propagate/value/depth:4", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            do_not_optimize( propagate<4>( 1 ) );
+        } // for
+    } );
+
+    suite.add( "propagate/error/depth:4", []( std::uint64_t iterations ) {
+        for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) {
+            do_not_optimize( propagate<4>( 0 ) );
+        } // for
+    } );
+
+    return suite.main( argc, argv );
+}
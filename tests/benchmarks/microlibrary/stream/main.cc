@@ -0,0 +1,135 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary streams benchmarks.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "microlibrary/buffered_stream_io_driver.h"
+#include "microlibrary/stream.h"
+#include "microlibrary/testing/benchmark.h"
+
+namespace {
+
+using ::microlibrary::Buffered_Stream_IO_Driver;
+using ::microlibrary::Character_Block;
+using ::microlibrary::Output_Stream;
+using ::microlibrary::Testing::Benchmark::Null_Output_Stream;
+using ::microlibrary::Testing::Benchmark::Null_Stream_IO_Driver;
+using ::microlibrary::Testing::Benchmark::Suite;
+
+/**
+ * \brief The capacity of the buffered stream I/O driver's write buffer.
+ */
+constexpr auto BUFFER_SIZE = std::size_t{ 64 };
+
+/**
+ * \brief Benchmark text.
+ */
+constexpr char TEXT[] = "The quick brown fox jumps over the lazy dog.";
+
+/**
+ * \brief Add a benchmark for a write, with the stream writing directly to a null stream
+ *        I/O driver, and with the stream writing to a null stream I/O driver through a
+ *        buffered stream I/O driver.
+ *
+ * \tparam Write The type of the functor used to perform the write.
+ *
+ * \param[in] suite The suite to add the benchmarks to.
+ * \param[in] name The benchmark name.
+ * \param[in] bytes_per_operation The number of bytes written by each write.
+ * \param[in] write The functor used to perform the write.
+ */
+template<typename Write>
+void add( Suite & suite, std::string const & name, std::size_t bytes_per_operation, Write write )
+{
+    {
+        auto driver = std::make_shared<Null_Stream_IO_Driver>();
+        auto stream = std::make_shared<Null_Output_Stream>( *driver );
+
+        suite.add( name + "/direct", bytes_per_operation, [ driver, stream, write ]( std::uint64_t iterations ) {
+            for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) { write( *stream ); } // for
+        } );
+        suite.count( "driver_calls_per_operation", [ driver ] { return driver->calls(); } );
+    }
+
+    {
+        auto driver = std::make_shared<Null_Stream_IO_Driver>();
+        auto buffered_driver = std::make_shared<Buffered_Stream_IO_Driver<BUFFER_SIZE>>( *driver );
+        auto stream = std::make_shared<Null_Output_Stream>( *buffered_driver );
+
+        suite.add(
+            name + "/buffered:" + std::to_string( BUFFER_SIZE ),
+            bytes_per_operation,
+            [ driver, buffered_driver, stream, write ]( std::uint64_t iterations ) {
+                for ( auto i = std::uint64_t{ 0 }; i < iterations; ++i ) { write( *stream ); } // for
+            } );
+        suite.count( "driver_calls_per_operation", [ driver ] { return driver->calls(); } );
+    }
+}
+
+} // namespace
+
+/**
+ * \brief Execute the microlibrary streams benchmarks.
+ *
+ * \param[in] argc The number of arguments.
+ * \param[in] argv The array of arguments.
+ *
+ * \return See microlibrary::Testing::Benchmark::Suite::main().
+ */
+auto main( int argc, char * argv[] ) -> int
+{
+    auto suite = Suite{ "stream" };
+
+    add( suite, "put/character", 1, []( Output_Stream & stream ) { stream.put( 'x' ); } );
+
+    add( suite, "put/data", 1, []( Output_Stream & stream ) {
+        stream.put( std::uint8_t{ 0xA5 } );
+    } );
+
+    add( suite, "put/block", sizeof( TEXT ) - 1, []( Output_Stream & stream ) {
+        stream.put( TEXT, TEXT + sizeof( TEXT ) - 1 );
+    } );
+
+    add( suite, "put/string", sizeof( TEXT ) - 1, []( Output_Stream & stream ) {
+        stream.put( TEXT );
+    } );
+
+    add( suite, "put/character_blocks:4", sizeof( TEXT ) - 1, []( Output_Stream & stream ) {
+        Character_Block const blocks[]{
+            { TEXT, TEXT + 4 },
+            { TEXT + 4, TEXT + 20 },
+            { TEXT + 20, TEXT + 35 },
+            { TEXT + 35, TEXT + sizeof( TEXT ) - 1 },
+        };
+
+        stream.put( blocks, blocks + 4 );
+    } );
+
+    add( suite, "print/string", sizeof( TEXT ) - 1, []( Output_Stream & stream ) {
+        stream.print( TEXT );
+    } );
+
+    return suite.main( argc, argv );
+}
@@ -0,0 +1,89 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary algorithms size report translation unit.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "microlibrary/algorithm.h"
+
+namespace microlibrary::Size_Report {
+
+/**
+ * \brief Fill a byte range.
+ *
+ * \param[in] begin The beginning of the range to fill.
+ * \param[in] end The end of the range to fill.
+ * \param[in] value The value to fill the range with.
+ */
+void fill( std::uint8_t * begin, std::uint8_t * end, std::uint8_t value ) noexcept
+{
+    ::microlibrary::fill( begin, end, value );
+}
+
+/**
+ * \brief Compare two byte ranges for equality.
+ *
+ * \param[in] begin_1 The beginning of the first range to compare.
+ * \param[in] end_1 The end of the first range to compare.
+ * \param[in] begin_2 The beginning of the second range to compare.
+ *
+ * \return true if the ranges are equal.
+ * \return false if the ranges are not equal.
+ */
+auto equal( std::uint8_t const * begin_1, std::uint8_t const * end_1, std::uint8_t const * begin_2 ) noexcept
+    -> bool
+{
+    return ::microlibrary::equal( begin_1, end_1, begin_2 );
+}
+
+/**
+ * \brief Copy a byte range.
+ *
+ * \param[in] begin The beginning of the range to copy.
+ * \param[in] end The end of the range to copy.
+ * \param[in] destination The beginning of the range to copy to.
+ *
+ * \return The end of the range copied to.
+ */
+auto copy( std::uint8_t const * begin, std::uint8_t const * end, std::uint8_t * destination ) noexcept
+    -> std::uint8_t *
+{
+    return ::microlibrary::copy( begin, end, destination );
+}
+
+/**
+ * \brief Find a byte in a byte range.
+ *
+ * \param[in] begin The beginning of the range to search.
+ * \param[in] end The end of the range to search.
+ * \param[in] value The value to search for.
+ *
+ * \return The first occurrence of the value if the range contains the value.
+ * \return end if the range does not contain the value.
+ */
+auto find( std::uint8_t const * begin, std::uint8_t const * end, std::uint8_t value ) noexcept
+    -> std::uint8_t const *
+{
+    return ::microlibrary::find( begin, end, value );
+}
+
+} // namespace microlibrary::Size_Report
@@ -0,0 +1,172 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary containers size report translation unit.
+ */
+
+#include <cstdint>
+
+#include "microlibrary/pool.h"
+#include "microlibrary/result.h"
+#include "microlibrary/ring_buffer.h"
+#include "microlibrary/static_vector.h"
+
+namespace microlibrary::Size_Report {
+
+/**
+ * \brief Reported ring buffer type.
+ */
+using Ring_Buffer = ::microlibrary::Ring_Buffer<std::uint8_t, 64>;
+
+/**
+ * \brief Reported static vector type.
+ */
+using Static_Vector = ::microlibrary::Static_Vector<std::uint8_t, 32>;
+
+/**
+ * \brief Reported pool type.
+ */
+using Pool = ::microlibrary::Pool<std::uint32_t, 8>;
+
+/**
+ * \brief Push an element into a ring buffer.
+ *
+ * \param[in] ring_buffer The ring buffer to push the element into.
+ * \param[in] value The element to push into the ring buffer.
+ *
+ * \return Nothing if pushing the element into the ring buffer succeeded.
+ * \return An error code if pushing the element into the ring buffer failed.
+ */
+auto push( Ring_Buffer & ring_buffer, std::uint8_t value ) noexcept -> Result<void>
+{
+    return ring_buffer.push( value );
+}
+
+/**
+ * \brief Push a block of elements into a ring buffer.
+ *
+ * \param[in] ring_buffer The ring buffer to push the elements into.
+ * \param[in] begin The beginning of the block of elements to push into the ring buffer.
+ * \param[in] end The end of the block of elements to push into the ring buffer.
+ *
+ * \return The end of the elements that were pushed into the ring buffer.
+ */
+auto push( Ring_Buffer & ring_buffer, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint8_t const *
+{
+    return ring_buffer.push( begin, end );
+}
+
+/**
+ * \brief Pop an element from a ring buffer.
+ *
+ * \param[in] ring_buffer The ring buffer to pop the element from.
+ *
+ * \return The element that was popped from the ring buffer if popping an element from
+ *         the ring buffer succeeded.
+ * \return An error code if popping an element from the ring buffer failed.
+ */
+auto pop( Ring_Buffer & ring_buffer ) noexcept -> Result<std::uint8_t>
+{
+    return ring_buffer.pop();
+}
+
+/**
+ * \brief Pop a block of elements from a ring buffer.
+ *
+ * \param[in] ring_buffer The ring buffer to pop the elements from.
+ * \param[in] begin The beginning of the block to pop the elements into.
+ * \param[in] end The end of the block to pop the elements into.
+ *
+ * \return The end of the elements that were popped from the ring buffer.
+ */
+auto pop( Ring_Buffer & ring_buffer, std::uint8_t * begin, std::uint8_t * end ) noexcept -> std::uint8_t *
+{
+    return ring_buffer.pop( begin, end );
+}
+
+/**
+ * \brief Append an element to a static vector.
+ *
+ * \param[in] static_vector The static vector to append the element to.
+ * \param[in] value The element to append to the static vector.
+ *
+ * \return Nothing if appending the element to the static vector succeeded.
+ * \return An error code if appending the element to the static vector failed.
+ */
+auto push_back( Static_Vector & static_vector, std::uint8_t value ) noexcept -> Result<void>
+{
+    return static_vector.push_back( value );
+}
+
+/**
+ * \brief Insert an element at the beginning of a static vector.
+ *
+ * \param[in] static_vector The static vector to insert the element into.
+ * \param[in] value The element to insert into the static vector.
+ *
+ * \return Nothing if inserting the element into the static vector succeeded.
+ * \return An error code if inserting the element into the static vector failed.
+ */
+auto push_front( Static_Vector & static_vector, std::uint8_t value ) noexcept -> Result<void>
+{
+    auto result = static_vector.insert( static_vector.begin(), value );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return {};
+}
+
+/**
+ * \brief Erase the first element of a static vector.
+ *
+ * \param[in] static_vector The static vector to erase the element from.
+ */
+void pop_front( Static_Vector & static_vector ) noexcept
+{
+    static_vector.erase( static_vector.begin() );
+}
+
+/**
+ * \brief Allocate an object from a pool.
+ *
+ * \param[in] pool The pool to allocate the object from.
+ * \param[in] value The value to initialize the object with.
+ *
+ * \return The handle of the allocated object if allocating the object succeeded.
+ * \return An error code if allocating the object failed.
+ */
+auto allocate( Pool & pool, std::uint32_t value ) noexcept -> Result<Pool::Handle>
+{
+    return pool.allocate( value );
+}
+
+/**
+ * \brief Return an object to a pool.
+ *
+ * \param[in] pool The pool to return the object to.
+ * \param[in] handle The handle of the object to return to the pool.
+ */
+void free( Pool & pool, Pool::Handle handle ) noexcept
+{
+    pool.free( handle );
+}
+
+} // namespace microlibrary::Size_Report
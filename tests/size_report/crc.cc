@@ -0,0 +1,99 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary CRC size report translation unit.
+ */
+
+#include <cstdint>
+
+#include "microlibrary/crc.h"
+
+namespace microlibrary::Size_Report {
+
+/**
+ * \brief Calculate a CRC-16/XMODEM using the bitwise kernel.
+ *
+ * \param[in] begin The beginning of the data to calculate the CRC of.
+ * \param[in] end The end of the data to calculate the CRC of.
+ *
+ * \return The CRC.
+ */
+auto crc_16_xmodem_bitwise( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint16_t
+{
+    return CRC_16_XMODEM<CRC_Kernel::BITWISE>::calculate( begin, end );
+}
+
+/**
+ * \brief Calculate a CRC-16/XMODEM using the nibble table kernel.
+ *
+ * \param[in] begin The beginning of the data to calculate the CRC of.
+ * \param[in] end The end of the data to calculate the CRC of.
+ *
+ * \return The CRC.
+ */
+auto crc_16_xmodem_nibble_table( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint16_t
+{
+    return CRC_16_XMODEM<CRC_Kernel::NIBBLE_TABLE>::calculate( begin, end );
+}
+
+/**
+ * \brief Calculate a CRC-16/XMODEM using the byte table kernel.
+ *
+ * \param[in] begin The beginning of the data to calculate the CRC of.
+ * \param[in] end The end of the data to calculate the CRC of.
+ *
+ * \return The CRC.
+ */
+auto crc_16_xmodem_byte_table( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint16_t
+{
+    return CRC_16_XMODEM<CRC_Kernel::BYTE_TABLE>::calculate( begin, end );
+}
+
+/**
+ * \brief Calculate a CRC-32/ISO-HDLC using the bitwise kernel.
+ *
+ * \param[in] begin The beginning of the data to calculate the CRC of.
+ * \param[in] end The end of the data to calculate the CRC of.
+ *
+ * \return The CRC.
+ */
+auto crc_32_iso_hdlc_bitwise( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint32_t
+{
+    return CRC_32_ISO_HDLC<CRC_Kernel::BITWISE>::calculate( begin, end );
+}
+
+/**
+ * \brief Calculate a CRC-32/ISO-HDLC using the byte table kernel.
+ *
+ * \param[in] begin The beginning of the data to calculate the CRC of.
+ * \param[in] end The end of the data to calculate the CRC of.
+ *
+ * \return The CRC.
+ */
+auto crc_32_iso_hdlc_byte_table( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> std::uint32_t
+{
+    return CRC_32_ISO_HDLC<CRC_Kernel::BYTE_TABLE>::calculate( begin, end );
+}
+
+} // namespace microlibrary::Size_Report
@@ -0,0 +1,108 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary formatting size report translation unit.
+ */
+
+#include <cstdint>
+
+#include "microlibrary/format.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary::Size_Report {
+
+/**
+ * \brief Print an unsigned integer in decimal.
+ *
+ * \param[in] stream The stream to print the integer to.
+ * \param[in] value The integer to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_dec( Output_Stream & stream, std::uint32_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Dec{ value } );
+}
+
+/**
+ * \brief Print a signed integer in decimal.
+ *
+ * \param[in] stream The stream to print the integer to.
+ * \param[in] value The integer to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_dec( Output_Stream & stream, std::int32_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Dec{ value } );
+}
+
+/**
+ * \brief Print an unsigned integer in hexadecimal using the compact kernel.
+ *
+ * \param[in] stream The stream to print the integer to.
+ * \param[in] value The integer to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_hex_compact( Output_Stream & stream, std::uint32_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Hex<std::uint32_t, Format::Kernel::COMPACT>{ value } );
+}
+
+/**
+ * \brief Print an unsigned integer in hexadecimal using the lookup table kernel.
+ *
+ * \param[in] stream The stream to print the integer to.
+ * \param[in] value The integer to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_hex_lookup_table( Output_Stream & stream, std::uint32_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Hex<std::uint32_t, Format::Kernel::LOOKUP_TABLE>{ value } );
+}
+
+/**
+ * \brief Print an unsigned integer in binary.
+ *
+ * \param[in] stream The stream to print the integer to.
+ * \param[in] value The integer to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_bin( Output_Stream & stream, std::uint8_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Bin{ value } );
+}
+
+/**
+ * \brief Print a Q16.16 fixed-point number.
+ *
+ * \param[in] stream The stream to print the number to.
+ * \param[in] value The number to print.
+ *
+ * \return The number of characters printed to the stream.
+ */
+auto print_fixed( Output_Stream & stream, std::int32_t value ) noexcept -> std::size_t
+{
+    return stream.print( Format::Fixed<std::int32_t, 16>{ value } );
+}
+
+} // namespace microlibrary::Size_Report
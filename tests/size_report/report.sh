@@ -0,0 +1,313 @@
+#!/usr/bin/env bash
+
+# microlibrary
+#
+# Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+# contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+# file except in compliance with the License. You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under
+# the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the License for the specific language governing
+# permissions and limitations under the License.
+
+# Description: Size report generation script.
+
+set -o pipefail
+
+function error()
+{
+    local -r message="$1"
+
+    ( >&2 echo "$mnemonic: $message" )
+}
+
+function abort()
+{
+    if [[ "$#" -gt 0 ]]; then
+        local -r message="$1"
+
+        error "$message, aborting"
+    fi
+
+    exit 1
+}
+
+function display_help_text()
+{
+    printf "%b" \
+        "NAME\n" \
+        "    $mnemonic - Generate a code size and stack usage report.\n" \
+        "SYNOPSIS\n" \
+        "    $mnemonic --help\n" \
+        "    $mnemonic --nm <nm> --size <size> --configuration <configuration> --output-directory <directory> <object>...\n" \
+        "OPTIONS\n" \
+        "    --configuration <configuration>\n" \
+        "        Specify the name of the configuration the objects were built with.\n" \
+        "    --help\n" \
+        "        Display this help text.\n" \
+        "    --nm <nm>\n" \
+        "        Specify the nm executable to use to get per-symbol sizes.\n" \
+        "    --output-directory <directory>\n" \
+        "        Specify the directory to write the report (report.json and report.md) to.\n" \
+        "    --size <size>\n" \
+        "        Specify the size executable to use to get per-section sizes.\n" \
+        "DESCRIPTION\n" \
+        "    Each object is reported as a translation unit. Per-function stack usage is read\n" \
+        "    from the GCC -fstack-usage output (.su file) located next to each object.\n" \
+        "    Translation units, symbols, and functions are sorted by name so that reports\n" \
+        "    generated for different revisions can be diffed.\n" \
+        ""
+}
+
+function translation_unit_name()
+{
+    local -r object="$1"
+
+    local name; name=$( basename "$object" )
+    name="${name%.o}"
+    name="${name%.obj}"
+    name="${name%.cc}"
+
+    echo "$name"
+}
+
+function stack_usage_file()
+{
+    local -r object="$1"
+
+    local candidate
+    for candidate in "${object%.*}.su" "${object%.*.*}.su"; do
+        if [[ -f "$candidate" ]]; then
+            echo "$candidate"
+            return
+        fi
+    done
+}
+
+function generate_tables()
+{
+    local object
+    for object in "${objects[@]}"; do
+        local name; name=$( translation_unit_name "$object" )
+
+        local sections; sections=$( "$size" "$object" ) || abort "unable to get section sizes for '$object'"
+
+        awk -v name="$name" 'NR == 2 { print "unit\t" name "\t" $1 "\t" $2 "\t" $3 }' <<< "$sections" || abort
+
+        local symbols; symbols=$( "$nm" --print-size --defined-only --demangle --radix=d "$object" ) || abort "unable to get symbol sizes for '$object'"
+
+        awk -v name="$name" '
+            NF >= 4 && $3 ~ /^[A-Za-z]$/ {
+                symbol = $0
+                sub( /^[^ ]+ +[^ ]+ +[^ ]+ +/, "", symbol )
+                print "symbol\t" name "\t" symbol "\t" $3 "\t" ( $2 + 0 )
+            }' <<< "$symbols" || abort
+
+        local su; su=$( stack_usage_file "$object" )
+        if [[ -z "$su" ]]; then
+            error "no stack usage information found for '$object'"
+            continue
+        fi
+
+        awk -F '\t' -v name="$name" '
+            {
+                function_name = $1
+                sub( /^[^:]*:[0-9]+:[0-9]+:/, "", function_name )
+                print "stack\t" name "\t" function_name "\t" $2 "\t" $3
+            }' "$su" || abort
+    done
+}
+
+function generate_json_report()
+{
+    awk -F '\t' -v configuration="$configuration" '
+        function escape( string ) {
+            gsub( /\\/, "\\\\", string )
+            gsub( /"/, "\\\"", string )
+            return "\"" string "\""
+        }
+
+        $1 == "unit" {
+            units[ ++unit_count ] = $2
+            text[ $2 ] = $3
+            data[ $2 ] = $4
+            bss[ $2 ] = $5
+        }
+
+        $1 == "symbol" {
+            symbols[ $2 ] = symbols[ $2 ] ( symbols[ $2 ] == "" ? "" : ",\n" ) \
+                "        { \"name\": " escape( $3 ) ", \"type\": \"" $4 "\", \"size\": " $5 " }"
+        }
+
+        $1 == "stack" {
+            stack[ $2 ] = stack[ $2 ] ( stack[ $2 ] == "" ? "" : ",\n" ) \
+                "        { \"function\": " escape( $3 ) ", \"bytes\": " $4 ", \"qualifier\": " escape( $5 ) " }"
+            if ( $4 + 0 > maximum_stack[ $2 ] + 0 ) {
+                maximum_stack[ $2 ] = $4 + 0
+            }
+        }
+
+        END {
+            print "{"
+            print "  \"configuration\": " escape( configuration ) ","
+            print "  \"translation_units\": ["
+            for ( i = 1; i <= unit_count; ++i ) {
+                unit = units[ i ]
+                print "    {"
+                print "      \"name\": " escape( unit ) ","
+                print "      \"text\": " text[ unit ] ","
+                print "      \"data\": " data[ unit ] ","
+                print "      \"bss\": " bss[ unit ] ","
+                print "      \"maximum_stack_usage\": " ( maximum_stack[ unit ] + 0 ) ","
+                print "      \"symbols\": [" ( symbols[ unit ] == "" ? "]," : "\n" symbols[ unit ] "\n      ]," )
+                print "      \"stack_usage\": [" ( stack[ unit ] == "" ? "]" : "\n" stack[ unit ] "\n      ]" )
+                print "    }" ( i < unit_count ? "," : "" )
+            }
+            print "  ]"
+            print "}"
+        }'
+}
+
+function generate_markdown_report()
+{
+    awk -F '\t' -v configuration="$configuration" '
+        function escape( string ) {
+            gsub( /\|/, "\\|", string )
+            return "`" string "`"
+        }
+
+        $1 == "unit" {
+            units[ ++unit_count ] = $2
+            text[ $2 ] = $3
+            data[ $2 ] = $4
+            bss[ $2 ] = $5
+        }
+
+        $1 == "symbol" {
+            symbols[ $2 ] = symbols[ $2 ] "| " escape( $3 ) " | " $4 " | " $5 " |\n"
+        }
+
+        $1 == "stack" {
+            stack[ $2 ] = stack[ $2 ] "| " escape( $3 ) " | " $4 " | " $5 " |\n"
+            if ( $4 + 0 > maximum_stack[ $2 ] + 0 ) {
+                maximum_stack[ $2 ] = $4 + 0
+            }
+        }
+
+        END {
+            print "# Size Report (" configuration ")"
+            print ""
+            print "## Summary"
+            print ""
+            print "| Translation Unit | Text | Data | BSS | Maximum Stack Usage |"
+            print "| --- | ---: | ---: | ---: | ---: |"
+            for ( i = 1; i <= unit_count; ++i ) {
+                unit = units[ i ]
+                print "| " unit " | " text[ unit ] " | " data[ unit ] " | " bss[ unit ] " | " ( maximum_stack[ unit ] + 0 ) " |"
+                total_text += text[ unit ]
+                total_data += data[ unit ]
+                total_bss += bss[ unit ]
+            }
+            print "| **Total** | " total_text " | " total_data " | " total_bss " | |"
+            for ( i = 1; i <= unit_count; ++i ) {
+                unit = units[ i ]
+                print ""
+                print "## " unit
+                print ""
+                print "| Symbol | Type | Size |"
+                print "| --- | :---: | ---: |"
+                printf "%s", symbols[ unit ]
+                print ""
+                print "| Function | Stack Usage | Qualifier |"
+                print "| --- | ---: | --- |"
+                printf "%s", stack[ unit ]
+            }
+        }'
+}
+
+function main()
+{
+    local -r script=$( readlink -f "$0" )
+    local -r mnemonic=$( basename "$script" )
+
+    local objects=()
+
+    while [[ "$#" -gt 0 ]]; do
+        local argument="$1"; shift
+
+        case "$argument" in
+            --configuration)
+                if [[ "$#" -le 0 ]]; then
+                    abort "configuration not specified"
+                fi
+
+                local -r configuration="$1"; shift
+                ;;
+            --help)
+                display_help_text
+                exit
+                ;;
+            --nm)
+                if [[ "$#" -le 0 ]]; then
+                    abort "nm executable not specified"
+                fi
+
+                local -r nm="$1"; shift
+                ;;
+            --output-directory)
+                if [[ "$#" -le 0 ]]; then
+                    abort "output directory not specified"
+                fi
+
+                local -r output_directory="$1"; shift
+                ;;
+            --size)
+                if [[ "$#" -le 0 ]]; then
+                    abort "size executable not specified"
+                fi
+
+                local -r size="$1"; shift
+                ;;
+            --*)
+                ;&
+            -*)
+                abort "'$argument' is not a supported option"
+                ;;
+            *)
+                objects+=( "$argument" )
+                ;;
+        esac
+    done
+
+    if [[ -z "$nm" || -z "$size" || -z "$configuration" || -z "$output_directory" ]]; then
+        abort "'--nm', '--size', '--configuration', and '--output-directory' must be specified"
+    fi
+
+    if [[ "${#objects[@]}" -le 0 ]]; then
+        abort "no objects specified"
+    fi
+
+    mapfile -t objects < <( for object in "${objects[@]}"; do echo "$object"; done | LC_ALL=C sort ); readonly objects
+
+    if ! mkdir -p "$output_directory"; then
+        abort "unable to create '$output_directory'"
+    fi
+
+    local tables; tables=$( generate_tables ) || abort
+    tables=$( LC_ALL=C sort -t $'\t' -k 1,1 -k 2,2 -k 3,3 <<< "$tables" ) || abort "unable to sort report tables"
+
+    if ! generate_json_report <<< "$tables" > "$output_directory/report.json"; then
+        abort "unable to generate JSON report"
+    fi
+
+    if ! generate_markdown_report <<< "$tables" > "$output_directory/report.md"; then
+        abort "unable to generate Markdown report"
+    fi
+}
+
+main "$@"
@@ -0,0 +1,80 @@
+/**
+ * microlibrary
+ *
+ * Copyright 2024, Andrew Countryman <apcountryman@gmail.com> and the microlibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief microlibrary streams size report translation unit.
+ */
+
+#include <cstdint>
+
+#include "microlibrary/buffered_stream_io_driver.h"
+#include "microlibrary/stream.h"
+
+namespace microlibrary::Size_Report {
+
+/**
+ * \brief Reported buffered stream I/O driver type.
+ */
+using Buffered_Stream_IO_Driver = ::microlibrary::Buffered_Stream_IO_Driver<32>;
+
+/**
+ * \brief Write a string to a stream.
+ *
+ * \param[in] stream The stream to write the string to.
+ * \param[in] string The null-terminated string to write to the stream.
+ */
+void put( Output_Stream & stream, char const * string ) noexcept
+{
+    stream.put( string );
+}
+
+/**
+ * \brief Write a block of data to a stream.
+ *
+ * \param[in] stream The stream to write the block of data to.
+ * \param[in] begin The beginning of the block of data to write to the stream.
+ * \param[in] end The end of the block of data to write to the stream.
+ */
+void put( Output_Stream & stream, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    stream.put( begin, end );
+}
+
+/**
+ * \brief Write a block of data to a buffered stream I/O driver.
+ *
+ * \param[in] driver The driver to write the block of data to.
+ * \param[in] begin The beginning of the block of data to write to the driver.
+ * \param[in] end The end of the block of data to write to the driver.
+ */
+void put( Buffered_Stream_IO_Driver & driver, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    driver.put( begin, end );
+}
+
+/**
+ * \brief Flush a buffered stream I/O driver.
+ *
+ * \param[in] driver The driver to flush.
+ */
+void flush( Buffered_Stream_IO_Driver & driver ) noexcept
+{
+    driver.flush();
+}
+
+} // namespace microlibrary::Size_Report